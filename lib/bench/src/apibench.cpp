@@ -0,0 +1,77 @@
+#include "benchmark.hpp"
+
+#include "fixture/library.hpp"
+#include "fixture/temppaths.hpp"
+#include "lib/replayhttpclient.hpp"
+#include "lib/spotify/api.hpp"
+
+#include <memory>
+
+namespace
+{
+	/**
+	 * Saved tracks, fetched in pages of 50
+	 */
+	constexpr size_t track_count = 2000;
+
+	/**
+	 * API responding with recorded responses, without any network access
+	 */
+	class api_state
+	{
+	public:
+		explicit api_state(const std::vector<lib::http_exchange> &exchanges)
+			: paths("api-bench"),
+			settings(paths),
+			http(exchanges),
+			request(settings, http),
+			spotify(settings, http, request)
+		{
+		}
+
+		fixture::temp_paths paths;
+		lib::settings settings;
+		lib::replay_http_client http;
+		lib::spt::request request;
+		lib::spt::api spotify;
+	};
+
+	auto saved_tracks_pages() -> std::vector<lib::http_exchange>
+	{
+		fixture::scale scale;
+		scale.saved_tracks = track_count;
+		const fixture::library library(scale);
+
+		std::vector<lib::http_exchange> pages;
+		for (size_t offset = 0; offset < track_count; offset += 50)
+		{
+			lib::http_exchange page;
+			page.method = "GET";
+			page.url = offset == 0
+				? std::string("https://api.spotify.com/v1/me/tracks?limit=50")
+				: lib::fmt::format("https://api.spotify.com/v1/me/tracks?offset={}&limit=50",
+					offset);
+			page.status = 200;
+			page.response = library.saved_tracks_page(offset, 50).dump();
+			pages.push_back(page);
+		}
+		return pages;
+	}
+}
+
+void bench::add_api(runner &runner)
+{
+	runner.add("api/saved_tracks", []() -> operation
+	{
+		const auto state = std::make_shared<api_state>(saved_tracks_pages());
+		state->settings.account.last_refresh = lib::date_time::seconds_since_epoch();
+
+		return [state]()
+		{
+			state->spotify.saved_tracks([](const std::vector<lib::spt::track> &tracks)
+			{
+				keep(tracks);
+			});
+		};
+	});
+}
@@ -0,0 +1,46 @@
+#include "benchmark.hpp"
+
+#include "lib/base64.hpp"
+
+namespace
+{
+	/**
+	 * Roughly the size of a small album image
+	 */
+	auto binary() -> std::string
+	{
+		std::string data;
+		data.reserve(16384);
+
+		for (size_t i = 0; i < 16384; i++)
+		{
+			data += static_cast<char>((i * 31 + 7) % 256);
+		}
+		return data;
+	}
+}
+
+void bench::add_base64(runner &runner)
+{
+	runner.add("base64/encode", []() -> operation
+	{
+		const auto data = binary();
+
+		return [data]()
+		{
+			const auto encoded = lib::base64::encode(data);
+			keep(encoded);
+		};
+	});
+
+	runner.add("base64/decode", []() -> operation
+	{
+		const auto encoded = lib::base64::encode(binary());
+
+		return [encoded]()
+		{
+			const auto decoded = lib::base64::decode(encoded);
+			keep(decoded);
+		};
+	});
+}
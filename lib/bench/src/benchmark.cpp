@@ -0,0 +1,159 @@
+#include "benchmark.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <numeric>
+
+auto bench::result::min() const -> double
+{
+	return samples.empty()
+		? 0.0
+		: *std::min_element(samples.cbegin(), samples.cend());
+}
+
+auto bench::result::median() const -> double
+{
+	if (samples.empty())
+	{
+		return 0.0;
+	}
+
+	auto sorted = samples;
+	std::sort(sorted.begin(), sorted.end());
+
+	const auto middle = sorted.size() / 2;
+	return sorted.size() % 2 == 0
+		? (sorted.at(middle - 1) + sorted.at(middle)) / 2.0
+		: sorted.at(middle);
+}
+
+auto bench::result::mean() const -> double
+{
+	return samples.empty()
+		? 0.0
+		: std::accumulate(samples.cbegin(), samples.cend(), 0.0)
+			/ static_cast<double>(samples.size());
+}
+
+auto bench::result::stddev() const -> double
+{
+	if (samples.size() < 2)
+	{
+		return 0.0;
+	}
+
+	const auto average = mean();
+	auto sum = 0.0;
+	for (const auto sample: samples)
+	{
+		sum += (sample - average) * (sample - average);
+	}
+	return std::sqrt(sum / static_cast<double>(samples.size() - 1));
+}
+
+void bench::to_json(nlohmann::json &j, const result &r)
+{
+	j = nlohmann::json{
+		{"name", r.name},
+		{"iterations", r.iterations},
+		{"samples", r.samples.size()},
+		{"min_ns", r.min()},
+		{"median_ns", r.median()},
+		{"mean_ns", r.mean()},
+		{"stddev_ns", r.stddev()},
+	};
+}
+
+bench::runner::runner(size_t sample_count, double min_sample_time)
+	: sample_count(std::max<size_t>(sample_count, 1)),
+	min_sample_time(min_sample_time)
+{
+}
+
+void bench::runner::add(const std::string &name, const setup &setup)
+{
+	benchmarks.emplace_back(name, setup);
+}
+
+auto bench::runner::names() const -> std::vector<std::string>
+{
+	std::vector<std::string> names;
+	names.reserve(benchmarks.size());
+
+	for (const auto &benchmark: benchmarks)
+	{
+		names.push_back(benchmark.first);
+	}
+	return names;
+}
+
+auto bench::runner::run(const std::string &filter,
+	const std::function<void(const result &)> &callback) const -> std::vector<result>
+{
+	std::vector<result> results;
+
+	for (const auto &benchmark: benchmarks)
+	{
+		if (!filter.empty() && benchmark.first.find(filter) == std::string::npos)
+		{
+			continue;
+		}
+
+		const auto operation = benchmark.second();
+
+		result result;
+		result.name = benchmark.first;
+		result.iterations = calibrate(operation);
+		result.samples.reserve(sample_count);
+
+		for (size_t i = 0; i < sample_count; i++)
+		{
+			const auto elapsed = measure(operation, result.iterations);
+			result.samples.push_back(elapsed / static_cast<double>(result.iterations));
+		}
+
+		if (callback)
+		{
+			callback(result);
+		}
+		results.push_back(result);
+	}
+
+	return results;
+}
+
+auto bench::runner::measure(const operation &operation, size_t iterations) -> double
+{
+	const auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < iterations; i++)
+	{
+		operation();
+	}
+	const auto end = std::chrono::steady_clock::now();
+
+	return std::chrono::duration<double, std::nano>(end - start).count();
+}
+
+auto bench::runner::calibrate(const operation &operation) const -> size_t
+{
+	const auto min_time = min_sample_time * 1000000.0;
+
+	// Also warms up caches and allocators before the first sample
+	size_t iterations = 1;
+	while (true)
+	{
+		const auto elapsed = measure(operation, iterations);
+		if (elapsed >= min_time)
+		{
+			return iterations;
+		}
+
+		// Aim a bit higher than needed, but at most 10x at once
+		const auto scale = elapsed > 0.0
+			? std::min(min_time * 1.2 / elapsed, 10.0)
+			: 10.0;
+		iterations = std::max(iterations + 1,
+			static_cast<size_t>(std::ceil(static_cast<double>(iterations) * scale)));
+	}
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "thirdparty/json.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+	/**
+	 * Make sure value is computed, without the compiler removing it as unused
+	 */
+	template<typename T>
+	void keep(const T &value)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		asm volatile("" : : "r"(&value) : "memory");
+#else
+		const volatile auto *data = reinterpret_cast<const volatile char *>(&value);
+		static_cast<void>(*data);
+#endif
+	}
+
+	/**
+	 * Code being measured, run many times
+	 */
+	using operation = std::function<void()>;
+
+	/**
+	 * Prepares input data outside of measurements, and returns what to measure
+	 */
+	using setup = std::function<operation()>;
+
+	/**
+	 * Measurements of a single benchmark
+	 */
+	class result
+	{
+	public:
+		std::string name;
+
+		/**
+		 * Operations run per sample
+		 */
+		size_t iterations = 0;
+
+		/**
+		 * Nanoseconds per operation, for each sample
+		 */
+		std::vector<double> samples;
+
+		auto min() const -> double;
+		auto median() const -> double;
+		auto mean() const -> double;
+		auto stddev() const -> double;
+	};
+
+	void to_json(nlohmann::json &j, const result &r);
+
+	/**
+	 * Runs benchmarks, with a fixed number of samples each,
+	 * and enough iterations per sample to not only measure the clock
+	 */
+	class runner
+	{
+	public:
+		/**
+		 * @param sample_count Samples for each benchmark
+		 * @param min_sample_time Shortest time of a single sample, in milliseconds
+		 */
+		runner(size_t sample_count, double min_sample_time);
+
+		/**
+		 * Add benchmark, set up only if it's run
+		 * @param name Unique name, as "area/what"
+		 */
+		void add(const std::string &name, const setup &setup);
+
+		/**
+		 * Names of all added benchmarks
+		 */
+		auto names() const -> std::vector<std::string>;
+
+		/**
+		 * Run all benchmarks with filter in its name
+		 * @param filter Text in name, or empty for all
+		 * @param callback Called after each benchmark
+		 */
+		auto run(const std::string &filter,
+			const std::function<void(const result &)> &callback) const -> std::vector<result>;
+
+	private:
+		size_t sample_count;
+		double min_sample_time;
+		std::vector<std::pair<std::string, setup>> benchmarks;
+
+		/**
+		 * Time of running operation iterations times, in nanoseconds
+		 */
+		static auto measure(const operation &operation, size_t iterations) -> double;
+
+		/**
+		 * Iterations needed for a sample to take at least the minimum time
+		 */
+		auto calibrate(const operation &operation) const -> size_t;
+	};
+
+	void add_api(runner &runner);
+	void add_base64(runner &runner);
+	void add_date_time(runner &runner);
+	void add_fuzzy(runner &runner);
+	void add_json(runner &runner);
+	void add_json_cache(runner &runner);
+	void add_log(runner &runner);
+	void add_lyrics(runner &runner);
+	void add_playlist(runner &runner);
+	void add_strings(runner &runner);
+	void add_track(runner &runner);
+}
@@ -0,0 +1,24 @@
+#include "benchmark.hpp"
+
+#include "lib/datetime.hpp"
+
+void bench::add_date_time(runner &runner)
+{
+	runner.add("date_time/parse", []() -> operation
+	{
+		return []()
+		{
+			const auto date = lib::date_time::parse("2021-06-15T12:34:56Z");
+			keep(date);
+		};
+	});
+
+	runner.add("date_time/parse_date", []() -> operation
+	{
+		return []()
+		{
+			const auto date = lib::date_time::parse("2021-06-15");
+			keep(date);
+		};
+	});
+}
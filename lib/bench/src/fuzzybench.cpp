@@ -0,0 +1,31 @@
+#include "benchmark.hpp"
+
+#include "fixture/library.hpp"
+
+#include "lib/fuzzy.hpp"
+#include "lib/strings.hpp"
+
+void bench::add_fuzzy(runner &runner)
+{
+	runner.add("fuzzy/filter", []() -> operation
+	{
+		// Name, artists and album of 100k tracks
+		std::vector<std::string> texts;
+		texts.reserve(100000);
+		for (size_t i = 0; i < 100000; i++)
+		{
+			texts.push_back(lib::strings::join({
+				fixture::library::word(i),
+				fixture::library::word(i / 7),
+				"artist " + std::to_string(i % 5000),
+				"album " + std::to_string(i % 10000),
+			}, "\n"));
+		}
+
+		return [texts]()
+		{
+			const auto matches = lib::fuzzy("sumer dreem").filter(texts);
+			keep(matches);
+		};
+	});
+}
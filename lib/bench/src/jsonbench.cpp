@@ -0,0 +1,26 @@
+#include "benchmark.hpp"
+
+#include "fixture/library.hpp"
+#include "lib/json.hpp"
+
+void bench::add_json(runner &runner)
+{
+	runner.add("json/combine", []() -> operation
+	{
+		// Two pages of tracks, as when loading all pages of a playlist
+		const fixture::library library{fixture::scale{}};
+		nlohmann::json first = nlohmann::json::array();
+		nlohmann::json second = nlohmann::json::array();
+		for (size_t i = 0; i < 100; i++)
+		{
+			first.push_back(library.track_json(i));
+			second.push_back(library.track_json(i + 100));
+		}
+
+		return [first, second]()
+		{
+			const auto combined = lib::json::combine(first, second);
+			keep(combined);
+		};
+	});
+}
@@ -0,0 +1,113 @@
+#include "benchmark.hpp"
+
+#include "fixture/library.hpp"
+#include "fixture/temppaths.hpp"
+#include "lib/cache/jsoncache.hpp"
+
+#include <memory>
+
+namespace
+{
+	/**
+	 * Large playlist, as saved and loaded on every refresh
+	 */
+	constexpr size_t track_count = 10000;
+
+	/**
+	 * Paths and a cache using them, starting out empty
+	 */
+	class cache_state
+	{
+	public:
+		cache_state()
+			: paths("cache-bench"),
+			cache(paths)
+		{
+		}
+
+		fixture::temp_paths paths;
+		lib::json_cache cache;
+	};
+
+	auto new_cache() -> std::shared_ptr<cache_state>
+	{
+		return std::make_shared<cache_state>();
+	}
+
+	/**
+	 * Library where the last playlist has track_count tracks
+	 */
+	auto new_library() -> fixture::library
+	{
+		fixture::scale scale;
+		scale.saved_tracks = track_count;
+		scale.playlist_tracks = track_count;
+		return fixture::library(scale);
+	}
+}
+
+void bench::add_json_cache(runner &runner)
+{
+	runner.add("json_cache/set_playlist", []() -> operation
+	{
+		const auto state = new_cache();
+		const auto playlist = new_library().playlist(track_count);
+
+		return [state, playlist]()
+		{
+			state->cache.set_playlist(playlist);
+		};
+	});
+
+	runner.add("json_cache/get_playlist", []() -> operation
+	{
+		const auto state = new_cache();
+		const auto playlist = new_library().playlist(track_count);
+		state->cache.set_playlist(playlist);
+
+		return [state, playlist]()
+		{
+			const auto loaded = state->cache.get_playlist(playlist.id);
+			keep(loaded);
+		};
+	});
+
+	runner.add("json_cache/set_tracks", []() -> operation
+	{
+		const auto state = new_cache();
+		const auto tracks = new_library().saved_tracks();
+
+		return [state, tracks]()
+		{
+			state->cache.set_tracks("liked_tracks", tracks);
+		};
+	});
+
+	runner.add("json_cache/get_tracks", []() -> operation
+	{
+		const auto state = new_cache();
+		state->cache.set_tracks("liked_tracks", new_library().saved_tracks());
+
+		return [state]()
+		{
+			const auto tracks = state->cache.get_tracks("liked_tracks");
+			keep(tracks);
+		};
+	});
+
+	runner.add("json_cache/load_library", []() -> operation
+	{
+		// 100 playlists, with up to 100 tracks each, and 1000 saved tracks
+		const auto state = new_cache();
+		fixture::library{fixture::scale{}}.populate(state->cache);
+
+		return [state]()
+		{
+			lib::json_cache cache(state->paths);
+			const auto playlists = cache.get_playlists();
+			const auto summaries = cache.get_playlist_summaries();
+			keep(playlists);
+			keep(summaries);
+		};
+	});
+}
@@ -0,0 +1,44 @@
+#include "benchmark.hpp"
+
+#include "lib/developermode.hpp"
+#include "lib/fmt.hpp"
+#include "lib/log.hpp"
+
+namespace
+{
+	auto message_json() -> nlohmann::json
+	{
+		return {
+			{"name", "track"},
+			{"artists", {"first", "second", "third"}},
+			{"duration_ms", 180000},
+		};
+	}
+}
+
+void bench::add_log(runner &runner)
+{
+	// Formatted, then ignored, as before checking level first
+	runner.add("log/format_ignored", []() -> operation
+	{
+		const auto json = message_json();
+
+		return [json]()
+		{
+			const auto message = lib::fmt::format("JSON {}: {}", 1, json);
+			keep(message);
+		};
+	});
+
+	runner.add("log/debug_disabled", []() -> operation
+	{
+		lib::log::set_log_to_stdout(false);
+		lib::developer_mode::enabled = false;
+		const auto json = message_json();
+
+		return [json]()
+		{
+			lib::log::debug("JSON {}: {}", 1, json);
+		};
+	});
+}
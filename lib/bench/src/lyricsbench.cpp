@@ -0,0 +1,20 @@
+#include "benchmark.hpp"
+
+#include "fixture/library.hpp"
+
+#include "lib/lyrics/lyrics.hpp"
+
+void bench::add_lyrics(runner &runner)
+{
+	runner.add("lyrics/from_json", []() -> operation
+	{
+		const nlohmann::json json = fixture::library::lrc(100);
+
+		return [json]()
+		{
+			lib::lrc::lyrics lyrics;
+			lib::lrc::from_json(json, lyrics);
+			keep(lyrics);
+		};
+	});
+}
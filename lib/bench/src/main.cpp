@@ -0,0 +1,153 @@
+#include "benchmark.hpp"
+
+#include "lib/datetime.hpp"
+#include "lib/fmt.hpp"
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+namespace
+{
+	void print_usage()
+	{
+		std::cout << "Usage: spotify-qt-lib-bench [options]\n"
+			<< "  --filter <text>   Only run benchmarks with text in name\n"
+			<< "  --json <file>     Save results as JSON, - for stdout\n"
+			<< "  --samples <n>     Samples per benchmark (default: 10)\n"
+			<< "  --min-time <ms>   Shortest time of a sample (default: 50)\n"
+			<< "  --list            List all benchmarks\n";
+	}
+
+	auto compiler() -> std::string
+	{
+#if defined(__clang__)
+		return "clang " __clang_version__;
+#elif defined(__GNUC__)
+		return "gcc " __VERSION__;
+#elif defined(_MSC_VER)
+		return lib::fmt::format("msvc {}", _MSC_VER);
+#else
+		return "unknown";
+#endif
+	}
+
+	auto build_type() -> std::string
+	{
+#ifdef NDEBUG
+		return "release";
+#else
+		return "debug";
+#endif
+	}
+
+	void print_result(const bench::result &result, std::ostream &stream)
+	{
+		stream << lib::fmt::format("{}: median {} ns, min {} ns, stddev {} ns, {} iterations",
+			result.name, static_cast<long long>(result.median()),
+			static_cast<long long>(result.min()), static_cast<long long>(result.stddev()),
+			result.iterations) << std::endl;
+	}
+}
+
+auto main(int argc, char *argv[]) -> int
+{
+	std::string filter;
+	std::string json_path;
+	size_t samples = 10;
+	double min_time = 50.0;
+	auto list = false;
+
+	for (auto i = 1; i < argc; i++)
+	{
+		const std::string arg = argv[i];
+		const auto has_value = i + 1 < argc;
+
+		if (arg == "--filter" && has_value)
+		{
+			filter = argv[++i];
+		}
+		else if (arg == "--json" && has_value)
+		{
+			json_path = argv[++i];
+		}
+		else if (arg == "--samples" && has_value)
+		{
+			samples = std::strtoul(argv[++i], nullptr, 10);
+		}
+		else if (arg == "--min-time" && has_value)
+		{
+			min_time = std::strtod(argv[++i], nullptr);
+		}
+		else if (arg == "--list")
+		{
+			list = true;
+		}
+		else
+		{
+			print_usage();
+			return arg == "--help" ? 0 : 1;
+		}
+	}
+
+	bench::runner runner(samples, min_time);
+	bench::add_api(runner);
+	bench::add_base64(runner);
+	bench::add_date_time(runner);
+	bench::add_fuzzy(runner);
+	bench::add_json(runner);
+	bench::add_json_cache(runner);
+	bench::add_log(runner);
+	bench::add_lyrics(runner);
+	bench::add_playlist(runner);
+	bench::add_strings(runner);
+	bench::add_track(runner);
+
+	if (list)
+	{
+		for (const auto &name: runner.names())
+		{
+			std::cout << name << std::endl;
+		}
+		return 0;
+	}
+
+	// Progress goes to stderr if results go to stdout
+	const auto to_stdout = json_path == "-";
+	const auto results = runner.run(filter, [to_stdout](const bench::result &result)
+	{
+		print_result(result, to_stdout ? std::cerr : std::cout);
+	});
+
+	if (json_path.empty())
+	{
+		return 0;
+	}
+
+	const nlohmann::json json{
+		{"context", {
+			{"version", LIB_VERSION},
+			{"date", lib::date_time::now_utc().to_iso_date_time()},
+			{"compiler", compiler()},
+			{"build_type", build_type()},
+			{"samples", samples},
+			{"min_time_ms", min_time},
+		}},
+		{"benchmarks", results},
+	};
+
+	if (to_stdout)
+	{
+		std::cout << json.dump(4) << std::endl;
+		return 0;
+	}
+
+	std::ofstream file(json_path);
+	if (!file.is_open())
+	{
+		std::cerr << "Failed to save results to " << json_path << std::endl;
+		return 1;
+	}
+	file << json.dump(4) << std::endl;
+	return 0;
+}
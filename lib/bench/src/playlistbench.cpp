@@ -0,0 +1,43 @@
+#include "benchmark.hpp"
+
+#include "fixture/library.hpp"
+
+namespace
+{
+	constexpr size_t track_count = 1000;
+
+	/**
+	 * Library where the last playlist has track_count tracks
+	 */
+	auto new_library() -> fixture::library
+	{
+		fixture::scale scale;
+		scale.playlist_tracks = track_count;
+		return fixture::library(scale);
+	}
+}
+
+void bench::add_playlist(runner &runner)
+{
+	runner.add("playlist/from_json", []() -> operation
+	{
+		const auto json = new_library().playlist_json(track_count, true);
+
+		return [json]()
+		{
+			const auto playlist = json.get<lib::spt::playlist>();
+			keep(playlist);
+		};
+	});
+
+	runner.add("playlist/from_cache", []() -> operation
+	{
+		const nlohmann::json json = new_library().playlist(track_count);
+
+		return [json]()
+		{
+			const auto playlist = json.get<lib::spt::playlist>();
+			keep(playlist);
+		};
+	});
+}
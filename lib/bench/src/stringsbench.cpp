@@ -0,0 +1,58 @@
+#include "benchmark.hpp"
+
+#include "fixture/library.hpp"
+
+#include "lib/strings.hpp"
+
+namespace
+{
+	constexpr size_t word_count = 1000;
+
+	auto words() -> std::vector<std::string>
+	{
+		std::vector<std::string> words;
+		words.reserve(word_count);
+
+		for (size_t i = 0; i < word_count; i++)
+		{
+			words.push_back(fixture::library::word(i));
+		}
+		return words;
+	}
+}
+
+void bench::add_strings(runner &runner)
+{
+	runner.add("strings/split", []() -> operation
+	{
+		const auto text = lib::strings::join(words(), " ");
+
+		return [text]()
+		{
+			const auto split = lib::strings::split(text, ' ');
+			keep(split);
+		};
+	});
+
+	runner.add("strings/join", []() -> operation
+	{
+		const auto items = words();
+
+		return [items]()
+		{
+			const auto text = lib::strings::join(items, ", ");
+			keep(text);
+		};
+	});
+
+	runner.add("strings/to_lower", []() -> operation
+	{
+		const auto text = lib::strings::to_upper(lib::strings::join(words(), " "));
+
+		return [text]()
+		{
+			const auto lower = lib::strings::to_lower(text);
+			keep(lower);
+		};
+	});
+}
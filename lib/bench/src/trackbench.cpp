@@ -0,0 +1,54 @@
+#include "benchmark.hpp"
+
+#include "fixture/library.hpp"
+
+namespace
+{
+	/**
+	 * Tracks in a single benchmark operation
+	 */
+	constexpr size_t track_count = 1000;
+}
+
+void bench::add_track(runner &runner)
+{
+	runner.add("track/from_json", []() -> operation
+	{
+		const fixture::library library{fixture::scale{}};
+		nlohmann::json items = nlohmann::json::array();
+		for (size_t i = 0; i < track_count; i++)
+		{
+			items.push_back(library.track_json(i));
+		}
+
+		return [items]()
+		{
+			const auto tracks = items.get<std::vector<lib::spt::track>>();
+			keep(tracks);
+		};
+	});
+
+	runner.add("track/from_cache", []() -> operation
+	{
+		const fixture::library library{fixture::scale{}};
+		const nlohmann::json items = library.tracks(0, track_count);
+
+		return [items]()
+		{
+			const auto tracks = items.get<std::vector<lib::spt::track>>();
+			keep(tracks);
+		};
+	});
+
+	runner.add("track/to_json", []() -> operation
+	{
+		const fixture::library library{fixture::scale{}};
+		const auto tracks = library.tracks(0, track_count);
+
+		return [tracks]()
+		{
+			const nlohmann::json json = tracks;
+			keep(json);
+		};
+	});
+}
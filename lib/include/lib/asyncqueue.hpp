@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <functional>
+
+namespace lib
+{
+	/**
+	 * Queue of asynchronous jobs, with a limit on how many can run at the same time
+	 * @note Not thread safe, jobs are expected to finish on the same thread they started on
+	 */
+	class async_queue
+	{
+	public:
+		/**
+		 * Called by a job when finished, calling it more than once has no effect
+		 */
+		using done = std::function<void()>;
+
+		/**
+		 * Job to run, that calls done when finished
+		 */
+		using job = std::function<void(const done &)>;
+
+		/**
+		 * Construct a new empty queue
+		 * @param max_running Max number of jobs running at the same time
+		 */
+		explicit async_queue(size_t max_running);
+
+		/**
+		 * Add a job, starting it immediately if below limit
+		 */
+		void add(const job &job);
+
+		/**
+		 * Remove all jobs not yet started
+		 */
+		void clear();
+
+		/**
+		 * Number of jobs waiting to be started
+		 */
+		auto pending() const -> size_t;
+
+		/**
+		 * Number of jobs started, but not yet finished
+		 */
+		auto running() const -> size_t;
+
+	private:
+		size_t max_running;
+		size_t running_count = 0;
+		std::deque<job> jobs;
+
+		/**
+		 * Start jobs until limit is reached
+		 */
+		void start_next();
+	};
+}
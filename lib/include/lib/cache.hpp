@@ -4,8 +4,11 @@
 #include "lib/log.hpp"
 #include "lib/spotify/track.hpp"
 #include "lib/spotify/playlist.hpp"
+#include "lib/spotify/playlistsummary.hpp"
 #include "lib/spotify/album.hpp"
 #include "lib/spotify/trackinfo.hpp"
+#include "lib/spotify/searchresults.hpp"
+#include "lib/spotify/artistsummary.hpp"
 #include "lib/crash/crashinfo.hpp"
 
 namespace lib
@@ -21,6 +24,8 @@ namespace lib
 		 */
 		cache() = default;
 
+		virtual ~cache() = default;
+
 		//region album
 
 		/**
@@ -91,6 +96,21 @@ namespace lib
 		 */
 		virtual void set_playlist(const spt::playlist &playlist) = 0;
 
+		/**
+		 * Get summary of a cached playlist, without loading it
+		 * @param playlist_id Playlist ID
+		 * @return Summary, or null summary if not cached
+		 */
+		virtual auto get_playlist_summary(const std::string &playlist_id) const
+		-> lib::spt::playlist_summary = 0;
+
+		/**
+		 * Get summaries of all cached playlists
+		 * @return Map as id: summary
+		 */
+		virtual auto get_playlist_summaries() const
+		-> std::map<std::string, lib::spt::playlist_summary> = 0;
+
 		//endregion
 
 		//region tracks
@@ -118,6 +138,38 @@ namespace lib
 
 		//endregion
 
+		//region search
+
+		/**
+		 * Search in all cached tracks, albums and artists
+		 * @param query Words to search for
+		 * @return Tracks, albums and artists, best match first
+		 * @note Can be called from any thread
+		 */
+		virtual auto search(const std::string &query) const -> lib::spt::search_results = 0;
+
+		//endregion
+
+		//region artists
+
+		/**
+		 * Get summary of an artist in all cached playlists and library lists
+		 * @param artist_name Artist name
+		 * @return Summary, or null summary if artist isn't in anything cached
+		 */
+		virtual auto get_artist_summary(const std::string &artist_name) const
+		-> lib::spt::artist_summary = 0;
+
+		/**
+		 * Get most listened to artists in all cached playlists and library lists
+		 * @param limit Max number of artists
+		 * @return Artists, highest score first
+		 */
+		virtual auto get_top_artists(size_t limit) const
+		-> std::vector<lib::spt::artist_summary> = 0;
+
+		//endregion
+
 		//region lyrics
 
 		/**
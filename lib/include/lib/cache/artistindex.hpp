@@ -0,0 +1,121 @@
+#pragma once
+
+#include "lib/spotify/artistsummary.hpp"
+#include "lib/spotify/track.hpp"
+
+#include "thirdparty/json.hpp"
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace lib
+{
+	/**
+	 * Index of all artists in cached playlists and library lists
+	 * @note Only artists in each source are saved as JSON, totals are summed when loaded
+	 */
+	class artist_index
+	{
+	public:
+		artist_index() = default;
+
+		/**
+		 * Replace all tracks from a source
+		 * @param source_id ID of source, for example playlist
+		 * @param tracks Tracks in source
+		 */
+		void set_tracks(const std::string &source_id,
+			const std::vector<lib::spt::track> &tracks);
+
+		/**
+		 * Replace all tracks from multiple sources
+		 * @param tracks Map as source id: tracks
+		 */
+		void set_tracks(const std::map<std::string, std::vector<lib::spt::track>> &tracks);
+
+		/**
+		 * Remove all tracks from a source
+		 * @param source_id ID of source
+		 */
+		void remove(const std::string &source_id);
+
+		/**
+		 * Get summary of an artist
+		 * @param name Artist name
+		 * @return Summary, or null summary if not in any source
+		 */
+		auto get(const std::string &name) const -> lib::spt::artist_summary;
+
+		/**
+		 * Artist is in any source
+		 * @param name Artist name
+		 */
+		auto contains(const std::string &name) const -> bool;
+
+		/**
+		 * Artists with highest score
+		 * @param limit Max number of artists
+		 */
+		auto top(size_t limit) const -> std::vector<lib::spt::artist_summary>;
+
+		/**
+		 * No sources have been added
+		 */
+		auto is_empty() const -> bool;
+
+		/**
+		 * IDs of all sources in index
+		 */
+		auto source_ids() const -> std::vector<std::string>;
+
+		friend void to_json(nlohmann::json &j, const artist_index &index);
+		friend void from_json(const nlohmann::json &j, artist_index &index);
+
+	private:
+		using source = std::unordered_map<std::string, lib::spt::artist_summary>;
+
+		/**
+		 * Artists in each source, by name
+		 */
+		std::unordered_map<std::string, source> sources;
+
+		/**
+		 * All artists, by name
+		 */
+		std::unordered_map<std::string, lib::spt::artist_summary> artists;
+
+		/**
+		 * Replace source
+		 */
+		void set_source(const std::string &source_id,
+			const std::vector<lib::spt::track> &tracks);
+
+		/**
+		 * Remove source
+		 * @return Source was found and removed
+		 */
+		auto remove_source(const std::string &source_id) -> bool;
+
+		/**
+		 * Add or subtract source from artists
+		 */
+		void apply(const source &artists_in_source, bool add);
+
+		/**
+		 * Find most recently added track of artist from all sources
+		 */
+		auto last_added(const std::string &name) const -> std::string;
+	};
+
+	/**
+	 * Artist index -> JSON
+	 */
+	void to_json(nlohmann::json &j, const artist_index &index);
+
+	/**
+	 * JSON -> Artist index
+	 */
+	void from_json(const nlohmann::json &j, artist_index &index);
+}
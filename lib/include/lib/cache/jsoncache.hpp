@@ -3,9 +3,14 @@
 #include "lib/cache.hpp"
 #include "lib/json.hpp"
 #include "lib/paths/paths.hpp"
+#include "lib/cache/searchindex.hpp"
+#include "lib/cache/artistindex.hpp"
 #include "thirdparty/filesystem.hpp"
 #include "thirdparty/json.hpp"
 
+#include <functional>
+#include <mutex>
+
 namespace lib
 {
 	/**
@@ -20,6 +25,11 @@ namespace lib
 		 */
 		explicit json_cache(const paths &paths);
 
+		/**
+		 * Saves indices and playlist summaries, if changed
+		 */
+		~json_cache() override;
+
 		auto get_album_image(const std::string &url) const -> std::vector<unsigned char> override;
 		auto get_album_image_path(const std::string &url) const -> std::string override;
 		void set_album_image(const std::string &url,
@@ -33,12 +43,23 @@ namespace lib
 
 		auto get_playlist(const std::string &playlist_id) const -> lib::spt::playlist override;
 		void set_playlist(const spt::playlist &playlist) override;
+		auto get_playlist_summary(const std::string &playlist_id) const
+		-> lib::spt::playlist_summary override;
+		auto get_playlist_summaries() const
+		-> std::map<std::string, lib::spt::playlist_summary> override;
 
 		auto get_tracks(const std::string &entity_id) const -> std::vector<lib::spt::track> override;
 		void set_tracks(const std::string &entity_id,
 			const std::vector<lib::spt::track> &tracks) override;
 		auto all_tracks() const -> std::map<std::string, std::vector<lib::spt::track>> override;
 
+		auto search(const std::string &query) const -> lib::spt::search_results override;
+
+		auto get_artist_summary(const std::string &artist_name) const
+		-> lib::spt::artist_summary override;
+		auto get_top_artists(size_t limit) const
+		-> std::vector<lib::spt::artist_summary> override;
+
 		auto get_track_info(const lib::spt::track &track) const -> lib::spt::track_info override;
 		void set_track_info(const lib::spt::track &track,
 			const lib::spt::track_info &track_info) override;
@@ -47,8 +68,113 @@ namespace lib
 		auto get_all_crashes() const -> std::vector<lib::crash_info> override;
 
 	private:
+		/**
+		 * Max number of search results of each type
+		 */
+		static constexpr size_t search_limit = 50;
+
 		const lib::paths &paths;
 
+		/**
+		 * Index of all cached tracks, loaded when first searched
+		 */
+		mutable lib::search_index index;
+		mutable bool index_loaded = false;
+
+		/**
+		 * Index has changed since loaded or saved
+		 */
+		mutable bool index_changed = false;
+
+		/**
+		 * Guards search index, as searching may be done in the background
+		 */
+		mutable std::mutex index_mutex;
+
+		/**
+		 * Artists in all cached playlists and library lists, loaded when first used
+		 */
+		mutable lib::artist_index artists;
+		mutable bool artists_loaded = false;
+
+		/**
+		 * Artist index has changed since loaded or saved
+		 */
+		mutable bool artists_changed = false;
+
+		/**
+		 * Guards artist index, separately to not wait for searches
+		 */
+		mutable std::mutex artists_mutex;
+
+		/**
+		 * Load saved search index, and update it with everything cached since saved
+		 * @note Requires index_mutex to be locked
+		 */
+		void load_index() const;
+
+		/**
+		 * Save search index, if changed
+		 */
+		void save_index();
+
+		/**
+		 * Load saved artist index, and update it with everything cached since saved
+		 * @note Requires artists_mutex to be locked
+		 */
+		void load_artists() const;
+
+		/**
+		 * Save artist index, if changed
+		 */
+		void save_artists();
+
+		/**
+		 * Time file was last modified, or earliest possible time if it doesn't exist
+		 */
+		static auto modified_time(const ghc::filesystem::path &path)
+		-> ghc::filesystem::file_time_type;
+
+		/**
+		 * Set tracks from all cached playlists and tracks modified since a time
+		 * @param since Only include files modified at or after this time
+		 * @param source_ids Sources already added, removed if no longer cached
+		 * @param set Add, or replace, tracks of source
+		 * @param remove Remove source
+		 * @return Any source was set or removed
+		 */
+		auto update_sources(ghc::filesystem::file_time_type since,
+			const std::vector<std::string> &source_ids,
+			const std::function<void(const std::string &,
+				const std::vector<lib::spt::track> &)> &set,
+			const std::function<void(const std::string &)> &remove) const -> bool;
+
+		/**
+		 * Tracks are from a library list counted in artist index
+		 */
+		static auto is_artist_source(const std::string &entity_id) -> bool;
+
+		/**
+		 * Summaries of all cached playlists, loaded when first used
+		 */
+		mutable std::map<std::string, lib::spt::playlist_summary> summaries;
+		mutable bool summaries_loaded = false;
+
+		/**
+		 * Summaries have changed since last saved
+		 */
+		mutable bool summaries_changed = false;
+
+		/**
+		 * Load summaries from disk, and create them from playlists cached since saved
+		 */
+		void load_summaries() const;
+
+		/**
+		 * Save summaries, if changed since last saved
+		 */
+		void save_summaries();
+
 		/**
 		 * Get parent directory for cache type
 		 */
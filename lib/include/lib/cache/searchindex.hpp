@@ -0,0 +1,286 @@
+#pragma once
+
+#include "lib/fuzzy.hpp"
+#include "lib/spotify/track.hpp"
+#include "lib/spotify/searchresults.hpp"
+#include "lib/vector.hpp"
+
+#include "thirdparty/json.hpp"
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace lib
+{
+	/**
+	 * Inverted index of tokens and trigrams for all cached tracks,
+	 * with tracks grouped by source (playlist, album, etc.)
+	 * @note Only tracks and sources are saved as JSON, everything else is rebuilt when loaded
+	 */
+	class search_index
+	{
+	public:
+		search_index() = default;
+
+		/**
+		 * Replace all tracks from a source
+		 * @param source_id ID of source, for example playlist or album
+		 * @param tracks Tracks in source
+		 */
+		void set_tracks(const std::string &source_id,
+			const std::vector<lib::spt::track> &tracks);
+
+		/**
+		 * Remove all tracks from a source
+		 * @param source_id ID of source
+		 */
+		void remove(const std::string &source_id);
+
+		/**
+		 * Search for tracks, albums and artists, where all words in query are found,
+		 * or if nothing is found, where all words are found allowing typos
+		 * @param query Query, case and diacritics are ignored
+		 * @param limit Max number of results of each type
+		 * @return Results with best match first
+		 */
+		auto search(const std::string &query, size_t limit) -> lib::spt::search_results;
+
+		/**
+		 * Nothing has been added to the index yet
+		 */
+		auto is_empty() const -> bool;
+
+		/**
+		 * Number of unique tracks in index
+		 */
+		auto size() const -> size_t;
+
+		/**
+		 * IDs of all sources in index
+		 */
+		auto source_ids() const -> std::vector<std::string>;
+
+		friend void to_json(nlohmann::json &j, const search_index &index);
+		friend void from_json(const nlohmann::json &j, search_index &index);
+
+	private:
+		/**
+		 * A unique track, or album or artist, in the index
+		 */
+		class entry
+		{
+		public:
+			/**
+			 * Number of sources referencing this entry
+			 */
+			size_t refs = 0;
+
+			/**
+			 * Normalized name
+			 */
+			std::string name;
+		};
+
+		/**
+		 * A unique track in the index
+		 */
+		class track_entry: public entry
+		{
+		public:
+			lib::spt::track track;
+
+			/**
+			 * Normalized artist names, separated by newlines
+			 */
+			std::string artists;
+
+			/**
+			 * Normalized album name
+			 */
+			std::string album;
+		};
+
+		/**
+		 * A unique album in the index
+		 */
+		class album_entry: public entry
+		{
+		public:
+			lib::spt::album album;
+		};
+
+		/**
+		 * A unique artist in the index
+		 */
+		class artist_entry: public entry
+		{
+		public:
+			lib::spt::artist artist;
+		};
+
+		/**
+		 * Minimum number of removed entries before index is compacted
+		 */
+		static constexpr size_t min_compact_count = 1024;
+
+		/**
+		 * Trigram length
+		 */
+		static constexpr size_t gram_size = 3;
+
+		std::vector<track_entry> tracks;
+		std::vector<std::string> keys;
+		std::unordered_map<std::string, size_t> track_ids;
+		std::unordered_map<std::string, std::vector<size_t>> sources;
+		std::map<std::string, std::vector<size_t>> tokens;
+		std::unordered_map<std::string, std::vector<size_t>> trigrams;
+		size_t removed_count = 0;
+
+		std::unordered_map<std::string, album_entry> albums;
+		std::unordered_map<std::string, artist_entry> artists;
+
+		/**
+		 * Add source to index
+		 */
+		void add_source(const std::string &source_id,
+			const std::vector<lib::spt::track> &source_tracks);
+
+		/**
+		 * Remove source from index
+		 */
+		void remove_source(const std::string &source_id);
+
+		/**
+		 * Add track, or increase references to an existing one
+		 * @return Index of entry
+		 */
+		auto add_track(const lib::spt::track &track) -> size_t;
+
+		/**
+		 * Add track to token and trigram postings
+		 */
+		void add_postings(size_t index);
+
+		/**
+		 * Rebuild index without removed tracks
+		 */
+		void compact();
+
+		/**
+		 * Tracks that may match word
+		 * @return Sorted indices of tracks
+		 */
+		auto candidates(const std::string &word) const -> std::vector<size_t>;
+
+		/**
+		 * Character is part of a word, non-ASCII is always assumed to be
+		 */
+		static auto is_word_char(char chr) -> bool;
+
+		/**
+		 * Split normalized string into words
+		 */
+		static auto split_words(const std::string &str) -> std::vector<std::string>;
+
+		/**
+		 * How well word matches string, higher is better, or 0 if no match
+		 */
+		static auto match_score(const std::string &str, const std::string &word) -> int;
+
+		/**
+		 * Score for matching all words in an entry, or 0 if not all words match
+		 */
+		static auto entry_score(const std::vector<std::string> &words,
+			const std::vector<std::pair<const std::string *, int>> &fields) -> int;
+
+		/**
+		 * Add or remove a reference to a track's album and artists
+		 */
+		void update_entities(const lib::spt::track &track, bool add);
+
+		/**
+		 * Find best matching entities
+		 */
+		template<typename Entry, typename T>
+		static auto search_entities(const std::unordered_map<std::string, Entry> &entries,
+			const std::vector<std::string> &words, const lib::fuzzy &matcher,
+			size_t limit, T Entry::*value) -> std::vector<T>
+		{
+			std::vector<std::pair<int, const Entry *>> matches;
+			for (const auto &entry: entries)
+			{
+				if (entry.second.refs == 0)
+				{
+					continue;
+				}
+
+				const auto score = entry_score(words, {
+					{&entry.second.name, 1},
+				});
+
+				if (score > 0)
+				{
+					matches.emplace_back(score, &entry.second);
+				}
+			}
+
+			if (matches.empty())
+			{
+				for (const auto &entry: entries)
+				{
+					const auto score = entry.second.refs == 0
+						? 0
+						: matcher.score(entry.second.name);
+
+					if (score > 0)
+					{
+						matches.emplace_back(score, &entry.second);
+					}
+				}
+			}
+
+			sort_matches(matches);
+
+			std::vector<T> results;
+			for (size_t i = 0; i < matches.size() && i < limit; i++)
+			{
+				results.push_back(matches[i].second->*value);
+			}
+			return results;
+		}
+
+		/**
+		 * Sort by score, then references, then name
+		 */
+		template<typename Entry>
+		static void sort_matches(std::vector<std::pair<int, const Entry *>> &matches)
+		{
+			std::sort(matches.begin(), matches.end(),
+				[](const std::pair<int, const Entry *> &match1,
+					const std::pair<int, const Entry *> &match2) -> bool
+				{
+					if (match1.first != match2.first)
+					{
+						return match1.first > match2.first;
+					}
+					if (match1.second->refs != match2.second->refs)
+					{
+						return match1.second->refs > match2.second->refs;
+					}
+					return match1.second->name < match2.second->name;
+				});
+		}
+	};
+
+	/**
+	 * Search index -> JSON
+	 */
+	void to_json(nlohmann::json &j, const search_index &index);
+
+	/**
+	 * JSON -> Search index
+	 */
+	void from_json(const nlohmann::json &j, search_index &index);
+}
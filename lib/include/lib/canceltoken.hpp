@@ -0,0 +1,108 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+
+namespace lib
+{
+	/**
+	 * Tells if the owner of a request has gone away, see cancel_scope
+	 * @note Only is_cancelled is thread safe,
+	 * otherwise expected to be used on the same thread as requests
+	 */
+	class cancel_token
+	{
+	public:
+		/**
+		 * Token that is never cancelled
+		 */
+		cancel_token() = default;
+
+		/**
+		 * Owner has gone away, and responses should be ignored,
+		 * can be checked from background tasks
+		 */
+		auto is_cancelled() const -> bool;
+
+		/**
+		 * Call function when cancelled, or immediately if already cancelled
+		 * @return Id to remove function with, or 0 if never called later
+		 */
+		auto on_cancel(const std::function<void()> &callback) const -> size_t;
+
+		/**
+		 * Remove function added with on_cancel, for example when request finished
+		 */
+		void remove(size_t id) const;
+
+		/**
+		 * Token of innermost cancel_context, or a token never cancelled if none
+		 */
+		static auto current() -> cancel_token;
+
+	private:
+		friend class cancel_scope;
+		friend class cancel_context;
+
+		class state
+		{
+		public:
+			std::atomic<bool> cancelled{false};
+			size_t next_id = 1;
+			std::map<size_t, std::function<void()>> callbacks;
+		};
+
+		std::shared_ptr<state> shared;
+
+		explicit cancel_token(const std::shared_ptr<state> &shared);
+
+		static thread_local cancel_token active;
+	};
+
+	/**
+	 * Owns a cancel token, cancelling it when destroyed,
+	 * usually a member of the widget requests are made for
+	 */
+	class cancel_scope
+	{
+	public:
+		cancel_scope();
+		~cancel_scope();
+
+		cancel_scope(const cancel_scope &) = delete;
+		auto operator=(const cancel_scope &) -> cancel_scope & = delete;
+
+		/**
+		 * Token cancelled with this scope
+		 */
+		auto token() const -> cancel_token;
+
+		/**
+		 * Cancel token, calling all functions waiting for it
+		 */
+		void cancel();
+
+	private:
+		std::shared_ptr<cancel_token::state> shared;
+	};
+
+	/**
+	 * Sets current token while in scope, used by HTTP clients for all requests started,
+	 * and restored when calling back, so requests started from callbacks also use it
+	 */
+	class cancel_context
+	{
+	public:
+		explicit cancel_context(const cancel_token &token);
+		~cancel_context();
+
+		cancel_context(const cancel_context &) = delete;
+		auto operator=(const cancel_context &) -> cancel_context & = delete;
+
+	private:
+		cancel_token previous;
+	};
+}
@@ -34,6 +34,11 @@ namespace lib
 		 */
 		date_time(const date_time &date);
 
+		/**
+		 * Copy another date
+		 */
+		auto operator=(const date_time &date) -> date_time &;
+
 		/**
 		 * Try to parse a date from a string
 		 * @param value ISO date
@@ -58,6 +63,13 @@ namespace lib
 		 */
 		static auto seconds_since_epoch() -> unsigned long;
 
+		/**
+		 * ISO date is later than another, without parsing either
+		 * @param iso_date1 Date to check, may be empty
+		 * @param iso_date2 Date to compare to, empty dates are earlier than any date
+		 */
+		static auto is_later(const std::string &iso_date1, const std::string &iso_date2) -> bool;
+
 		/**
 		 * If the current instance represents a valid date
 		 * @return Date is valid
@@ -0,0 +1,154 @@
+#pragma once
+
+#include "lib/future.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace lib
+{
+	/**
+	 * Pool of worker threads, where each worker has its own queue,
+	 * and idle workers steal tasks from other workers
+	 */
+	class executor
+	{
+	public:
+		using task = std::function<void()>;
+
+		/**
+		 * Start workers
+		 * @param thread_count Number of workers, at least 1
+		 */
+		explicit executor(size_t thread_count);
+
+		/**
+		 * Finish all posted tasks, and stop workers
+		 */
+		~executor();
+
+		executor(const executor &) = delete;
+		auto operator=(const executor &) -> executor & = delete;
+
+		/**
+		 * Executor shared by the entire application, with one worker per core
+		 */
+		static auto shared() -> executor &;
+
+		/**
+		 * Run task on any worker
+		 */
+		void post(const task &task);
+
+		/**
+		 * Run a task if any is waiting, on the calling thread,
+		 * to help out instead of blocking while waiting for tasks to finish
+		 * @return A task was run
+		 */
+		auto try_run_one() -> bool;
+
+		/**
+		 * Number of workers
+		 */
+		auto thread_count() const -> size_t;
+
+		/**
+		 * Run function on a worker, and resolve future with its result on the main thread,
+		 * or reject it with the message of any exception thrown
+		 */
+		template<typename T>
+		auto async(const std::function<T()> &func) -> lib::future<T>
+		{
+			lib::promise<T> promise;
+			post([promise, func]()
+			{
+				try
+				{
+					const auto value = func();
+					dispatch([promise, value]()
+					{
+						promise.resolve(value);
+					});
+				}
+				catch (const std::exception &e)
+				{
+					const std::string error = e.what();
+					dispatch([promise, error]()
+					{
+						promise.reject(error);
+					});
+				}
+			});
+			return promise.get_future();
+		}
+
+		/**
+		 * Set how to run tasks on the main thread, for example with the event loop
+		 * @param dispatcher Function to call from any thread, or empty to remove
+		 */
+		static void set_dispatcher(const std::function<void(const task &)> &dispatcher);
+
+		/**
+		 * Run task on the main thread, or on the calling thread if no dispatcher is set
+		 */
+		static void dispatch(const task &task);
+
+	private:
+		/**
+		 * Tasks of a single worker, taken from the back by the owner,
+		 * and stolen from the front by others
+		 */
+		class worker_queue
+		{
+		public:
+			std::mutex mutex;
+			std::deque<task> tasks;
+		};
+
+		std::vector<std::unique_ptr<worker_queue>> queues;
+		std::vector<std::thread> threads;
+
+		/**
+		 * Queue to post to from threads outside the executor
+		 */
+		std::atomic<size_t> next_queue;
+
+		/**
+		 * Tasks posted, but not yet taken
+		 */
+		std::atomic<size_t> pending;
+
+		std::mutex wake_mutex;
+		std::condition_variable wake;
+		bool stopping = false;
+
+		/**
+		 * Index of the current worker in this executor, or queue count if not a worker
+		 */
+		auto current_queue() const -> size_t;
+
+		/**
+		 * Take task from own queue, or steal one from other queues
+		 * @param index Queue to check first
+		 */
+		auto take(size_t index, task &task) -> bool;
+
+		void run(size_t index);
+
+		/**
+		 * Run task, logging any exception thrown, as it would otherwise stop the application
+		 */
+		static void run_task(const task &task);
+
+		static std::mutex dispatcher_mutex;
+		static std::function<void(const task &)> dispatcher;
+	};
+}
@@ -0,0 +1,356 @@
+#pragma once
+
+#include "lib/canceltoken.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lib
+{
+	template<typename T>
+	class promise;
+
+	/**
+	 * Value available later, as an alternative to nesting callbacks
+	 * @note Not thread safe, continuations are called on the thread resolving the promise,
+	 * which for requests is the main thread
+	 */
+	template<typename T>
+	class future
+	{
+	public:
+		using value_type = T;
+
+		/**
+		 * Future that is never resolved
+		 */
+		future()
+			: shared(std::make_shared<state>())
+		{
+		}
+
+		/**
+		 * Future already resolved with value
+		 */
+		static auto ready(const T &value) -> future<T>
+		{
+			lib::promise<T> promise;
+			promise.resolve(value);
+			return promise.get_future();
+		}
+
+		/**
+		 * Value is available
+		 */
+		auto is_ready() const -> bool
+		{
+			return shared->value != nullptr;
+		}
+
+		/**
+		 * Failed to get value, see promise::reject
+		 */
+		auto is_failed() const -> bool
+		{
+			return shared->failed;
+		}
+
+		/**
+		 * Get value, throws if not yet available
+		 */
+		auto value() const -> const T &
+		{
+			if (!is_ready())
+			{
+				throw std::runtime_error("future not ready");
+			}
+			return *shared->value;
+		}
+
+		/**
+		 * Call function with value when available, or immediately if already available,
+		 * never called if cancelled
+		 */
+		void then(const std::function<void(const T &)> &callback) const
+		{
+			if (shared->token.is_cancelled())
+			{
+				return;
+			}
+
+			if (!is_ready())
+			{
+				shared->callbacks.push_back(callback);
+				return;
+			}
+
+			lib::cancel_context context(shared->token);
+			callback(*shared->value);
+		}
+
+		/**
+		 * Call function with error message if failed, or immediately if already failed,
+		 * never called if cancelled
+		 */
+		void fail(const std::function<void(const std::string &)> &callback) const
+		{
+			if (shared->token.is_cancelled())
+			{
+				return;
+			}
+
+			if (!shared->failed)
+			{
+				if (!is_ready())
+				{
+					shared->failure_callbacks.push_back(callback);
+				}
+				return;
+			}
+
+			lib::cancel_context context(shared->token);
+			callback(shared->error);
+		}
+
+		/**
+		 * Future of value converted with function, failing if this future fails
+		 */
+		template<typename F>
+		auto map(F func) const -> future<typename std::decay<decltype(func(std::declval<const T &>()))>::type>
+		{
+			using U = typename std::decay<decltype(func(std::declval<const T &>()))>::type;
+
+			lib::promise<U> mapped;
+			then([mapped, func](const T &value)
+			{
+				mapped.resolve(func(value));
+			});
+			fail(mapped.rejecter());
+			return mapped.get_future();
+		}
+
+		/**
+		 * Future of future returned by function, to chain dependent requests
+		 */
+		template<typename F>
+		auto and_then(F func) const -> decltype(func(std::declval<const T &>()))
+		{
+			using U = typename decltype(func(std::declval<const T &>()))::value_type;
+
+			lib::promise<U> chained;
+			then([chained, func](const T &value)
+			{
+				const auto next = func(value);
+				next.then(chained.resolver());
+				next.fail(chained.rejecter());
+			});
+			fail(chained.rejecter());
+			return chained.get_future();
+		}
+
+	private:
+		friend class lib::promise<T>;
+
+		class state
+		{
+		public:
+			/**
+			 * Context when created, continuations are skipped once cancelled
+			 */
+			lib::cancel_token token = lib::cancel_token::current();
+
+			std::unique_ptr<T> value;
+			std::vector<std::function<void(const T &)>> callbacks;
+
+			bool failed = false;
+			std::string error;
+			std::vector<std::function<void(const std::string &)>> failure_callbacks;
+		};
+
+		std::shared_ptr<state> shared;
+
+		explicit future(const std::shared_ptr<state> &shared)
+			: shared(shared)
+		{
+		}
+	};
+
+	/**
+	 * Resolves a future
+	 */
+	template<typename T>
+	class promise
+	{
+	public:
+		promise()
+			: shared(std::make_shared<typename future<T>::state>())
+		{
+		}
+
+		/**
+		 * Set value, and call all waiting continuations,
+		 * only the first value, or failure, is used
+		 */
+		void resolve(const T &value) const
+		{
+			if (shared->value || shared->failed)
+			{
+				return;
+			}
+			shared->value = std::unique_ptr<T>(new T(value));
+			shared->failure_callbacks.clear();
+
+			std::vector<std::function<void(const T &)>> callbacks;
+			callbacks.swap(shared->callbacks);
+
+			if (shared->token.is_cancelled())
+			{
+				return;
+			}
+
+			lib::cancel_context context(shared->token);
+			for (const auto &callback: callbacks)
+			{
+				callback(*shared->value);
+			}
+		}
+
+		/**
+		 * Fail without a value, and call all waiting failure continuations
+		 * @param error Error message
+		 */
+		void reject(const std::string &error) const
+		{
+			if (shared->value || shared->failed)
+			{
+				return;
+			}
+			shared->failed = true;
+			shared->error = error;
+			shared->callbacks.clear();
+
+			std::vector<std::function<void(const std::string &)>> callbacks;
+			callbacks.swap(shared->failure_callbacks);
+
+			if (shared->token.is_cancelled())
+			{
+				return;
+			}
+
+			lib::cancel_context context(shared->token);
+			for (const auto &callback: callbacks)
+			{
+				callback(shared->error);
+			}
+		}
+
+		/**
+		 * Function resolving this promise, to use as callback
+		 */
+		auto resolver() const -> std::function<void(const T &)>
+		{
+			const auto self = *this;
+			return [self](const T &value)
+			{
+				self.resolve(value);
+			};
+		}
+
+		/**
+		 * Function rejecting this promise, to pass on failures
+		 */
+		auto rejecter() const -> std::function<void(const std::string &)>
+		{
+			const auto self = *this;
+			return [self](const std::string &error)
+			{
+				self.reject(error);
+			};
+		}
+
+		auto get_future() const -> future<T>
+		{
+			return future<T>(shared);
+		}
+
+	private:
+		std::shared_ptr<typename future<T>::state> shared;
+	};
+
+	/**
+	 * Future of all values, in the same order, when all are available,
+	 * or failing when any fails
+	 */
+	template<typename T>
+	auto when_all(const std::vector<future<T>> &futures) -> future<std::vector<T>>
+	{
+		lib::promise<std::vector<T>> all;
+		if (futures.empty())
+		{
+			all.resolve(std::vector<T>());
+			return all.get_future();
+		}
+
+		auto values = std::make_shared<std::vector<T>>(futures.size());
+		auto remaining = std::make_shared<size_t>(futures.size());
+
+		for (size_t i = 0; i < futures.size(); i++)
+		{
+			futures.at(i).then([all, values, remaining, i](const T &value)
+			{
+				(*values)[i] = value;
+				if (--*remaining == 0)
+				{
+					all.resolve(*values);
+				}
+			});
+			futures.at(i).fail(all.rejecter());
+		}
+
+		return all.get_future();
+	}
+
+	/**
+	 * Future of both values, when both are available
+	 */
+	template<typename A, typename B>
+	auto when_all(const future<A> &first, const future<B> &second) -> future<std::pair<A, B>>
+	{
+		return first.and_then([second](const A &first_value) -> future<std::pair<A, B>>
+		{
+			return second.map([first_value](const B &second_value) -> std::pair<A, B>
+			{
+				return std::make_pair(first_value, second_value);
+			});
+		});
+	}
+
+	/**
+	 * Future of first available value, or failing when all fail
+	 */
+	template<typename T>
+	auto when_any(const std::vector<future<T>> &futures) -> future<T>
+	{
+		lib::promise<T> any;
+		auto remaining = std::make_shared<size_t>(futures.size());
+
+		for (const auto &item: futures)
+		{
+			item.then(any.resolver());
+			item.fail([any, remaining](const std::string &error)
+			{
+				if (--*remaining == 0)
+				{
+					any.reject(error);
+				}
+			});
+		}
+		return any.get_future();
+	}
+}
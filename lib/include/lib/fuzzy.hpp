@@ -0,0 +1,108 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace lib
+{
+	/**
+	 * Typo tolerant matching of a query against text,
+	 * using bit-parallel approximate string matching (Myers, 1999)
+	 */
+	class fuzzy
+	{
+	public:
+		/**
+		 * Prepare query for matching
+		 * @param query Query, case and diacritics are ignored
+		 */
+		explicit fuzzy(const std::string &query);
+
+		/**
+		 * Query has no words, and matches everything
+		 */
+		auto is_empty() const -> bool;
+
+		/**
+		 * How well all words in query match text
+		 * @param text Normalized text to match against
+		 * @return Score, higher is better, or 0 if any word doesn't match
+		 */
+		auto score(const std::string &text) const -> int;
+
+		/**
+		 * Score all texts, using multiple threads for larger lists
+		 * @param texts Normalized texts to match against
+		 * @return Index and score of all matching texts, in ascending order of index
+		 */
+		auto filter(const std::vector<std::string> &texts) const
+		-> std::vector<std::pair<size_t, int>>;
+
+		/**
+		 * Lowest edit distance between pattern and any part of text
+		 * @param pattern Pattern to search for, only the first 64 characters are used
+		 * @param text Text to search in
+		 * @return Number of insertions, deletions and substitutions needed
+		 */
+		static auto distance(const std::string &pattern, const std::string &text) -> size_t;
+
+		/**
+		 * Max allowed edit distance for a word, longer words allow more typos,
+		 * while numbers always need to match exactly
+		 */
+		static auto max_distance(const std::string &word) -> size_t;
+
+	private:
+		/**
+		 * Minimum number of texts per thread when filtering
+		 */
+		static constexpr size_t min_chunk_size = 4096;
+
+		/**
+		 * Max pattern length, one bit per character
+		 */
+		static constexpr size_t max_length = 64;
+
+		/**
+		 * Precomputed bit masks for a single word
+		 */
+		class word
+		{
+		public:
+			explicit word(const std::string &text);
+
+			/**
+			 * Lowest edit distance to any part of text,
+			 * stopping early on an exact match
+			 */
+			auto distance(const std::string &text) const -> size_t;
+
+			/**
+			 * Word length, at most max_length
+			 */
+			size_t length = 0;
+
+			/**
+			 * Max allowed distance
+			 */
+			size_t max = 0;
+
+		private:
+			/**
+			 * Positions of each character in word
+			 */
+			std::array<uint64_t, 256> peq;
+		};
+
+		std::vector<word> words;
+
+		/**
+		 * Score texts in range [begin, end)
+		 */
+		auto filter(const std::vector<std::string> &texts,
+			size_t begin, size_t end) const -> std::vector<std::pair<size_t, int>>;
+	};
+}
@@ -2,6 +2,8 @@
 
 #include "lib/settings.hpp"
 #include "lib/format.hpp"
+#include "lib/httpresponse.hpp"
+#include "lib/canceltoken.hpp"
 #include "lib/spotify/callback.hpp"
 
 #include <string>
@@ -15,6 +17,8 @@ namespace lib
 
 	/**
 	 * Abstract HTTP client
+	 * @note Requests, except send, are expected to be aborted, and never call back,
+	 * if lib::cancel_token::current() when started gets cancelled
 	 */
 	class http_client
 	{
@@ -57,5 +61,15 @@ namespace lib
 		 */
 		virtual void del(const std::string &url, const std::string &body,
 			const headers &headers, lib::callback<std::string> &callback) const = 0;
+
+		/**
+		 * Request with any method, where failures can be told apart from empty responses
+		 * @param method HTTP method, for example PUT
+		 * @param body Request body, or empty if none
+		 * @param callback Response, with status 0 if no response was received
+		 */
+		virtual void send(const std::string &method, const std::string &url,
+			const std::string &body, const headers &headers,
+			lib::callback<lib::http_response> &callback) const = 0;
 	};
 }
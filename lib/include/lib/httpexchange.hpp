@@ -0,0 +1,73 @@
+#pragma once
+
+#include "thirdparty/filesystem.hpp"
+#include "thirdparty/json.hpp"
+
+#include <string>
+#include <vector>
+
+namespace lib
+{
+	/**
+	 * Recorded HTTP request and its response
+	 * @note Headers are not recorded, as they contain access tokens
+	 */
+	class http_exchange
+	{
+	public:
+		/**
+		 * HTTP method, for example GET
+		 */
+		std::string method;
+
+		std::string url;
+
+		/**
+		 * Request body, or empty if none
+		 */
+		std::string body;
+
+		/**
+		 * HTTP status code, or 0 if no response was received,
+		 * or the request was made with a method only returning the response body
+		 */
+		int status = 0;
+
+		/**
+		 * Response body, may be empty, or binary, like images
+		 */
+		std::string response;
+
+		/**
+		 * Time until response was received, in milliseconds
+		 */
+		long long duration = 0;
+
+		/**
+		 * Method, URL and body, to find matching requests
+		 */
+		auto key() const -> std::string;
+
+		/**
+		 * Key for a request with method, URL and body
+		 */
+		static auto key(const std::string &method, const std::string &url,
+			const std::string &body) -> std::string;
+
+		/**
+		 * Load requests saved with save()
+		 */
+		static auto load(const ghc::filesystem::path &path) -> std::vector<http_exchange>;
+
+		/**
+		 * Save requests as JSON, with responses that aren't valid UTF-8 as base64
+		 * @return File was fully written, otherwise any previous file is left as is
+		 */
+		static auto save(const ghc::filesystem::path &path,
+			const std::vector<http_exchange> &exchanges) -> bool;
+	};
+
+	void to_json(nlohmann::json &j, const http_exchange &e);
+
+	void from_json(const nlohmann::json &j, http_exchange &e);
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+
+namespace lib
+{
+	/**
+	 * Response of an HTTP request, including status
+	 */
+	class http_response
+	{
+	public:
+		http_response() = default;
+
+		http_response(int status, std::string body);
+
+		/**
+		 * HTTP status code, or 0 if no response was received
+		 */
+		int status = 0;
+
+		/**
+		 * Response body, may be empty
+		 */
+		std::string body;
+
+		/**
+		 * Request succeeded with a 2xx status
+		 */
+		auto is_success() const -> bool;
+
+		/**
+		 * Request failed, but may succeed if sent again later,
+		 * for example from no connection, rate limiting or server errors
+		 */
+		auto is_retryable() const -> bool;
+	};
+}
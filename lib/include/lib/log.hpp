@@ -4,9 +4,45 @@
 #include "lib/fmt.hpp"
 #include "lib/logmessage.hpp"
 #include "lib/developermode.hpp"
+#include "lib/logbuffer.hpp"
+#include "lib/logfile.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <regex>
+#include <set>
+#include <thread>
+
+/**
+ * Least severe level compiled in, where 0 is verbose, 1 is information,
+ * 2 is warning, and 3 is error, LIB_LOG_* calls below it are removed at compile time
+ */
+#ifndef LIB_LOG_MIN_LEVEL
+#define LIB_LOG_MIN_LEVEL 0
+#endif
+
+/**
+ * Log if level is enabled, where arguments are only evaluated if logged,
+ * unlike calling lib::log directly, where only formatting is skipped
+ */
+#define LIB_LOG(type, func, ...) \
+	do \
+	{ \
+		if (lib::log::is_enabled(type)) \
+		{ \
+			lib::log::func(__VA_ARGS__); \
+		} \
+	} \
+	while (false)
+
+#define LIB_LOG_DEBUG(...) LIB_LOG(lib::log_type::verbose, debug, __VA_ARGS__)
+#define LIB_LOG_INFO(...) LIB_LOG(lib::log_type::information, info, __VA_ARGS__)
+#define LIB_LOG_WARN(...) LIB_LOG(lib::log_type::warning, warn, __VA_ARGS__)
+#define LIB_LOG_ERROR(...) LIB_LOG(lib::log_type::error, error, __VA_ARGS__)
 
 namespace lib
 {
@@ -22,7 +58,12 @@ namespace lib
 		template<typename Format, typename Arg, typename... Args>
 		static void info(const Format &fmt, const Arg &arg, Args &&... args)
 		{
-			info(fmt::format(fmt, arg, args...));
+			if (!is_enabled(log_type::information))
+			{
+				return;
+			}
+
+			message(log_type::information, fmt::format(fmt, arg, args...));
 		}
 
 		/**
@@ -31,6 +72,11 @@ namespace lib
 		template<typename Format>
 		static void info(const Format &fmt)
 		{
+			if (!is_enabled(log_type::information))
+			{
+				return;
+			}
+
 			message(log_type::information, fmt);
 		}
 
@@ -40,7 +86,12 @@ namespace lib
 		template<typename Format, typename Arg, typename... Args>
 		static void warn(const Format &fmt, const Arg &arg, Args &&... args)
 		{
-			warn(fmt::format(fmt, arg, args...));
+			if (!is_enabled(log_type::warning))
+			{
+				return;
+			}
+
+			message(log_type::warning, fmt::format(fmt, arg, args...));
 		}
 
 		/**
@@ -49,6 +100,11 @@ namespace lib
 		template<typename Format>
 		static void warn(const Format &fmt)
 		{
+			if (!is_enabled(log_type::warning))
+			{
+				return;
+			}
+
 			message(log_type::warning, fmt);
 		}
 
@@ -58,7 +114,12 @@ namespace lib
 		template<typename Format, typename Arg, typename... Args>
 		static void error(const Format &fmt, const Arg &arg, Args &&... args)
 		{
-			error(fmt::format(fmt, arg, args...));
+			if (!is_enabled(log_type::error))
+			{
+				return;
+			}
+
+			message(log_type::error, fmt::format(fmt, arg, args...));
 		}
 
 		/**
@@ -67,6 +128,11 @@ namespace lib
 		template<typename Format>
 		static void error(const Format &fmt)
 		{
+			if (!is_enabled(log_type::error))
+			{
+				return;
+			}
+
 			message(log_type::error, fmt);
 		}
 
@@ -77,7 +143,12 @@ namespace lib
 		template<typename Format, typename Arg, typename... Args>
 		static void debug(const Format &fmt, const Arg &arg, Args &&... args)
 		{
-			debug(fmt::format(fmt, arg, args...));
+			if (!is_enabled(log_type::verbose))
+			{
+				return;
+			}
+
+			message(log_type::verbose, fmt::format(fmt, arg, args...));
 		}
 
 		/**
@@ -87,7 +158,7 @@ namespace lib
 		template<typename Format>
 		static void debug(const Format &fmt)
 		{
-			if (!developer_mode::enabled)
+			if (!is_enabled(log_type::verbose))
 			{
 				return;
 			}
@@ -96,10 +167,88 @@ namespace lib
 		}
 
 		/**
-		 * Get all messages that has been logged since application start
-		 * @return Log messages
+		 * Log message with structured fields, for a specific subsystem
+		 * @param category Subsystem, like "api", only logged if enabled
+		 * @param fields Fields, like endpoint, duration or bytes
+		 */
+		static void event(log_type type, const std::string &category,
+			const std::string &message, const log_fields &fields)
+		{
+			if (!is_enabled(type) || !is_category_enabled(category))
+			{
+				return;
+			}
+
+			add(log_message(type, category, message, fields));
+		}
+
+		/**
+		 * Log message with structured fields, only getting fields if logged
+		 * @param get_fields Function returning log_fields
+		 */
+		template<typename GetFields>
+		static void event(log_type type, const std::string &category,
+			const std::string &message, const GetFields &get_fields)
+		{
+			if (!is_enabled(type) || !is_category_enabled(category))
+			{
+				return;
+			}
+
+			add(log_message(type, category, message, get_fields()));
+		}
+
+		/**
+		 * Enable or disable logging events of a subsystem,
+		 * all are disabled by default
+		 */
+		static void set_category_enabled(const std::string &category, bool enabled);
+
+		/**
+		 * Events of subsystem are logged
+		 */
+		static auto is_category_enabled(const std::string &category) -> bool;
+
+		/**
+		 * Also write all messages to file, in the background
+		 * @param file File to write to, or nullptr to stop writing to file
+		 */
+		static void set_file(const std::shared_ptr<log_file> &file);
+
+		/**
+		 * Messages of type are compiled in, see LIB_LOG_MIN_LEVEL
+		 */
+		static constexpr auto is_compiled(log_type type) -> bool
+		{
+			return severity(type) >= LIB_LOG_MIN_LEVEL;
+		}
+
+		/**
+		 * Messages of type are logged, checked before formatting,
+		 * to avoid expensive arguments when logging something disabled
+		 */
+		static auto is_enabled(log_type type) -> bool
+		{
+			return is_compiled(type)
+				&& (type != log_type::verbose || developer_mode::enabled);
+		}
+
+		/**
+		 * Get most recent messages, including messages not yet printed
+		 * @return Log messages, oldest first
+		 */
+		static auto get_messages() -> std::vector<log_message>;
+
+		/**
+		 * Get messages not yet seen, see log_buffer::messages_since
+		 * @param next Number of messages seen, updated to include returned messages
+		 */
+		static auto get_messages(size_t &next) -> std::vector<log_message>;
+
+		/**
+		 * Print all messages waiting to be printed in the background
 		 */
-		static auto get_messages() -> const std::vector<log_message> &;
+		static void flush();
 
 		/**
 		 * Clears all messages in the log
@@ -119,14 +268,93 @@ namespace lib
 		log() = default;
 
 		/**
-		 * History of all messages
+		 * How severe a message is, from 0 (verbose) to 3 (error)
+		 */
+		static constexpr auto severity(log_type type) -> int
+		{
+			return type == log_type::verbose ? 0
+				: type == log_type::information ? 1
+					: type == log_type::warning ? 2
+						: 3;
+		}
+
+		/**
+		 * Max messages waiting to be printed, more are dropped
+		 */
+		static constexpr size_t queue_capacity = 4096;
+
+		/**
+		 * Max messages kept in history
+		 */
+		static constexpr size_t history_capacity = 10000;
+
+		/**
+		 * Max time messages wait before being printed
 		 */
-		static std::vector<log_message> messages;
+		static constexpr std::chrono::milliseconds flush_interval{100};
 
 		/**
 		 * Also print to stdout/stderr
 		 */
-		static bool log_to_stdout;
+		static std::atomic<bool> log_to_stdout;
+
+		/**
+		 * Messages, shared with the background thread
+		 */
+		static auto buffer() -> log_buffer &;
+
+		/**
+		 * Start printing messages in the background, if not already started
+		 */
+		static void start();
+
+		/**
+		 * Stop background thread, and print remaining messages, when exiting
+		 */
+		static void stop();
+
+		/**
+		 * Print a single message
+		 */
+		static void print(const log_message &message);
+
+		/**
+		 * Background thread printing messages, and writing them to file
+		 */
+		class sink
+		{
+		public:
+			std::thread thread;
+			std::mutex mutex;
+			std::condition_variable wake;
+			std::atomic<bool> running{false};
+			bool stopping = false;
+
+			/**
+			 * Lock when writing messages
+			 */
+			std::mutex file_mutex;
+			std::shared_ptr<log_file> file;
+		};
+
+		/**
+		 * Enabled subsystems
+		 */
+		class categories
+		{
+		public:
+			std::mutex mutex;
+			std::set<std::string> enabled;
+
+			/**
+			 * Any subsystem is enabled, to skip locking if none are
+			 */
+			std::atomic<bool> any{false};
+		};
+
+		static auto get_sink() -> sink &;
+
+		static auto get_categories() -> categories &;
 
 		/**
 		 * Log a message with the specified type
@@ -134,5 +362,10 @@ namespace lib
 		 * @param message Message to log
 		 */
 		static void message(log_type log_type, const std::string &message);
+
+		/**
+		 * Add message to be printed
+		 */
+		static void add(const log_message &message);
 	};
 }
@@ -0,0 +1,76 @@
+#pragma once
+
+#include "lib/logmessage.hpp"
+#include "lib/mpscqueue.hpp"
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace lib
+{
+	/**
+	 * Log messages with bounded memory, where messages are added without locking,
+	 * and only the most recent messages are kept
+	 */
+	class log_buffer
+	{
+	public:
+		/**
+		 * @param queue_capacity Max messages waiting to be drained, more are dropped
+		 * @param history_capacity Max messages kept after being drained
+		 */
+		log_buffer(size_t queue_capacity, size_t history_capacity);
+
+		/**
+		 * Add message, from any thread
+		 * @return Message was added, or false if dropped because queue is full
+		 */
+		auto push(const lib::log_message &message) -> bool;
+
+		/**
+		 * Move waiting messages to history, from any thread, one thread at a time
+		 * @param sink Called with each message, for example to print it
+		 */
+		void drain(const std::function<void(const lib::log_message &)> &sink);
+
+		/**
+		 * Drained messages, oldest first
+		 */
+		auto messages() const -> std::vector<lib::log_message>;
+
+		/**
+		 * Drained messages not yet seen, oldest first,
+		 * to only get new messages when called repeatedly
+		 * @param next Number of messages seen, starting at 0,
+		 * updated to include the returned messages
+		 */
+		auto messages_since(size_t &next) const -> std::vector<lib::log_message>;
+
+		/**
+		 * Remove all messages, including messages waiting to be drained
+		 */
+		void clear();
+
+	private:
+		lib::mpsc_queue<lib::log_message> queue;
+		std::atomic<size_t> dropped;
+
+		size_t history_capacity;
+		std::deque<lib::log_message> history;
+
+		/**
+		 * Messages ever added to history, including removed ones
+		 */
+		size_t total = 0;
+
+		/**
+		 * Lock when draining or reading history
+		 */
+		mutable std::mutex mutex;
+
+		void add_to_history(const lib::log_message &message);
+	};
+}
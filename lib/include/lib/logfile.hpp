@@ -0,0 +1,76 @@
+#pragma once
+
+#include "lib/logmessage.hpp"
+
+#include "thirdparty/filesystem.hpp"
+
+#include <fstream>
+#include <string>
+
+namespace lib
+{
+	/**
+	 * Log messages appended to a file, one line per message,
+	 * moved to numbered files when too large, where only the newest files are kept
+	 */
+	class log_file
+	{
+	public:
+		/**
+		 * @param path File to write to, like spotify-qt.log
+		 * @param max_size Max size in bytes before moving to spotify-qt.log.1
+		 * @param max_files Max number of files, including the current one
+		 */
+		log_file(const ghc::filesystem::path &path, size_t max_size, size_t max_files);
+
+		/**
+		 * Append message
+		 */
+		void write(const lib::log_message &message);
+
+		/**
+		 * Write appended messages to disk
+		 */
+		void flush();
+
+		/**
+		 * Format message as a single, tab separated, line:
+		 * time, type, category, message, and key=value for each field
+		 * @note Without line break
+		 */
+		static auto format(const lib::log_message &message) -> std::string;
+
+	private:
+		ghc::filesystem::path path;
+		size_t max_size;
+		size_t max_files;
+
+		std::ofstream stream;
+		size_t size = 0;
+
+		/**
+		 * Open file for appending, rotating first if already too large
+		 */
+		void open();
+
+		/**
+		 * Move all files one step, removing the oldest
+		 */
+		void rotate();
+
+		/**
+		 * Path to older file, like spotify-qt.log.1
+		 */
+		auto numbered(size_t index) const -> ghc::filesystem::path;
+
+		/**
+		 * Escape characters used as separators
+		 */
+		static auto escape(const std::string &value) -> std::string;
+
+		/**
+		 * Single character type, like W for warning
+		 */
+		static auto type_char(lib::log_type log_type) -> char;
+	};
+}
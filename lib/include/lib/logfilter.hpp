@@ -0,0 +1,52 @@
+#pragma once
+
+#include "lib/logmessage.hpp"
+
+#include <string>
+#include <vector>
+
+namespace lib
+{
+	/**
+	 * Filter for log messages, by type and text
+	 */
+	class log_filter
+	{
+	public:
+		/**
+		 * Filter matching all messages
+		 */
+		log_filter() = default;
+
+		/**
+		 * @param text Text the message or category contains, ignoring case, or empty for any
+		 * @param types Types of messages, or empty for any
+		 */
+		log_filter(const std::string &text, const std::vector<lib::log_type> &types);
+
+		/**
+		 * Message matches filter
+		 */
+		auto matches(const lib::log_message &message) const -> bool;
+
+		/**
+		 * Filter matches all messages
+		 */
+		auto is_empty() const -> bool;
+
+		/**
+		 * Indices of matching messages
+		 * @param from Index to start at, to only filter new messages
+		 */
+		auto apply(const std::vector<lib::log_message> &messages,
+			size_t from) const -> std::vector<size_t>;
+
+	private:
+		/**
+		 * Text, in lowercase
+		 */
+		std::string text;
+
+		std::vector<lib::log_type> types;
+	};
+}
@@ -3,8 +3,17 @@
 #include "lib/datetime.hpp"
 #include "lib/enum/logtype.hpp"
 
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace lib
 {
+	/**
+	 * Structured fields of a log message, as key and value
+	 */
+	using log_fields = std::vector<std::pair<std::string, std::string>>;
+
 	/**
 	 * A message in the log
 	 */
@@ -27,13 +36,24 @@ namespace lib
 		 */
 		log_message(log_type log_type, const std::string &message);
 
+		/**
+		 * Save a logged message with structured fields for the current time
+		 * @param log_type Type of log
+		 * @param category Subsystem logging the message, like "api"
+		 * @param message Message logged
+		 * @param fields Fields, like endpoint or duration
+		 */
+		log_message(log_type log_type, const std::string &category,
+			const std::string &message, const log_fields &fields);
+
 		/**
 		 * Instance with default values, only use if required
 		 */
 		log_message() = default;
 
 		/**
-		 * Format message as [time] [type] message
+		 * Format message as [time] [type] message,
+		 * or [time] [type] [category] message key=value if it has a category
 		 * @return Formatted message
 		 */
 		auto to_string() const -> std::string;
@@ -62,6 +82,26 @@ namespace lib
 		 */
 		auto get_message() const -> std::string;
 
+		/**
+		 * Get type of log
+		 */
+		auto get_log_type() const -> log_type;
+
+		/**
+		 * Get time the message was logged
+		 */
+		auto get_date_time() const -> const date_time &;
+
+		/**
+		 * Get subsystem logging the message, or empty if none
+		 */
+		auto get_category() const -> const std::string &;
+
+		/**
+		 * Get structured fields
+		 */
+		auto get_fields() const -> const log_fields &;
+
 	private:
 		/**
 		 * Logged time
@@ -71,11 +111,21 @@ namespace lib
 		/**
 		 * Type of log
 		 */
-		log_type logType;
+		log_type logType = log_type::information;
 
 		/**
 		 * Message logged
 		 */
 		std::string message;
+
+		/**
+		 * Subsystem logging the message
+		 */
+		std::string category;
+
+		/**
+		 * Structured fields
+		 */
+		log_fields fields;
 	};
 }
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace lib
+{
+	/**
+	 * Fixed size map, where the least recently used item is removed first
+	 * @tparam K Key type, must be hashable
+	 * @tparam V Value type
+	 */
+	template<typename K, typename V>
+	class lru_cache
+	{
+	public:
+		/**
+		 * Construct a new empty cache
+		 * @param capacity Max number of items
+		 */
+		explicit lru_cache(size_t capacity)
+			: capacity(capacity)
+		{
+		}
+
+		/**
+		 * Get item, and mark it as recently used
+		 * @param key Key of item
+		 * @return Pointer to item, or nullptr if not found
+		 * @note Pointer is only valid until the next insert
+		 */
+		auto get(const K &key) -> const V *
+		{
+			const auto item = lookup.find(key);
+			if (item == lookup.end())
+			{
+				return nullptr;
+			}
+
+			items.splice(items.begin(), items, item->second);
+			return &item->second->second;
+		}
+
+		/**
+		 * Add or replace item, removing least recently used item if full
+		 * @param key Key of item
+		 * @param value Item
+		 */
+		void put(const K &key, V value)
+		{
+			const auto item = lookup.find(key);
+			if (item != lookup.end())
+			{
+				item->second->second = std::move(value);
+				items.splice(items.begin(), items, item->second);
+				return;
+			}
+
+			if (capacity == 0)
+			{
+				return;
+			}
+
+			if (items.size() >= capacity)
+			{
+				lookup.erase(items.back().first);
+				items.pop_back();
+			}
+
+			items.emplace_front(key, std::move(value));
+			lookup[key] = items.begin();
+		}
+
+		/**
+		 * Current number of items
+		 */
+		auto size() const -> size_t
+		{
+			return items.size();
+		}
+
+		/**
+		 * Remove all items
+		 */
+		void clear()
+		{
+			items.clear();
+			lookup.clear();
+		}
+
+	private:
+		using list = std::list<std::pair<K, V>>;
+
+		size_t capacity;
+
+		/**
+		 * Items, most recently used first
+		 */
+		list items;
+
+		std::unordered_map<K, typename list::iterator> lookup;
+	};
+}
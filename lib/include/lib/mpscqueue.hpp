@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace lib
+{
+	/**
+	 * Bounded queue where any number of threads can add items without locking,
+	 * and a single thread at a time removes them (Vyukov, 2010)
+	 */
+	template<typename T>
+	class mpsc_queue
+	{
+	public:
+		/**
+		 * Construct a new empty queue
+		 * @param min_capacity Max number of items, rounded up to a power of two
+		 */
+		explicit mpsc_queue(size_t min_capacity)
+			: enqueue_pos(0)
+		{
+			size_t size = 2;
+			while (size < min_capacity)
+			{
+				size *= 2;
+			}
+
+			mask = size - 1;
+			cells = std::unique_ptr<cell[]>(new cell[size]);
+			for (size_t i = 0; i < size; i++)
+			{
+				cells[i].sequence.store(i, std::memory_order_relaxed);
+			}
+		}
+
+		/**
+		 * Add item, from any thread
+		 * @return Item was added, or false if queue is full
+		 */
+		auto push(const T &item) -> bool
+		{
+			auto pos = enqueue_pos.load(std::memory_order_relaxed);
+			cell *current;
+
+			while (true)
+			{
+				current = &cells[pos & mask];
+				const auto sequence = current->sequence.load(std::memory_order_acquire);
+				const auto diff = static_cast<std::ptrdiff_t>(sequence)
+					- static_cast<std::ptrdiff_t>(pos);
+
+				if (diff == 0)
+				{
+					if (enqueue_pos.compare_exchange_weak(pos, pos + 1,
+						std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (diff < 0)
+				{
+					return false;
+				}
+				else
+				{
+					pos = enqueue_pos.load(std::memory_order_relaxed);
+				}
+			}
+
+			current->item = item;
+			current->sequence.store(pos + 1, std::memory_order_release);
+			return true;
+		}
+
+		/**
+		 * Remove oldest item, only from one thread at a time
+		 * @return Item was removed, or false if queue is empty
+		 */
+		auto pop(T &item) -> bool
+		{
+			auto &current = cells[dequeue_pos & mask];
+			const auto sequence = current.sequence.load(std::memory_order_acquire);
+			if (static_cast<std::ptrdiff_t>(sequence)
+				- static_cast<std::ptrdiff_t>(dequeue_pos + 1) < 0)
+			{
+				return false;
+			}
+
+			item = std::move(current.item);
+			current.sequence.store(dequeue_pos + mask + 1, std::memory_order_release);
+			dequeue_pos++;
+			return true;
+		}
+
+		/**
+		 * Max number of items
+		 */
+		auto capacity() const -> size_t
+		{
+			return mask + 1;
+		}
+
+	private:
+		class cell
+		{
+		public:
+			/**
+			 * Position this cell is next written at, or +1 if written and not yet read
+			 */
+			std::atomic<size_t> sequence;
+			T item;
+		};
+
+		std::unique_ptr<cell[]> cells;
+		size_t mask = 0;
+
+		std::atomic<size_t> enqueue_pos;
+		size_t dequeue_pos = 0;
+	};
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "lib/executor.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace lib
+{
+	/**
+	 * Algorithms split into tasks run on an executor,
+	 * where the calling thread helps out until all tasks are done
+	 */
+	class parallel
+	{
+	public:
+		/**
+		 * Call function for all ranges in [0, size)
+		 * @param grain_size Size of each range, except the last one that may be smaller,
+		 * so range of index i starts at i * grain_size
+		 * @param func Function called with start and end of range
+		 */
+		static void for_range(lib::executor &executor, size_t size, size_t grain_size,
+			const std::function<void(size_t, size_t)> &func);
+
+		/**
+		 * Sort items, not stable
+		 * @param grain_size Items sorted by a single task before merging
+		 */
+		template<typename T, typename Compare>
+		static void sort(lib::executor &executor, std::vector<T> &items,
+			Compare compare, size_t grain_size)
+		{
+			const auto size = items.size();
+			grain_size = std::max<size_t>(grain_size, 1);
+
+			for_range(executor, size, grain_size, [&items, &compare](size_t begin, size_t end)
+			{
+				std::sort(items.begin() + static_cast<long>(begin),
+					items.begin() + static_cast<long>(end), compare);
+			});
+
+			// Merge sorted ranges pairwise, doubling their size each time
+			for (auto width = grain_size; width < size; width *= 2)
+			{
+				for_range(executor, size, width * 2,
+					[&items, &compare, width](size_t begin, size_t end)
+					{
+						const auto middle = std::min(begin + width, end);
+						std::inplace_merge(items.begin() + static_cast<long>(begin),
+							items.begin() + static_cast<long>(middle),
+							items.begin() + static_cast<long>(end), compare);
+					});
+			}
+		}
+
+		/**
+		 * Convert all items, and combine them into one value
+		 * @param initial Value that doesn't change anything when combined,
+		 * like 0 for addition
+		 * @param map Convert a single item
+		 * @param reduce Combine two values, called in order of items
+		 */
+		template<typename T, typename R>
+		static auto map_reduce(lib::executor &executor, const std::vector<T> &items,
+			const R &initial, const std::function<R(const T &)> &map,
+			const std::function<R(const R &, const R &)> &reduce, size_t grain_size) -> R
+		{
+			grain_size = std::max<size_t>(grain_size, 1);
+			std::vector<R> results((items.size() + grain_size - 1) / grain_size, initial);
+
+			for_range(executor, items.size(), grain_size,
+				[&items, &results, &map, &reduce, grain_size](size_t begin, size_t end)
+				{
+					auto &result = results[begin / grain_size];
+					for (auto i = begin; i < end; i++)
+					{
+						result = reduce(result, map(items[i]));
+					}
+				});
+
+			auto total = initial;
+			for (const auto &result: results)
+			{
+				total = reduce(total, result);
+			}
+			return total;
+		}
+	};
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "lib/httpclient.hpp"
+#include "lib/httpexchange.hpp"
+
+#include "thirdparty/filesystem.hpp"
+
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+namespace lib
+{
+	/**
+	 * Sends requests using another client, recording requests and responses,
+	 * to later be replayed by lib::replay_http_client
+	 * @note Synchronous POST requests are not recorded, as they're only used for access tokens
+	 * @note Everything is kept in memory until saved, including images,
+	 * so only meant for recording shorter sessions
+	 */
+	class recording_http_client: public http_client
+	{
+	public:
+		/**
+		 * @param http_client Client to send requests with, outliving this client
+		 * @param max_exchanges Stop recording after this many requests
+		 */
+		explicit recording_http_client(const lib::http_client &http_client,
+			size_t max_exchanges = 10000);
+
+		void get(const std::string &url, const lib::headers &headers,
+			lib::callback<std::string> &callback) const override;
+
+		void put(const std::string &url, const std::string &body,
+			const lib::headers &headers, lib::callback<std::string> &callback) const override;
+
+		void post(const std::string &url, const std::string &body,
+			const lib::headers &headers, lib::callback<std::string> &callback) const override;
+
+		auto post(const std::string &url, const lib::headers &headers,
+			const std::string &post_data) const -> std::string override;
+
+		void del(const std::string &url, const std::string &body,
+			const lib::headers &headers, lib::callback<std::string> &callback) const override;
+
+		void send(const std::string &method, const std::string &url,
+			const std::string &body, const lib::headers &headers,
+			lib::callback<lib::http_response> &callback) const override;
+
+		/**
+		 * Requests with received responses, in order of response
+		 */
+		auto get_exchanges() const -> std::vector<lib::http_exchange>;
+
+		/**
+		 * Save recorded requests as JSON, to load with lib::http_exchange::load
+		 * @return Requests were saved
+		 */
+		auto save(const ghc::filesystem::path &path) const -> bool;
+
+	private:
+		using clock = std::chrono::steady_clock;
+
+		const lib::http_client &http;
+		const size_t max_exchanges;
+
+		mutable std::mutex mutex;
+		mutable std::vector<lib::http_exchange> exchanges;
+
+		/**
+		 * Callback recording response body, then forwarding it
+		 */
+		auto record(const std::string &method, const std::string &url, const std::string &body,
+			lib::callback<std::string> &callback) const -> std::function<void(const std::string &)>;
+
+		void add(lib::http_exchange exchange, clock::time_point started) const;
+	};
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include "lib/httpclient.hpp"
+#include "lib/httpexchange.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace lib
+{
+	/**
+	 * Responds to requests with recorded responses, without any network access
+	 * @note Without simulated latency, responses are returned before the request method returns,
+	 * otherwise each is returned on the main thread once its own latency has passed
+	 */
+	class replay_http_client: public http_client
+	{
+	public:
+		/**
+		 * @param exchanges Recorded requests, in order of response,
+		 * for example from lib::http_exchange::load
+		 */
+		explicit replay_http_client(const std::vector<lib::http_exchange> &exchanges);
+
+		/**
+		 * Stops waiting, responses not yet returned are never returned
+		 */
+		~replay_http_client();
+
+		void get(const std::string &url, const lib::headers &headers,
+			lib::callback<std::string> &callback) const override;
+
+		void put(const std::string &url, const std::string &body,
+			const lib::headers &headers, lib::callback<std::string> &callback) const override;
+
+		void post(const std::string &url, const std::string &body,
+			const lib::headers &headers, lib::callback<std::string> &callback) const override;
+
+		/**
+		 * @note Blocks while waiting for simulated latency
+		 */
+		auto post(const std::string &url, const lib::headers &headers,
+			const std::string &post_data) const -> std::string override;
+
+		void del(const std::string &url, const std::string &body,
+			const lib::headers &headers, lib::callback<std::string> &callback) const override;
+
+		void send(const std::string &method, const std::string &url,
+			const std::string &body, const lib::headers &headers,
+			lib::callback<lib::http_response> &callback) const override;
+
+		/**
+		 * Wait before each response, defaults to none
+		 */
+		void set_latency(std::chrono::milliseconds value);
+
+		/**
+		 * Wait as long as when each response was recorded, instead of a fixed latency
+		 */
+		void set_recorded_latency(bool value);
+
+		/**
+		 * Also wait for response bodies to transfer, in bytes per second, or 0 for no limit
+		 */
+		void set_bandwidth(size_t value);
+
+		/**
+		 * Requests made without a recorded response, as "{method} {url}"
+		 */
+		auto get_unmatched() const -> std::vector<std::string>;
+
+	private:
+		/**
+		 * Recorded responses to the same request, and how many have been replayed
+		 */
+		class responses
+		{
+		public:
+			std::vector<lib::http_exchange> exchanges;
+			size_t replayed = 0;
+		};
+
+		mutable std::mutex mutex;
+		mutable std::map<std::string, responses> recorded;
+		mutable std::vector<std::string> unmatched;
+
+		std::chrono::milliseconds latency;
+		bool recorded_latency = false;
+		size_t bandwidth = 0;
+
+		/**
+		 * Responses waiting for their latency to pass, by when to return them
+		 */
+		mutable std::multimap<std::chrono::steady_clock::time_point,
+			std::function<void()>> delayed;
+
+		mutable std::mutex delayed_mutex;
+		mutable std::condition_variable wake;
+		mutable std::thread timer;
+		bool stopping = false;
+
+		/**
+		 * Next recorded response, in order, repeating the last one when out of responses
+		 * @return Recorded response, or status 0 if none was recorded
+		 */
+		auto next(const std::string &method, const std::string &url,
+			const std::string &body) const -> lib::http_exchange;
+
+		/**
+		 * Time to wait as if response was received over the network
+		 */
+		auto delay(const lib::http_exchange &exchange) const -> std::chrono::milliseconds;
+
+		/**
+		 * Call function now if there's no delay, otherwise on the main thread after it
+		 */
+		void deliver(std::chrono::milliseconds duration, const std::function<void()> &func) const;
+
+		/**
+		 * Return delayed responses when their time has come, until stopped
+		 */
+		void run_timer() const;
+
+		/**
+		 * Respond with body, unless request was cancelled
+		 */
+		void respond(const std::string &method, const std::string &url,
+			const std::string &body, lib::callback<std::string> &callback) const;
+	};
+}
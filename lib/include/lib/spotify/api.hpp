@@ -13,15 +13,21 @@
 #include "lib/spotify/artist.hpp"
 #include "lib/spotify/playlist.hpp"
 #include "lib/spotify/playlistdetails.hpp"
+#include "lib/spotify/playlistmove.hpp"
+#include "lib/spotify/mutation.hpp"
+#include "lib/spotify/apimetrics.hpp"
 #include "lib/spotify/searchresults.hpp"
 #include "lib/spotify/track.hpp"
 #include "lib/spotify/audiofeatures.hpp"
 #include "lib/spotify/savedalbum.hpp"
+#include "lib/spotify/page.hpp"
 #include "lib/spotify/episode.hpp"
 #include "lib/spotify/callback.hpp"
 #include "lib/spotify/request.hpp"
 #include "lib/httpclient.hpp"
 #include "lib/datetime.hpp"
+#include "lib/result.hpp"
+#include "lib/future.hpp"
 
 #include "thirdparty/json.hpp"
 
@@ -68,6 +74,17 @@ namespace lib
 			void albums(const lib::spt::artist &artist,
 				lib::callback<std::vector<lib::spt::album>> &callback);
 
+			auto artist(const std::string &id) -> lib::future<lib::spt::artist>;
+
+			auto top_tracks(const lib::spt::artist &artist)
+			-> lib::future<std::vector<lib::spt::track>>;
+
+			auto related_artists(const lib::spt::artist &artist)
+			-> lib::future<std::vector<lib::spt::artist>>;
+
+			auto albums(const lib::spt::artist &artist)
+			-> lib::future<std::vector<lib::spt::album>>;
+
 			//endregion
 
 			//region Browse
@@ -107,6 +124,13 @@ namespace lib
 
 			void saved_tracks(lib::callback<std::vector<lib::spt::track>> &callback);
 
+			/**
+			 * Get a single page of saved tracks, most recently saved first
+			 * @param offset Index of first track
+			 */
+			void saved_tracks(size_t offset,
+				lib::callback<lib::spt::page<lib::spt::track>> &callback);
+
 			void add_saved_tracks(const std::vector<std::string> &track_ids,
 				lib::callback<std::string> &callback);
 
@@ -267,13 +291,38 @@ namespace lib
 			void playlist_tracks(const lib::spt::playlist &playlist,
 				lib::callback<std::vector<lib::spt::track>> &callback);
 
+			/**
+			 * Tracks in playlist, starting from an offset
+			 * @param offset Position of first track
+			 */
+			void playlist_tracks(const std::string &playlist_id, size_t offset,
+				lib::callback<std::vector<lib::spt::track>> &callback);
+
+			/**
+			 * Add tracks to the end of a playlist
+			 * @param callback New snapshot ID, or error message
+			 */
 			void add_to_playlist(const std::string &playlist_id,
 				const std::vector<std::string> &track_uris,
-				lib::callback<std::string> &callback);
+				lib::callback<lib::result<std::string>> &callback);
 
+			/**
+			 * Remove tracks from playlist
+			 * @param track_index_uris Position and URI of each track
+			 * @param callback New snapshot ID, or error message
+			 */
 			void remove_from_playlist(const std::string &playlist_id,
 				const std::vector<std::pair<int, std::string>> &track_index_uris,
-				lib::callback<std::string> &callback);
+				lib::callback<lib::result<std::string>> &callback);
+
+			/**
+			 * Move a range of tracks within a playlist
+			 * @param snapshot Snapshot to apply move to, or empty for latest
+			 * @param callback New snapshot ID, or error message
+			 */
+			void reorder_playlist(const std::string &playlist_id,
+				const lib::spt::playlist_move &move, const std::string &snapshot,
+				lib::callback<lib::result<std::string>> &callback);
 
 			//endregion
 
@@ -317,6 +366,24 @@ namespace lib
 
 			void refresh(bool force);
 
+			/**
+			 * Get string interpretation of a follow type
+			 * @param type Follow type
+			 */
+			static auto follow_type_string(lib::follow_type type) -> std::string;
+
+			/**
+			 * Send a saved mutation
+			 * @param callback Response, to tell if it should be sent again later
+			 */
+			void send(const lib::spt::mutation &mutation,
+				lib::callback<lib::http_response> &callback);
+
+			/**
+			 * Latency and throughput of requests, per endpoint
+			 */
+			auto get_metrics() -> lib::spt::api_metrics &;
+
 		protected:
 			/**
 			 * Allow use to select device, by default, none is chosen
@@ -376,6 +443,14 @@ namespace lib
 			 */
 			void put(const std::string &url, lib::callback<std::string> &callback);
 
+			/**
+			 * PUT request, without selecting a device on failure
+			 * @param body JSON body or null if no body
+			 * @param callback Response as JSON, or error message
+			 */
+			void put(const std::string &url, const nlohmann::json &body,
+				lib::callback<lib::result<nlohmann::json>> &callback);
+
 			//endregion
 
 			//region POST
@@ -394,6 +469,13 @@ namespace lib
 			 */
 			void post(const std::string &url, lib::callback<std::string> &callback);
 
+			/**
+			 * POST request with no body
+			 * @param callback Response as JSON, or error message
+			 */
+			void post(const std::string &url,
+				lib::callback<lib::result<nlohmann::json>> &callback);
+
 			//endregion
 
 			//region DELETE
@@ -412,17 +494,40 @@ namespace lib
 			 */
 			void del(const std::string &url, lib::callback<std::string> &callback);
 
-			//endregion
-
 			/**
-			 * Get string interpretation of a follow type
-			 * @param type Follow type
+			 * DELETE request
+			 * @param json JSON body or null if no body
+			 * @param callback Response as JSON, or error message
 			 */
-			static auto follow_type_string(lib::follow_type type) -> std::string;
+			void del(const std::string &url, const nlohmann::json &json,
+				lib::callback<lib::result<nlohmann::json>> &callback);
+
+			//endregion
 
 		private:
 			const lib::http_client &http;
 			lib::spt::request &request;
+			lib::spt::api_metrics metrics;
+
+			/**
+			 * Parse JSON response to measured request
+			 * @param json Parsed response
+			 * @return Response could be parsed
+			 */
+			auto parse_json(const lib::spt::api_metrics::request &measured,
+				const std::string &url, const std::string &response, nlohmann::json &json) -> bool;
+
+			/**
+			 * Get error message from response to measured request
+			 */
+			auto parse_error(const lib::spt::api_metrics::request &measured,
+				const std::string &url, const std::string &response) -> std::string;
+
+			/**
+			 * Get JSON from response to measured request, or error message if it failed
+			 */
+			auto parse_result(const lib::spt::api_metrics::request &measured,
+				const std::string &url, const std::string &response) -> lib::result<nlohmann::json>;
 
 			/**
 			 * Get error message from JSON response
@@ -430,6 +535,18 @@ namespace lib
 			static auto error_message(const std::string &url,
 				const std::string &data) -> std::string;
 
+			/**
+			 * Get JSON from response, or error message if request failed
+			 */
+			static auto json_result(const std::string &url,
+				const std::string &data) -> lib::result<nlohmann::json>;
+
+			/**
+			 * Get snapshot ID from result of editing a playlist
+			 */
+			static auto snapshot_result(const lib::result<nlohmann::json> &result)
+			-> lib::result<std::string>;
+
 			/**
 			 * Set last used device
 			 * @param id Device ID
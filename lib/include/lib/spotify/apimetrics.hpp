@@ -0,0 +1,182 @@
+#pragma once
+
+#include "lib/canceltoken.hpp"
+
+#include "thirdparty/json.hpp"
+
+#include <array>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace lib
+{
+	namespace spt
+	{
+		/**
+		 * Measurements of requests to a single endpoint
+		 */
+		class endpoint_metrics
+		{
+		public:
+			/**
+			 * Number of latency buckets, where the last one has everything slower
+			 */
+			static constexpr size_t bucket_count = 9;
+
+			/**
+			 * Upper bound of each latency bucket, in milliseconds
+			 */
+			static constexpr std::array<long long, bucket_count - 1> bucket_bounds{{
+				50, 100, 250, 500, 1000, 2500, 5000, 10000,
+			}};
+
+			size_t requests = 0;
+			size_t errors = 0;
+			size_t retries = 0;
+
+			/**
+			 * Requests sent, but without a response yet
+			 */
+			size_t in_flight = 0;
+
+			/**
+			 * Requests aborted before a response, as the owner went away
+			 */
+			size_t cancelled = 0;
+
+			size_t bytes_sent = 0;
+			size_t bytes_received = 0;
+
+			std::chrono::milliseconds total_latency{0};
+			std::chrono::milliseconds max_latency{0};
+
+			/**
+			 * Time spent parsing responses
+			 */
+			std::chrono::microseconds total_parse{0};
+
+			/**
+			 * Number of requests in each latency bucket
+			 */
+			std::array<size_t, bucket_count> histogram{{}};
+
+			/**
+			 * Average latency of finished requests
+			 */
+			auto average_latency() const -> std::chrono::milliseconds;
+
+			/**
+			 * Approximate latency, as the upper bound of the bucket it's in
+			 * @param percent Percentile, like 95
+			 */
+			auto percentile(double percent) const -> std::chrono::milliseconds;
+
+			/**
+			 * Add latency of a finished request
+			 */
+			void add_latency(std::chrono::milliseconds latency);
+		};
+
+		void to_json(nlohmann::json &j, const endpoint_metrics &m);
+
+		/**
+		 * Latency and throughput of requests, per endpoint,
+		 * where endpoints are paths with IDs replaced, like GET artists/{id}
+		 */
+		class api_metrics
+		{
+		public:
+			/**
+			 * Request in progress
+			 */
+			class request
+			{
+			public:
+				std::string endpoint;
+				std::chrono::steady_clock::time_point started;
+
+				/**
+				 * Start time when tracing, or -1 if not
+				 */
+				long long trace_started = -1;
+
+				/**
+				 * Token the request was sent with, see lib::cancel_token::current
+				 */
+				lib::cancel_token token;
+
+				/**
+				 * Id of function counting request as cancelled
+				 */
+				size_t cancel_id = 0;
+			};
+
+			/**
+			 * Request was sent, counted as cancelled if current cancel token is cancelled first
+			 * @param url Full or relative URL
+			 * @param bytes_sent Size of body
+			 */
+			auto begin(const std::string &method, const std::string &url,
+				size_t bytes_sent) -> request;
+
+			/**
+			 * Response was received
+			 */
+			void end(const request &request, size_t bytes_received);
+
+			/**
+			 * Response was parsed
+			 * @param started When parsing started
+			 */
+			void parsed(const request &request, std::chrono::steady_clock::time_point started);
+
+			/**
+			 * Response is an error
+			 */
+			void failed(const request &request);
+
+			/**
+			 * Request was aborted without a response
+			 */
+			void cancelled(const request &request);
+
+			/**
+			 * Request is sent again after failing
+			 */
+			void retried(const std::string &method, const std::string &url);
+
+			/**
+			 * Measurements of all endpoints requested so far
+			 */
+			auto endpoints() const -> std::map<std::string, endpoint_metrics>;
+
+			/**
+			 * Measurements of all endpoints, for exporting
+			 */
+			auto to_json() const -> nlohmann::json;
+
+			/**
+			 * Remove all measurements
+			 */
+			void reset();
+
+			/**
+			 * Method and path, without host, version and query,
+			 * and with IDs replaced with placeholders
+			 */
+			static auto endpoint(const std::string &method, const std::string &url) -> std::string;
+
+		private:
+			mutable std::mutex mutex;
+			std::map<std::string, endpoint_metrics> metrics;
+
+			/**
+			 * Log each request if "api" log category is enabled
+			 */
+			static void log(const request &request, std::chrono::milliseconds latency,
+				size_t bytes_received);
+		};
+	}
+}
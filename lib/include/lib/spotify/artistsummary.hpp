@@ -0,0 +1,72 @@
+#pragma once
+
+#include "thirdparty/json.hpp"
+
+#include <string>
+
+namespace lib
+{
+	namespace spt
+	{
+		/**
+		 * Summary of an artist in cached playlists and library lists
+		 */
+		class artist_summary
+		{
+		public:
+			artist_summary() = default;
+
+			/**
+			 * Artist name
+			 */
+			std::string name;
+
+			/**
+			 * Artist ID, if known
+			 */
+			std::string id;
+
+			/**
+			 * Number of playlists and lists the artist is in
+			 */
+			size_t sources = 0;
+
+			/**
+			 * Number of tracks by the artist
+			 */
+			size_t tracks = 0;
+
+			/**
+			 * ISO date of most recently added track, or empty if unknown
+			 */
+			std::string last_added;
+
+			/**
+			 * Artist isn't in any playlist or list
+			 */
+			auto is_null() const -> bool;
+
+			/**
+			 * How much the artist is listened to, higher is more,
+			 * where being in many different lists weighs more than many tracks in one
+			 */
+			auto score() const -> double;
+
+		private:
+			/**
+			 * Score of each list the artist is in, in addition to each track
+			 */
+			static constexpr double source_weight = 5.0;
+		};
+
+		/**
+		 * Artist summary -> JSON
+		 */
+		void to_json(nlohmann::json &j, const artist_summary &a);
+
+		/**
+		 * JSON -> Artist summary
+		 */
+		void from_json(const nlohmann::json &j, artist_summary &a);
+	}
+}
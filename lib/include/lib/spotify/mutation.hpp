@@ -0,0 +1,87 @@
+#pragma once
+
+#include "lib/enum/followtype.hpp"
+
+#include "thirdparty/json.hpp"
+
+#include <string>
+#include <vector>
+
+namespace lib
+{
+	namespace spt
+	{
+		/**
+		 * A request that changes something, that can be saved and sent later
+		 */
+		class mutation
+		{
+		public:
+			mutation() = default;
+
+			/**
+			 * HTTP method
+			 */
+			std::string method;
+
+			/**
+			 * URL relative to API
+			 */
+			std::string url;
+
+			/**
+			 * JSON body, or empty if none
+			 */
+			std::string body;
+
+			/**
+			 * What is changed, for example "track_saved:{id}",
+			 * or empty if it can't be undone by another mutation
+			 */
+			std::string target;
+
+			/**
+			 * New state of target
+			 */
+			bool value = false;
+
+			/**
+			 * Mutation undoes other mutation
+			 */
+			auto cancels(const mutation &other) const -> bool;
+
+			/**
+			 * Mutation does the same as other mutation
+			 */
+			auto duplicates(const mutation &other) const -> bool;
+
+			/**
+			 * Mutation sets target to a state, so sending it twice has the same effect
+			 * as sending it once, required to be queued
+			 */
+			auto is_idempotent() const -> bool;
+
+			/**
+			 * Like, or unlike, tracks
+			 */
+			static auto save_tracks(const std::vector<std::string> &track_ids,
+				bool saved) -> mutation;
+
+			/**
+			 * Follow, or unfollow, artists or users
+			 */
+			static auto follow(lib::follow_type type, const std::vector<std::string> &ids,
+				bool following) -> mutation;
+
+			/**
+			 * Follow, or unfollow, a playlist
+			 */
+			static auto follow_playlist(const std::string &playlist_id,
+				bool following) -> mutation;
+		};
+
+		void to_json(nlohmann::json &j, const mutation &m);
+
+		void from_json(const nlohmann::json &j, mutation &m);
+	}
+}
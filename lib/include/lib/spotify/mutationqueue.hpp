@@ -0,0 +1,101 @@
+#pragma once
+
+#include "lib/spotify/api.hpp"
+#include "lib/spotify/mutation.hpp"
+
+#include "thirdparty/filesystem.hpp"
+
+#include <chrono>
+#include <functional>
+#include <vector>
+
+namespace lib
+{
+	namespace spt
+	{
+		/**
+		 * Mutations sent in order, retrying with backoff while offline or rate limited,
+		 * and saved to disk to send after restarting
+		 */
+		class mutation_queue
+		{
+		public:
+			/**
+			 * Construct a new queue, loading mutations saved from last time
+			 * @param path JSON file to save pending mutations to
+			 * @param backoff Time to wait after first failed attempt, doubled after each failure
+			 */
+			mutation_queue(lib::spt::api &spotify, const ghc::filesystem::path &path,
+				std::chrono::milliseconds backoff);
+
+			/**
+			 * Add mutation, removing pending mutations it undoes, and send it as soon as possible
+			 * @return Mutation is idempotent, as others can't safely be sent again
+			 */
+			auto add(const lib::spt::mutation &mutation) -> bool;
+
+			/**
+			 * Send pending mutations, unless already sending, or waiting after a failure
+			 */
+			void flush();
+
+			/**
+			 * State of target, after pending mutations have been sent
+			 * @param target Target, for example "track_saved:{id}"
+			 * @param value Current state, if there's no pending mutation
+			 */
+			auto state(const std::string &target, bool value) const -> bool;
+
+			/**
+			 * Mutations not yet sent, in order
+			 */
+			auto pending() const -> const std::vector<lib::spt::mutation> &;
+
+			/**
+			 * Set function to call after a mutation was successfully sent
+			 */
+			void on_sent(const std::function<void(const lib::spt::mutation &)> &callback);
+
+			/**
+			 * Set function to call after a mutation failed, and won't be sent again
+			 * @param callback Called with mutation and error message
+			 */
+			void on_failed(const std::function<void(const lib::spt::mutation &,
+				const std::string &)> &callback);
+
+		private:
+			/**
+			 * Max time to wait between attempts
+			 */
+			static constexpr std::chrono::minutes max_backoff{5};
+
+			lib::spt::api &spotify;
+			ghc::filesystem::path path;
+			std::vector<lib::spt::mutation> mutations;
+			std::function<void(const lib::spt::mutation &)> sent_callback;
+			std::function<void(const lib::spt::mutation &, const std::string &)> failed_callback;
+
+			/**
+			 * First mutation is currently being sent
+			 */
+			bool sending = false;
+
+			std::chrono::milliseconds initial_backoff;
+			std::chrono::milliseconds backoff;
+			std::chrono::steady_clock::time_point next_attempt;
+
+			/**
+			 * Handle response of first mutation
+			 */
+			void sent(const lib::http_response &response);
+
+			/**
+			 * Error message from response, or status if none
+			 */
+			static auto error_message(const lib::http_response &response) -> std::string;
+
+			void load();
+			void save() const;
+		};
+	}
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "lib/json.hpp"
+
+#include "thirdparty/json.hpp"
+
+#include <vector>
+
+namespace lib
+{
+	namespace spt
+	{
+		/**
+		 * A single page of a paged collection
+		 * @tparam T Item type
+		 */
+		template<typename T>
+		class page
+		{
+		public:
+			page() = default;
+
+			/**
+			 * Items in page
+			 */
+			std::vector<T> items;
+
+			/**
+			 * Index of first item in page
+			 */
+			size_t offset = 0;
+
+			/**
+			 * Number of items in the entire collection
+			 */
+			size_t total = 0;
+
+			/**
+			 * There are more pages after this one
+			 */
+			bool has_next = false;
+		};
+
+		/**
+		 * JSON -> Page
+		 */
+		template<typename T>
+		void from_json(const nlohmann::json &j, page<T> &p)
+		{
+			if (!j.is_object())
+			{
+				return;
+			}
+
+			lib::json::get(j, "items", p.items);
+			lib::json::get(j, "offset", p.offset);
+			lib::json::get(j, "total", p.total);
+			p.has_next = j.contains("next") && j.at("next").is_string();
+		}
+	}
+}
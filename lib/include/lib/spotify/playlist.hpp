@@ -82,9 +82,9 @@ namespace lib
 
 			/**
 			 * Compare snapshot and check if playlist is up to date
+			 * @note Own edits are patched into the cached playlist with the new snapshot
 			 */
-			auto is_up_to_date(const std::string &snapshot,
-				const lib::spt::user &current_user) const -> bool;
+			auto is_up_to_date(const std::string &snapshot) const -> bool;
 		};
 
 		void to_json(nlohmann::json &j, const playlist &p);
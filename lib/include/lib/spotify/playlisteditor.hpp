@@ -0,0 +1,105 @@
+#pragma once
+
+#include "lib/cache.hpp"
+#include "lib/result.hpp"
+#include "lib/spotify/api.hpp"
+#include "lib/spotify/playlistmove.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace lib
+{
+	namespace spt
+	{
+		/**
+		 * Edits playlists, and patches the cached playlist with the changes,
+		 * instead of fetching all tracks again
+		 */
+		class playlist_editor
+		{
+		public:
+			playlist_editor(lib::spt::api &spotify, lib::cache &cache);
+
+			/**
+			 * Add tracks to the end of a playlist,
+			 * only fetching the added tracks to update cache
+			 * @param callback New snapshot, or error message,
+			 * called before added tracks are fetched
+			 */
+			void add(const std::string &playlist_id, const std::vector<std::string> &track_uris,
+				lib::callback<lib::result<std::string>> &callback);
+
+			/**
+			 * Remove tracks from a playlist
+			 * @param track_index_uris Position and URI of each track
+			 * @param callback New snapshot, or error message, called after cache is updated
+			 */
+			void remove(const std::string &playlist_id,
+				const std::vector<std::pair<int, std::string>> &track_index_uris,
+				lib::callback<lib::result<std::string>> &callback);
+
+			/**
+			 * Reorder tracks in a playlist, using as few moves as possible,
+			 * each applied to the snapshot of the previous one
+			 * @param order Current position of each track, in the new order
+			 * @param callback Final snapshot, or error message, called after cache is updated
+			 */
+			void reorder(const std::string &playlist_id, const std::vector<size_t> &order,
+				lib::callback<lib::result<std::string>> &callback);
+
+			/**
+			 * Append added tracks to playlist
+			 * @param initial Snapshot of playlist before adding
+			 * @param offset Number of tracks in playlist before adding
+			 * @param track_uris URIs of tracks that were added
+			 * @param added Tracks fetched from offset
+			 * @param snapshot Snapshot after adding
+			 * @return Snapshot and tracks match, otherwise the playlist is marked as outdated
+			 */
+			static auto apply_add(lib::spt::playlist &playlist,
+				const std::string &initial, size_t offset,
+				const std::vector<std::string> &track_uris,
+				const std::vector<lib::spt::track> &added,
+				const std::string &snapshot) -> bool;
+
+			/**
+			 * Remove tracks from playlist
+			 * @param initial Snapshot of playlist before removing
+			 * @param track_index_uris Position and URI of each removed track
+			 * @param snapshot Snapshot after removing
+			 * @return Snapshot and tracks match, otherwise the playlist is marked as outdated
+			 */
+			static auto apply_remove(lib::spt::playlist &playlist,
+				const std::string &initial,
+				const std::vector<std::pair<int, std::string>> &track_index_uris,
+				const std::string &snapshot) -> bool;
+
+		private:
+			lib::spt::api &spotify;
+			lib::cache &cache;
+
+			/**
+			 * Apply remaining moves, starting from index
+			 * @param snapshot Snapshot after previous move
+			 * @param callback Final snapshot, or error message
+			 */
+			void move(const std::string &playlist_id,
+				const std::shared_ptr<std::vector<lib::spt::playlist_move>> &moves,
+				size_t index, const std::string &snapshot,
+				lib::callback<lib::result<std::string>> &callback);
+
+			/**
+			 * Save playlist, and its snapshot in list of playlists
+			 */
+			void save(const lib::spt::playlist &playlist);
+
+			/**
+			 * Mark playlist as outdated, so it's fetched again when synced or opened
+			 */
+			static void invalidate(lib::spt::playlist &playlist);
+		};
+	}
+}
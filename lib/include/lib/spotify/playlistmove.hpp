@@ -0,0 +1,88 @@
+#pragma once
+
+#include "thirdparty/json.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace lib
+{
+	namespace spt
+	{
+		/**
+		 * Move of a range of tracks within a playlist
+		 */
+		class playlist_move
+		{
+		public:
+			playlist_move() = default;
+
+			playlist_move(size_t range_start, size_t insert_before, size_t range_length);
+
+			/**
+			 * Position of first track to move
+			 */
+			size_t range_start = 0;
+
+			/**
+			 * Position to move tracks to, before the move
+			 */
+			size_t insert_before = 0;
+
+			/**
+			 * Number of tracks to move
+			 */
+			size_t range_length = 0;
+
+			/**
+			 * Order is a permutation of all positions
+			 */
+			static auto is_valid_order(const std::vector<size_t> &order) -> bool;
+
+			/**
+			 * Renumber positions from 0, keeping their order,
+			 * for example after tracks were removed
+			 * @param positions Unique positions, possibly with gaps
+			 * @return Order of positions, valid if positions are unique
+			 */
+			static auto to_order(const std::vector<size_t> &positions) -> std::vector<size_t>;
+
+			/**
+			 * Fewest moves to reorder tracks, where tracks in the longest
+			 * increasing subsequence stay in place, and everything else is moved
+			 * next to its new neighbour, in as few ranges as possible
+			 * @param order Current position of each track, in the new order
+			 * @return Moves to apply one after another, empty if already in order
+			 */
+			static auto from_order(const std::vector<size_t> &order) -> std::vector<playlist_move>;
+
+			/**
+			 * Apply move to items
+			 */
+			template<typename T>
+			void apply(std::vector<T> &items) const
+			{
+				const auto first = items.begin() + static_cast<long>(range_start);
+				const auto last = first + static_cast<long>(range_length);
+				const std::vector<T> range(first, last);
+				items.erase(first, last);
+
+				const auto before = insert_before > range_start
+					? insert_before - range_length
+					: insert_before;
+
+				items.insert(items.begin() + static_cast<long>(before),
+					range.cbegin(), range.cend());
+			}
+
+		private:
+			/**
+			 * Values in the longest strictly increasing subsequence
+			 * @return If value at each index is part of the subsequence
+			 */
+			static auto longest_increasing(const std::vector<size_t> &values) -> std::vector<bool>;
+		};
+
+		void to_json(nlohmann::json &j, const playlist_move &m);
+	}
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "lib/spotify/playlist.hpp"
+
+#include "thirdparty/json.hpp"
+
+#include <string>
+
+namespace lib
+{
+	namespace spt
+	{
+		/**
+		 * Summary of a cached playlist, without tracks
+		 */
+		class playlist_summary
+		{
+		public:
+			playlist_summary() = default;
+
+			/**
+			 * Summarize playlist
+			 */
+			explicit playlist_summary(const lib::spt::playlist &playlist);
+
+			/**
+			 * Playlist ID
+			 */
+			std::string id;
+
+			/**
+			 * ISO date of most recently added track, or empty if unknown
+			 */
+			std::string latest_added;
+
+			/**
+			 * Number of tracks
+			 */
+			size_t track_count = 0;
+
+			/**
+			 * Duration of all tracks in milliseconds
+			 */
+			long long duration = 0;
+
+			/**
+			 * Spotify ID of owner
+			 */
+			std::string owner_id;
+
+			/**
+			 * Snapshot ID
+			 */
+			std::string snapshot;
+
+			/**
+			 * No playlist is summarized
+			 */
+			auto is_null() const -> bool;
+		};
+
+		/**
+		 * Playlist summary -> JSON
+		 */
+		void to_json(nlohmann::json &j, const playlist_summary &p);
+
+		/**
+		 * JSON -> Playlist summary
+		 */
+		void from_json(const nlohmann::json &j, playlist_summary &p);
+	}
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "lib/asyncqueue.hpp"
+#include "lib/cache.hpp"
+#include "lib/spotify/api.hpp"
+
+#include <chrono>
+#include <unordered_map>
+
+namespace lib
+{
+	namespace spt
+	{
+		/**
+		 * Keeps cached playlists up-to-date in the background,
+		 * by only fetching tracks of playlists with a new snapshot
+		 */
+		class playlist_sync
+		{
+		public:
+			/**
+			 * Construct a new sync
+			 * @param max_running Max number of playlists to fetch at the same time
+			 * @param timeout Time before a fetch is assumed to have failed,
+			 * as failed requests never respond
+			 */
+			playlist_sync(lib::spt::api &spotify, lib::cache &cache, size_t max_running,
+				std::chrono::milliseconds timeout = std::chrono::minutes(5));
+
+			/**
+			 * Fetch tracks of all playlists where snapshot differs from cache
+			 * @param playlists Playlists with latest snapshot, tracks not required
+			 * @param callback Called for each updated playlist, after it's saved to cache
+			 */
+			void sync(const std::vector<lib::spt::playlist> &playlists,
+				lib::callback<lib::spt::playlist> &callback);
+
+			/**
+			 * Playlist has a different snapshot than the cached one
+			 * @param cached Summary of cached playlist, to not load all its tracks
+			 */
+			static auto is_changed(const lib::spt::playlist &playlist,
+				const lib::spt::playlist_summary &cached) -> bool;
+
+			/**
+			 * Finish jobs that have been fetching for too long,
+			 * letting queued ones start, and retrying them on the next sync
+			 * @note Also checked when syncing, but call periodically if syncing rarely
+			 */
+			void check_timeouts();
+
+			/**
+			 * Number of playlists queued or currently fetching
+			 */
+			auto remaining() const -> size_t;
+
+		private:
+			/**
+			 * A queued playlist
+			 */
+			class job
+			{
+			public:
+				/**
+				 * When fetching started, or not set if not yet started
+				 */
+				std::chrono::steady_clock::time_point started;
+
+				/**
+				 * Finish job, or not set if not yet started
+				 */
+				lib::async_queue::done done;
+
+				/**
+				 * Unique for each job, to ignore late responses from timed out jobs
+				 */
+				unsigned int generation = 0;
+			};
+
+			lib::spt::api &spotify;
+			lib::cache &cache;
+			lib::async_queue queue;
+			std::chrono::milliseconds timeout;
+
+			/**
+			 * Playlists queued or currently fetching, to avoid fetching twice
+			 */
+			std::unordered_map<std::string, job> jobs;
+
+			/**
+			 * Generation of last added job
+			 */
+			unsigned int generation = 0;
+		};
+	}
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "lib/asyncqueue.hpp"
+#include "lib/cache.hpp"
+#include "lib/spotify/api.hpp"
+
+#include <chrono>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace lib
+{
+	namespace spt
+	{
+		/**
+		 * Tracks from new releases by artists in library,
+		 * fetching all matching albums concurrently
+		 */
+		class release_feed
+		{
+		public:
+			/**
+			 * Cache entry for merged tracks
+			 */
+			static constexpr const char *cache_id = "new_releases";
+
+			/**
+			 * Construct a new feed
+			 * @param max_running Max number of albums to fetch at the same time,
+			 * also number of albums loaded between each callback
+			 * @param timeout Time before fetching an album is assumed to have failed,
+			 * as failed requests never respond
+			 */
+			release_feed(lib::spt::api &spotify, lib::cache &cache, size_t max_running,
+				std::chrono::milliseconds timeout = std::chrono::minutes(1));
+
+			/**
+			 * Load tracks of new releases, only fetched once per day
+			 * @param callback Called with all tracks loaded so far, after every few albums loaded,
+			 * and when all albums are loaded, after saving to cache
+			 */
+			void load(lib::callback<std::vector<lib::spt::track>> &callback);
+
+			/**
+			 * Skip albums that have been fetching for too long,
+			 * they're fetched again on the next load
+			 * @note Call periodically while loading
+			 */
+			void check_timeouts();
+
+			/**
+			 * Release matches an artist in library
+			 */
+			auto is_match(const lib::spt::album &album) const -> bool;
+
+			/**
+			 * Tracks of release, with release date as added date
+			 */
+			static auto album_tracks(const lib::spt::album &album,
+				const std::vector<lib::spt::track> &tracks) -> std::vector<lib::spt::track>;
+
+			/**
+			 * Merge tracks of all releases, newest release first
+			 * @param albums Tracks of each release, in order of releases
+			 */
+			static auto merge(const std::vector<std::vector<lib::spt::track>> &albums)
+			-> std::vector<lib::spt::track>;
+
+		private:
+			/**
+			 * A single load of all releases
+			 */
+			class state
+			{
+			public:
+				state(size_t max_running, std::string date,
+					lib::callback<std::vector<lib::spt::track>> &callback);
+
+				lib::async_queue queue;
+
+				/**
+				 * Date of load, in ISO format
+				 */
+				std::string date;
+
+				/**
+				 * Called with tracks loaded so far
+				 */
+				std::function<void(const std::vector<lib::spt::track> &)> callback;
+
+				/**
+				 * When fetching started, and how to finish it, for each release currently fetching
+				 */
+				std::map<size_t, std::pair<std::chrono::steady_clock::time_point,
+					lib::async_queue::done>> running;
+
+				/**
+				 * Tracks of each release, empty if not loaded yet
+				 */
+				std::vector<std::vector<lib::spt::track>> albums;
+
+				/**
+				 * Number of releases not yet loaded
+				 */
+				size_t remaining = 0;
+
+				/**
+				 * Number of releases loaded since last callback
+				 */
+				size_t since_callback = 0;
+
+				/**
+				 * Any release timed out, so load is incomplete
+				 */
+				bool timed_out = false;
+			};
+
+			lib::spt::api &spotify;
+			lib::cache &cache;
+			size_t max_running;
+			std::chrono::milliseconds timeout;
+
+			/**
+			 * Current load, previous loads are ignored
+			 */
+			std::shared_ptr<state> current;
+
+			/**
+			 * Date of last complete load, in ISO format
+			 */
+			std::string loaded_date;
+
+			/**
+			 * Tracks from last complete load
+			 */
+			std::vector<lib::spt::track> tracks;
+
+			/**
+			 * Start fetching tracks of matching releases
+			 */
+			void fetch(const std::vector<lib::spt::album> &releases,
+				const std::shared_ptr<state> &load);
+
+			/**
+			 * Tracks of release was loaded
+			 */
+			void loaded(const std::shared_ptr<state> &load, size_t index,
+				const std::vector<lib::spt::track> &album_tracks);
+		};
+	}
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "lib/cache.hpp"
+#include "lib/spotify/api.hpp"
+
+#include <string>
+#include <vector>
+
+namespace lib
+{
+	namespace spt
+	{
+		/**
+		 * Keeps cached saved tracks up-to-date by only fetching
+		 * tracks saved since the last sync
+		 */
+		class saved_tracks_sync
+		{
+		public:
+			/**
+			 * Result of merging fetched tracks with cached tracks
+			 */
+			enum class merge_result
+			{
+				/**
+				 * No fetched track is cached, fetch next page
+				 */
+				incomplete,
+
+				/**
+				 * Tracks merged
+				 */
+				merged,
+
+				/**
+				 * Number of merged tracks doesn't match total,
+				 * tracks were removed and all tracks need to be fetched again
+				 */
+				diverged,
+			};
+
+			/**
+			 * Cache entry for saved tracks
+			 */
+			static constexpr const char *cache_id = "liked_tracks";
+
+			saved_tracks_sync(lib::spt::api &spotify, lib::cache &cache);
+
+			/**
+			 * Fetch new saved tracks and save them to cache
+			 * @param callback All saved tracks, most recently saved first
+			 */
+			void sync(lib::callback<std::vector<lib::spt::track>> &callback);
+
+			/**
+			 * Merge newest tracks with cached tracks
+			 * @param cached Cached tracks, most recently saved first
+			 * @param fetched Fetched tracks, most recently saved first
+			 * @param total Total number of saved tracks
+			 * @param merged Merged tracks, if merged
+			 */
+			static auto merge(const std::vector<lib::spt::track> &cached,
+				const std::vector<lib::spt::track> &fetched, size_t total,
+				std::vector<lib::spt::track> &merged) -> merge_result;
+
+		private:
+			lib::spt::api &spotify;
+			lib::cache &cache;
+
+			/**
+			 * Fetch next page, until a cached track is found
+			 */
+			void fetch(const std::vector<lib::spt::track> &cached,
+				const std::vector<lib::spt::track> &fetched,
+				lib::callback<std::vector<lib::spt::track>> &callback);
+
+			/**
+			 * Fetch all saved tracks
+			 */
+			void fetch_all(lib::callback<std::vector<lib::spt::track>> &callback);
+
+			/**
+			 * Unique key for when a track was saved
+			 */
+			static auto key(const lib::spt::track &track) -> std::string;
+		};
+	}
+}
@@ -173,6 +173,15 @@ namespace lib
 		 */
 		static auto erase_non_alpha(const std::string &str) -> std::string;
 
+		/**
+		 * Get string in lowercase with common diacritics removed,
+		 * for example "Åsa Öst" becomes "asa ost"
+		 * @param str UTF-8 string to normalize
+		 * @return New normalized string
+		 * @note Only handles Latin-1 Supplement and Latin Extended-A
+		 */
+		static auto normalize(const std::string &str) -> std::string;
+
 	private:
 		/**
 		 * Trim beginning of string
@@ -0,0 +1,133 @@
+#pragma once
+
+#include "thirdparty/filesystem.hpp"
+#include "thirdparty/json.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace lib
+{
+	/**
+	 * Records where time is spent, as Chrome trace events,
+	 * that can be opened in chrome://tracing or Perfetto
+	 * @note Disabled by default, where spans only check if enabled
+	 */
+	class trace
+	{
+	public:
+		/**
+		 * Start recording
+		 */
+		static void start();
+
+		/**
+		 * Stop recording, keeping what's already recorded
+		 */
+		static void stop();
+
+		/**
+		 * Currently recording
+		 */
+		static auto is_enabled() -> bool
+		{
+			return enabled.load(std::memory_order_relaxed);
+		}
+
+		/**
+		 * Microseconds since tracing was first used, for timestamps
+		 */
+		static auto now() -> long long;
+
+		/**
+		 * Record something that started at a specific time, and ended now,
+		 * for example a request finished in a callback
+		 * @param started Timestamp from now()
+		 */
+		static void complete(const std::string &name, const std::string &category,
+			long long started);
+
+		/**
+		 * Set name of current thread, shown instead of its id
+		 */
+		static void set_thread_name(const std::string &name);
+
+		/**
+		 * All recorded events, in trace event format
+		 */
+		static auto to_json() -> nlohmann::json;
+
+		/**
+		 * Save recorded events
+		 * @return File was saved
+		 */
+		static auto save(const ghc::filesystem::path &path) -> bool;
+
+		/**
+		 * Remove all recorded events
+		 */
+		static void clear();
+
+	private:
+		/**
+		 * Static class
+		 */
+		trace() = default;
+
+		class event
+		{
+		public:
+			std::string name;
+			std::string category;
+			size_t thread_id;
+			long long timestamp;
+			long long duration;
+		};
+
+		class events
+		{
+		public:
+			std::mutex mutex;
+			std::vector<event> recorded;
+			std::vector<std::pair<size_t, std::string>> thread_names;
+		};
+
+		static std::atomic<bool> enabled;
+
+		static auto get_events() -> events &;
+
+		/**
+		 * Small id of the current thread
+		 */
+		static auto thread_id() -> size_t;
+	};
+
+	/**
+	 * Records time from creation until destruction, if tracing is enabled
+	 */
+	class trace_span
+	{
+	public:
+		/**
+		 * @param name Name of span, not copied unless tracing
+		 * @param category Category, like "app" or "cache"
+		 */
+		explicit trace_span(const char *name, const char *category = "app");
+
+		~trace_span();
+
+		trace_span(const trace_span &) = delete;
+		auto operator=(const trace_span &) -> trace_span & = delete;
+
+	private:
+		const char *name;
+		const char *category;
+
+		/**
+		 * Start time, or -1 if tracing wasn't enabled
+		 */
+		long long started;
+	};
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "lib/spotify/track.hpp"
+
+#include <string>
+#include <vector>
+
+namespace lib
+{
+	/**
+	 * Prebuilt search keys for a list of tracks,
+	 * for filtering tracks without formatting them for each query
+	 */
+	class track_index
+	{
+	public:
+		/**
+		 * Construct an empty index
+		 */
+		track_index() = default;
+
+		/**
+		 * Construct an index from tracks
+		 * @param tracks Tracks to index
+		 */
+		explicit track_index(const std::vector<lib::spt::track> &tracks);
+
+		/**
+		 * Replace all indexed tracks
+		 * @param tracks Tracks to index
+		 */
+		void set_tracks(const std::vector<lib::spt::track> &tracks);
+
+		/**
+		 * Number of indexed tracks
+		 */
+		auto size() const -> size_t;
+
+		/**
+		 * Find tracks where all words in query are found, allowing typos,
+		 * in either the name, artists or album of the track
+		 * @param query Query to filter by, case and diacritics are ignored
+		 * @return Indices of matching tracks, in ascending order
+		 */
+		auto filter(const std::string &query) const -> std::vector<size_t>;
+
+	private:
+		/**
+		 * Normalized name, artists and album of each track
+		 */
+		std::vector<std::string> keys;
+
+		/**
+		 * Get search key for a track
+		 */
+		static auto key(const lib::spt::track &track) -> std::string;
+	};
+}
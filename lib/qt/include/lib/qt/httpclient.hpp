@@ -35,6 +35,10 @@ namespace lib
 			void del(const std::string &url, const std::string &body, const lib::headers &headers,
 				lib::callback<std::string> &callback) const override;
 
+			void send(const std::string &method, const std::string &url,
+				const std::string &body, const lib::headers &headers,
+				lib::callback<lib::http_response> &callback) const override;
+
 		private:
 			QNetworkAccessManager *network_manager = nullptr;
 
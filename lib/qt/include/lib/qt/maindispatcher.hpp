@@ -0,0 +1,41 @@
+#pragma once
+
+#include "lib/executor.hpp"
+
+#include <QCoreApplication>
+#include <QEvent>
+#include <QObject>
+
+namespace lib
+{
+	namespace qt
+	{
+		/**
+		 * Runs tasks dispatched from workers on the main thread, using the event loop
+		 * @note Create on the main thread, set as dispatcher until destroyed
+		 */
+		class main_dispatcher: public QObject
+		{
+		public:
+			explicit main_dispatcher(QObject *parent);
+			~main_dispatcher() override;
+
+		protected:
+			auto event(QEvent *event) -> bool override;
+
+		private:
+			/**
+			 * Event holding a task to run
+			 */
+			class task_event: public QEvent
+			{
+			public:
+				explicit task_event(const lib::executor::task &task);
+
+				lib::executor::task task;
+			};
+
+			static auto event_type() -> QEvent::Type;
+		};
+	}
+}
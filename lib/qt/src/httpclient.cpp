@@ -26,17 +26,40 @@ auto lib::qt::http_client::request(const std::string &url,
 
 void lib::qt::http_client::await(QNetworkReply *reply, lib::callback<QByteArray> &callback) const
 {
+	const auto token = lib::cancel_token::current();
+	if (token.is_cancelled())
+	{
+		reply->abort();
+		reply->deleteLater();
+		return;
+	}
+
+	const auto abort_id = token.on_cancel([reply]()
+	{
+		reply->abort();
+	});
+
 	QNetworkReply::connect(reply, &QNetworkReply::finished, this,
-		[reply, callback]()
+		[reply, callback, token, abort_id]()
 		{
+			token.remove(abort_id);
+			reply->deleteLater();
+
+			// Owner is gone, so don't bother parsing response
+			if (token.is_cancelled())
+			{
+				return;
+			}
+
 			if (reply->error() != QNetworkReply::NoError)
 			{
 				lib::log::error("Request failed: {}",
 					reply->errorString().toStdString());
 			}
 
+			// Requests made when handling response belong to the same owner
+			lib::cancel_context context(token);
 			callback(reply->readAll());
-			reply->deleteLater();
 		});
 }
 
@@ -105,3 +128,30 @@ void lib::qt::http_client::del(const std::string &url, const std::string &body,
 			callback(data.toStdString());
 		});
 }
+
+void lib::qt::http_client::send(const std::string &method, const std::string &url,
+	const std::string &body, const lib::headers &headers,
+	lib::callback<lib::http_response> &callback) const
+{
+	auto data = body.empty()
+		? QByteArray()
+		: QByteArray::fromStdString(body);
+
+	// Not cancellable, as callers rely on always getting a response
+	auto *reply = network_manager->sendCustomRequest(request(url, headers),
+		QByteArray::fromStdString(method), data);
+
+	QNetworkReply::connect(reply, &QNetworkReply::finished, this,
+		[reply, callback]()
+		{
+			// Status is invalid, and 0, if no response was received
+			const auto status = reply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+			if (reply->error() != QNetworkReply::NoError)
+			{
+				lib::log::warn("Request failed: {}", reply->errorString().toStdString());
+			}
+
+			callback(lib::http_response(status, reply->readAll().toStdString()));
+			reply->deleteLater();
+		});
+}
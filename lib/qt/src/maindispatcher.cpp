@@ -0,0 +1,39 @@
+#include "lib/qt/maindispatcher.hpp"
+
+lib::qt::main_dispatcher::main_dispatcher(QObject *parent)
+	: QObject(parent)
+{
+	lib::executor::set_dispatcher([this](const lib::executor::task &task)
+	{
+		// Thread safe, and takes ownership of event
+		QCoreApplication::postEvent(this, new task_event(task));
+	});
+}
+
+lib::qt::main_dispatcher::~main_dispatcher()
+{
+	lib::executor::set_dispatcher({});
+}
+
+auto lib::qt::main_dispatcher::event(QEvent *event) -> bool
+{
+	if (event->type() != event_type())
+	{
+		return QObject::event(event);
+	}
+
+	static_cast<task_event *>(event)->task();
+	return true;
+}
+
+auto lib::qt::main_dispatcher::event_type() -> QEvent::Type
+{
+	static const auto type = static_cast<QEvent::Type>(QEvent::registerEventType());
+	return type;
+}
+
+lib::qt::main_dispatcher::task_event::task_event(const lib::executor::task &task)
+	: QEvent(event_type()),
+	task(task)
+{
+}
@@ -0,0 +1,52 @@
+#include "lib/asyncqueue.hpp"
+
+#include <memory>
+
+lib::async_queue::async_queue(size_t max_running)
+	: max_running(max_running)
+{
+}
+
+void lib::async_queue::add(const job &job)
+{
+	jobs.push_back(job);
+	start_next();
+}
+
+void lib::async_queue::clear()
+{
+	jobs.clear();
+}
+
+auto lib::async_queue::pending() const -> size_t
+{
+	return jobs.size();
+}
+
+auto lib::async_queue::running() const -> size_t
+{
+	return running_count;
+}
+
+void lib::async_queue::start_next()
+{
+	while (running_count < max_running && !jobs.empty())
+	{
+		const auto current = jobs.front();
+		jobs.pop_front();
+		running_count++;
+
+		const auto finished = std::make_shared<bool>(false);
+		current([this, finished]()
+		{
+			if (*finished)
+			{
+				return;
+			}
+
+			*finished = true;
+			running_count--;
+			start_next();
+		});
+	}
+}
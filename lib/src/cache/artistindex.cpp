@@ -0,0 +1,212 @@
+#include "lib/cache/artistindex.hpp"
+#include "lib/datetime.hpp"
+
+#include <algorithm>
+
+void lib::artist_index::set_tracks(const std::string &source_id,
+	const std::vector<lib::spt::track> &tracks)
+{
+	set_source(source_id, tracks);
+}
+
+void lib::artist_index::set_tracks(const std::map<std::string,
+	std::vector<lib::spt::track>> &tracks)
+{
+	for (const auto &source_tracks: tracks)
+	{
+		set_source(source_tracks.first, source_tracks.second);
+	}
+}
+
+void lib::artist_index::set_source(const std::string &source_id,
+	const std::vector<lib::spt::track> &tracks)
+{
+	source artists_in_source;
+	for (const auto &track: tracks)
+	{
+		for (const auto &artist: track.artists)
+		{
+			if (artist.name.empty())
+			{
+				continue;
+			}
+
+			auto &summary = artists_in_source[artist.name];
+			summary.name = artist.name;
+			summary.id = artist.id;
+			summary.sources = 1;
+			summary.tracks++;
+
+			if (lib::date_time::is_later(track.added_at, summary.last_added))
+			{
+				summary.last_added = track.added_at;
+			}
+		}
+	}
+
+	remove_source(source_id);
+
+	apply(artists_in_source, true);
+	sources[source_id] = std::move(artists_in_source);
+}
+
+void lib::artist_index::remove(const std::string &source_id)
+{
+	remove_source(source_id);
+}
+
+auto lib::artist_index::remove_source(const std::string &source_id) -> bool
+{
+	const auto existing = sources.find(source_id);
+	if (existing == sources.end())
+	{
+		return false;
+	}
+
+	// Removed before applying, so it's not included when finding last added
+	const auto removed = std::move(existing->second);
+	sources.erase(existing);
+	apply(removed, false);
+	return true;
+}
+
+auto lib::artist_index::get(const std::string &name) const -> lib::spt::artist_summary
+{
+	const auto artist = artists.find(name);
+	return artist == artists.end()
+		? lib::spt::artist_summary()
+		: artist->second;
+}
+
+auto lib::artist_index::contains(const std::string &name) const -> bool
+{
+	return artists.find(name) != artists.end();
+}
+
+auto lib::artist_index::top(size_t limit) const -> std::vector<lib::spt::artist_summary>
+{
+	std::vector<lib::spt::artist_summary> results;
+	results.reserve(artists.size());
+	for (const auto &artist: artists)
+	{
+		results.push_back(artist.second);
+	}
+
+	const auto count = std::min(limit, results.size());
+	std::partial_sort(results.begin(), results.begin() + static_cast<std::ptrdiff_t>(count),
+		results.end(), [](const lib::spt::artist_summary &artist1,
+			const lib::spt::artist_summary &artist2) -> bool
+		{
+			return artist1.score() > artist2.score();
+		});
+
+	results.resize(count);
+	return results;
+}
+
+auto lib::artist_index::is_empty() const -> bool
+{
+	return sources.empty();
+}
+
+auto lib::artist_index::source_ids() const -> std::vector<std::string>
+{
+	std::vector<std::string> ids;
+	ids.reserve(sources.size());
+
+	for (const auto &artists_in_source: sources)
+	{
+		ids.push_back(artists_in_source.first);
+	}
+	return ids;
+}
+
+void lib::artist_index::apply(const source &artists_in_source, bool add)
+{
+	for (const auto &artist_in_source: artists_in_source)
+	{
+		const auto &summary = artist_in_source.second;
+		auto &artist = artists[summary.name];
+
+		if (add)
+		{
+			artist.name = summary.name;
+			if (artist.id.empty())
+			{
+				artist.id = summary.id;
+			}
+			artist.sources++;
+			artist.tracks += summary.tracks;
+			if (lib::date_time::is_later(summary.last_added, artist.last_added))
+			{
+				artist.last_added = summary.last_added;
+			}
+			continue;
+		}
+
+		artist.sources--;
+		artist.tracks -= summary.tracks;
+
+		if (artist.sources == 0)
+		{
+			artists.erase(summary.name);
+		}
+		else if (summary.last_added == artist.last_added)
+		{
+			artist.last_added = last_added(summary.name);
+		}
+	}
+}
+
+auto lib::artist_index::last_added(const std::string &name) const -> std::string
+{
+	std::string latest;
+	for (const auto &artists_in_source: sources)
+	{
+		const auto artist = artists_in_source.second.find(name);
+		if (artist != artists_in_source.second.end()
+			&& lib::date_time::is_later(artist->second.last_added, latest))
+		{
+			latest = artist->second.last_added;
+		}
+	}
+	return latest;
+}
+
+void lib::to_json(nlohmann::json &j, const artist_index &index)
+{
+	j = nlohmann::json::object();
+
+	for (const auto &artists_in_source: index.sources)
+	{
+		auto &artists = j[artists_in_source.first];
+		artists = nlohmann::json::array();
+
+		for (const auto &artist: artists_in_source.second)
+		{
+			artists.push_back(artist.second);
+		}
+	}
+}
+
+void lib::from_json(const nlohmann::json &j, artist_index &index)
+{
+	index = lib::artist_index();
+	if (!j.is_object())
+	{
+		return;
+	}
+
+	for (const auto &artists_in_source: j.items())
+	{
+		lib::artist_index::source source;
+		for (const auto &artist: artists_in_source.value())
+		{
+			auto summary = artist.get<lib::spt::artist_summary>();
+			source[summary.name] = summary;
+		}
+
+		index.apply(source, true);
+		index.sources[artists_in_source.key()] = std::move(source);
+	}
+}
@@ -1,11 +1,22 @@
 
 #include "lib/cache/jsoncache.hpp"
+#include "lib/parallel.hpp"
+#include "lib/trace.hpp"
+
+#include <set>
 
 lib::json_cache::json_cache(const lib::paths &paths)
 	: paths(paths)
 {
 }
 
+lib::json_cache::~json_cache()
+{
+	save_index();
+	save_artists();
+	save_summaries();
+}
+
 //region album
 
 auto lib::json_cache::get_album_image(const std::string &url) const -> std::vector<unsigned char>
@@ -38,6 +49,8 @@ void lib::json_cache::set_album_image(const std::string &url,
 
 auto lib::json_cache::get_album(const std::string &album_id) const -> lib::spt::album
 {
+	lib::trace_span span("json_cache::get_album", "cache");
+
 	try
 	{
 		return lib::json::load(path("albuminfo", album_id, "json"));
@@ -61,6 +74,8 @@ void lib::json_cache::set_album(const lib::spt::album &album)
 
 auto lib::json_cache::get_playlists() const -> std::vector<lib::spt::playlist>
 {
+	lib::trace_span span("json_cache::get_playlists", "cache");
+
 	try
 	{
 		return json::load(path("playlist", "playlists", "json"));
@@ -76,6 +91,9 @@ auto lib::json_cache::get_playlists() const -> std::vector<lib::spt::playlist>
 void lib::json_cache::set_playlists(const std::vector<spt::playlist> &playlists)
 {
 	lib::json::save(path("playlist", "playlists", "json"), playlists);
+
+	// Saved together with the list, instead of after every single playlist
+	save_summaries();
 }
 
 //endregion
@@ -84,6 +102,8 @@ void lib::json_cache::set_playlists(const std::vector<spt::playlist> &playlists)
 
 auto lib::json_cache::get_playlist(const std::string &playlist_id) const -> lib::spt::playlist
 {
+	lib::trace_span span("json_cache::get_playlist", "cache");
+
 	try
 	{
 		return json::load(path("playlist", playlist_id, "json"));
@@ -98,7 +118,100 @@ auto lib::json_cache::get_playlist(const std::string &playlist_id) const -> lib:
 
 void lib::json_cache::set_playlist(const spt::playlist &playlist)
 {
-	lib::json::save(path("playlist", playlist.id, "json"), playlist);
+	{
+		// Saved while locked, so indices are never saved before they're updated
+		std::lock_guard<std::mutex> index_lock(index_mutex);
+		std::lock_guard<std::mutex> artists_lock(artists_mutex);
+		lib::json::save(path("playlist", playlist.id, "json"), playlist);
+
+		if (index_loaded)
+		{
+			index.set_tracks(playlist.id, playlist.tracks);
+			index_changed = true;
+		}
+		if (artists_loaded)
+		{
+			artists.set_tracks(playlist.id, playlist.tracks);
+			artists_changed = true;
+		}
+	}
+
+	load_summaries();
+	summaries[playlist.id] = lib::spt::playlist_summary(playlist);
+	summaries_changed = true;
+}
+
+auto lib::json_cache::get_playlist_summary(const std::string &playlist_id) const
+-> lib::spt::playlist_summary
+{
+	load_summaries();
+
+	const auto summary = summaries.find(playlist_id);
+	return summary == summaries.end()
+		? lib::spt::playlist_summary()
+		: summary->second;
+}
+
+auto lib::json_cache::get_playlist_summaries() const
+-> std::map<std::string, lib::spt::playlist_summary>
+{
+	load_summaries();
+	return summaries;
+}
+
+void lib::json_cache::load_summaries() const
+{
+	if (summaries_loaded)
+	{
+		return;
+	}
+	summaries_loaded = true;
+
+	lib::trace_span span("json_cache::load_summaries", "cache");
+
+	const auto summaries_path = ghc::filesystem::path(path("summary", "playlists", "json"));
+	const auto saved = modified_time(summaries_path);
+	summaries = lib::json::load<std::map<std::string,
+		lib::spt::playlist_summary>>(summaries_path);
+
+	// Summarize playlists cached since saved, like when closing unexpectedly,
+	// or all of them if never saved
+	const auto playlist_dir = paths.cache() / "playlist";
+	if (!ghc::filesystem::exists(playlist_dir))
+	{
+		return;
+	}
+
+	for (const auto &entry: ghc::filesystem::directory_iterator(playlist_dir))
+	{
+		if (entry.path().stem() == "playlists")
+		{
+			continue;
+		}
+
+		if (modified_time(entry.path()) < saved)
+		{
+			continue;
+		}
+
+		const auto playlist = get_playlist(entry.path().stem().string());
+		if (!playlist.is_null())
+		{
+			summaries[playlist.id] = lib::spt::playlist_summary(playlist);
+			summaries_changed = true;
+		}
+	}
+}
+
+void lib::json_cache::save_summaries()
+{
+	if (!summaries_changed)
+	{
+		return;
+	}
+
+	lib::json::save(path("summary", "playlists", "json"), summaries);
+	summaries_changed = false;
 }
 
 //endregion
@@ -107,6 +220,8 @@ void lib::json_cache::set_playlist(const spt::playlist &playlist)
 
 auto lib::json_cache::get_tracks(const std::string &entity_id) const -> std::vector<lib::spt::track>
 {
+	lib::trace_span span("json_cache::get_tracks", "cache");
+
 	const auto tracks_path = path("tracks", entity_id, "json");
 	return lib::json::load<std::vector<lib::spt::track>>(tracks_path);
 }
@@ -114,11 +229,26 @@ auto lib::json_cache::get_tracks(const std::string &entity_id) const -> std::vec
 void lib::json_cache::set_tracks(const std::string &entity_id,
 	const std::vector<lib::spt::track> &tracks)
 {
+	std::lock_guard<std::mutex> index_lock(index_mutex);
+	std::lock_guard<std::mutex> artists_lock(artists_mutex);
 	lib::json::save(path("tracks", entity_id, "json"), tracks);
+
+	if (index_loaded)
+	{
+		index.set_tracks(entity_id, tracks);
+		index_changed = true;
+	}
+	if (artists_loaded && is_artist_source(entity_id))
+	{
+		artists.set_tracks(entity_id, tracks);
+		artists_changed = true;
+	}
 }
 
 auto lib::json_cache::all_tracks() const -> std::map<std::string, std::vector<lib::spt::track>>
 {
+	lib::trace_span span("json_cache::all_tracks", "cache");
+
 	auto dir = paths.cache() / "tracks";
 	std::map<std::string, std::vector<lib::spt::track>> results;
 
@@ -127,10 +257,25 @@ auto lib::json_cache::all_tracks() const -> std::map<std::string, std::vector<li
 		return results;
 	}
 
+	std::vector<std::string> entity_ids;
 	for (const auto &entry: ghc::filesystem::directory_iterator(dir))
 	{
-		auto entity_id = entry.path().filename().replace_extension().string();
-		results[entity_id] = get_tracks(entity_id);
+		entity_ids.push_back(entry.path().filename().replace_extension().string());
+	}
+
+	std::vector<std::vector<lib::spt::track>> tracks(entity_ids.size());
+	lib::parallel::for_range(lib::executor::shared(), entity_ids.size(), 1,
+		[this, &entity_ids, &tracks](size_t begin, size_t end)
+		{
+			for (auto i = begin; i < end; i++)
+			{
+				tracks[i] = get_tracks(entity_ids[i]);
+			}
+		});
+
+	for (size_t i = 0; i < entity_ids.size(); i++)
+	{
+		results[entity_ids[i]] = tracks[i];
 	}
 
 	return results;
@@ -138,6 +283,191 @@ auto lib::json_cache::all_tracks() const -> std::map<std::string, std::vector<li
 
 //endregion
 
+//region search
+
+auto lib::json_cache::search(const std::string &query) const -> lib::spt::search_results
+{
+	std::lock_guard<std::mutex> lock(index_mutex);
+	load_index();
+	return index.search(query, search_limit);
+}
+
+void lib::json_cache::load_index() const
+{
+	if (index_loaded)
+	{
+		return;
+	}
+	index_loaded = true;
+
+	lib::trace_span span("json_cache::load_index", "cache");
+
+	// Anything cached after index was saved, like when closing unexpectedly, is added again
+	const auto index_path = ghc::filesystem::path(path("index", "search", "json"));
+	const auto saved = modified_time(index_path);
+	index = lib::json::load<lib::search_index>(index_path);
+
+	index_changed = update_sources(saved, index.source_ids(),
+		[this](const std::string &source_id, const std::vector<lib::spt::track> &tracks)
+		{
+			index.set_tracks(source_id, tracks);
+		},
+		[this](const std::string &source_id)
+		{
+			index.remove(source_id);
+		});
+}
+
+void lib::json_cache::save_index()
+{
+	std::lock_guard<std::mutex> lock(index_mutex);
+	if (!index_changed)
+	{
+		return;
+	}
+
+	lib::trace_span span("json_cache::save_index", "cache");
+	lib::json::save(path("index", "search", "json"), index);
+	index_changed = false;
+}
+
+auto lib::json_cache::update_sources(ghc::filesystem::file_time_type since,
+	const std::vector<std::string> &source_ids,
+	const std::function<void(const std::string &,
+		const std::vector<lib::spt::track> &)> &set,
+	const std::function<void(const std::string &)> &remove) const -> bool
+{
+	// Source ID, and if it's a playlist, for each file modified since
+	std::vector<std::pair<std::string, bool>> modified;
+	std::set<std::string> cached;
+
+	for (const auto &type: {"tracks", "playlist"})
+	{
+		const auto type_dir = paths.cache() / type;
+		if (!ghc::filesystem::exists(type_dir))
+		{
+			continue;
+		}
+
+		const auto is_playlist = std::string(type) == "playlist";
+		for (const auto &entry: ghc::filesystem::directory_iterator(type_dir))
+		{
+			const auto source_id = entry.path().stem().string();
+
+			// List of all playlists, without tracks
+			if (is_playlist && source_id == "playlists")
+			{
+				continue;
+			}
+
+			cached.insert(source_id);
+
+			if (modified_time(entry.path()) >= since)
+			{
+				modified.emplace_back(source_id, is_playlist);
+			}
+		}
+	}
+
+	std::vector<std::vector<lib::spt::track>> tracks(modified.size());
+	lib::parallel::for_range(lib::executor::shared(), modified.size(), 1,
+		[this, &modified, &tracks](size_t begin, size_t end)
+		{
+			for (auto i = begin; i < end; i++)
+			{
+				tracks[i] = modified[i].second
+					? get_playlist(modified[i].first).tracks
+					: get_tracks(modified[i].first);
+			}
+		});
+
+	for (size_t i = 0; i < modified.size(); i++)
+	{
+		set(modified[i].first, tracks[i]);
+	}
+
+	auto changed = !modified.empty();
+	for (const auto &source_id: source_ids)
+	{
+		if (cached.find(source_id) == cached.end())
+		{
+			remove(source_id);
+			changed = true;
+		}
+	}
+
+	return changed;
+}
+
+//endregion
+
+//region artists
+
+auto lib::json_cache::get_artist_summary(const std::string &artist_name) const
+-> lib::spt::artist_summary
+{
+	std::lock_guard<std::mutex> lock(artists_mutex);
+	load_artists();
+	return artists.get(artist_name);
+}
+
+auto lib::json_cache::get_top_artists(size_t limit) const
+-> std::vector<lib::spt::artist_summary>
+{
+	std::lock_guard<std::mutex> lock(artists_mutex);
+	load_artists();
+	return artists.top(limit);
+}
+
+void lib::json_cache::load_artists() const
+{
+	if (artists_loaded)
+	{
+		return;
+	}
+	artists_loaded = true;
+
+	lib::trace_span span("json_cache::load_artists", "cache");
+
+	const auto artists_path = ghc::filesystem::path(path("summary", "artists", "json"));
+	const auto saved = modified_time(artists_path);
+	artists = lib::json::load<lib::artist_index>(artists_path);
+
+	artists_changed = update_sources(saved, artists.source_ids(),
+		[this](const std::string &source_id, const std::vector<lib::spt::track> &tracks)
+		{
+			if (is_artist_source(source_id))
+			{
+				artists.set_tracks(source_id, tracks);
+			}
+		},
+		[this](const std::string &source_id)
+		{
+			artists.remove(source_id);
+		});
+}
+
+void lib::json_cache::save_artists()
+{
+	std::lock_guard<std::mutex> lock(artists_mutex);
+	if (!artists_changed)
+	{
+		return;
+	}
+
+	lib::trace_span span("json_cache::save_artists", "cache");
+	lib::json::save(path("summary", "artists", "json"), artists);
+	artists_changed = false;
+}
+
+auto lib::json_cache::is_artist_source(const std::string &entity_id) -> bool
+{
+	// New releases are picked by artist, so counting them would only reinforce itself
+	return entity_id != "new_releases";
+}
+
+//endregion
+
 //region lyrics
 
 auto lib::json_cache::get_track_info(const lib::spt::track &track) const -> lib::spt::track_info
@@ -209,6 +539,16 @@ auto lib::json_cache::path(const std::string &type, const std::string &entity_id
 	return (dir(type) / file(entity_id, extension)).string();
 }
 
+auto lib::json_cache::modified_time(const ghc::filesystem::path &path)
+-> ghc::filesystem::file_time_type
+{
+	std::error_code error;
+	const auto time = ghc::filesystem::last_write_time(path, error);
+	return error
+		? ghc::filesystem::file_time_type::min()
+		: time;
+}
+
 auto lib::json_cache::get_url_id(const ghc::filesystem::path &path) -> std::string
 {
 	return path.stem().string();
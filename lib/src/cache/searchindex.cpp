@@ -0,0 +1,501 @@
+#include "lib/cache/searchindex.hpp"
+#include "lib/json.hpp"
+#include "lib/strings.hpp"
+
+void lib::search_index::set_tracks(const std::string &source_id,
+	const std::vector<lib::spt::track> &source_tracks)
+{
+	remove_source(source_id);
+	add_source(source_id, source_tracks);
+}
+
+void lib::search_index::remove(const std::string &source_id)
+{
+	remove_source(source_id);
+}
+
+auto lib::search_index::search(const std::string &query,
+	size_t limit) -> lib::spt::search_results
+{
+	lib::spt::search_results results;
+	const auto words = split_words(lib::strings::normalize(query));
+	if (words.empty())
+	{
+		return results;
+	}
+
+	auto matching = candidates(words.front());
+	for (auto word = std::next(words.cbegin()); word != words.cend(); ++word)
+	{
+		const auto next = candidates(*word);
+		std::vector<size_t> intersection;
+		std::set_intersection(matching.cbegin(), matching.cend(),
+			next.cbegin(), next.cend(), std::back_inserter(intersection));
+		matching = std::move(intersection);
+	}
+
+	std::vector<std::pair<int, const track_entry *>> matches;
+	for (const auto index: matching)
+	{
+		const auto &entry = tracks[index];
+		if (entry.refs == 0)
+		{
+			continue;
+		}
+
+		const auto score = entry_score(words, {
+			{&entry.name, 4},
+			{&entry.artists, 3},
+			{&entry.album, 2},
+		});
+
+		if (score > 0)
+		{
+			matches.emplace_back(score, &entry);
+		}
+	}
+
+	// Nothing found, try again allowing typos
+	const lib::fuzzy matcher(query);
+	if (matches.empty())
+	{
+		for (const auto &match: matcher.filter(keys))
+		{
+			const auto &entry = tracks[match.first];
+			if (entry.refs > 0)
+			{
+				matches.emplace_back(match.second, &entry);
+			}
+		}
+	}
+
+	sort_matches(matches);
+	for (size_t i = 0; i < matches.size() && i < limit; i++)
+	{
+		results.tracks.push_back(matches[i].second->track);
+	}
+
+	results.albums = search_entities(albums, words, matcher,
+		limit, &album_entry::album);
+
+	results.artists = search_entities(artists, words, matcher,
+		limit, &artist_entry::artist);
+
+	return results;
+}
+
+auto lib::search_index::is_empty() const -> bool
+{
+	return sources.empty();
+}
+
+auto lib::search_index::size() const -> size_t
+{
+	return tracks.size() - removed_count;
+}
+
+auto lib::search_index::source_ids() const -> std::vector<std::string>
+{
+	std::vector<std::string> ids;
+	ids.reserve(sources.size());
+
+	for (const auto &source: sources)
+	{
+		ids.push_back(source.first);
+	}
+	return ids;
+}
+
+void lib::search_index::add_source(const std::string &source_id,
+	const std::vector<lib::spt::track> &source_tracks)
+{
+	auto &indices = sources[source_id];
+	indices.reserve(source_tracks.size());
+
+	for (const auto &track: source_tracks)
+	{
+		// Tracks without ID, like local tracks, can't be used anyway
+		if (track.id.empty())
+		{
+			continue;
+		}
+		indices.push_back(add_track(track));
+	}
+}
+
+void lib::search_index::remove_source(const std::string &source_id)
+{
+	const auto source = sources.find(source_id);
+	if (source == sources.end())
+	{
+		return;
+	}
+
+	for (const auto index: source->second)
+	{
+		auto &entry = tracks[index];
+		if (entry.refs == 0)
+		{
+			continue;
+		}
+
+		entry.refs--;
+		if (entry.refs == 0)
+		{
+			removed_count++;
+			update_entities(entry.track, false);
+		}
+	}
+
+	sources.erase(source);
+
+	if (removed_count >= min_compact_count
+		&& removed_count > tracks.size() / 2)
+	{
+		compact();
+	}
+}
+
+auto lib::search_index::add_track(const lib::spt::track &track) -> size_t
+{
+	const auto existing = track_ids.find(track.id);
+	if (existing != track_ids.end())
+	{
+		auto &entry = tracks[existing->second];
+		if (entry.refs == 0)
+		{
+			removed_count--;
+			update_entities(entry.track, true);
+		}
+		entry.refs++;
+		return existing->second;
+	}
+
+	track_entry entry;
+	entry.refs = 1;
+	entry.track = track;
+	entry.track.images.clear();
+	entry.name = lib::strings::normalize(track.name);
+	entry.artists = lib::strings::normalize(lib::spt::entity::combine_names(track.artists, "\n"));
+	entry.album = lib::strings::normalize(track.album.name);
+
+	const auto index = tracks.size();
+	keys.push_back(lib::fmt::format("{}\n{}\n{}", entry.name, entry.artists, entry.album));
+	tracks.push_back(std::move(entry));
+	track_ids[track.id] = index;
+
+	add_postings(index);
+	update_entities(track, true);
+
+	return index;
+}
+
+void lib::search_index::add_postings(size_t index)
+{
+	auto add = [index](std::vector<size_t> &postings)
+	{
+		// Indices are always added in order, so this keeps them sorted and unique
+		if (postings.empty() || postings.back() != index)
+		{
+			postings.push_back(index);
+		}
+	};
+
+	const auto &entry = tracks[index];
+	for (const auto *field: {&entry.name, &entry.artists, &entry.album})
+	{
+		for (const auto &word: split_words(*field))
+		{
+			add(tokens[word]);
+
+			for (size_t i = 0; i + gram_size <= word.size(); i++)
+			{
+				add(trigrams[word.substr(i, gram_size)]);
+			}
+		}
+	}
+}
+
+void lib::search_index::compact()
+{
+	std::vector<size_t> new_indices(tracks.size(), tracks.size());
+	std::vector<track_entry> entries;
+	std::vector<std::string> entry_keys;
+	entries.reserve(tracks.size() - removed_count);
+	entry_keys.reserve(tracks.size() - removed_count);
+
+	for (size_t i = 0; i < tracks.size(); i++)
+	{
+		if (tracks[i].refs > 0)
+		{
+			new_indices[i] = entries.size();
+			entries.push_back(std::move(tracks[i]));
+			entry_keys.push_back(std::move(keys[i]));
+		}
+	}
+
+	tracks = std::move(entries);
+	keys = std::move(entry_keys);
+	track_ids.clear();
+	tokens.clear();
+	trigrams.clear();
+	removed_count = 0;
+
+	for (size_t i = 0; i < tracks.size(); i++)
+	{
+		track_ids[tracks[i].track.id] = i;
+		add_postings(i);
+	}
+
+	for (auto &source: sources)
+	{
+		for (auto &index: source.second)
+		{
+			index = new_indices[index];
+		}
+	}
+
+	for (auto iter = albums.begin(); iter != albums.end();)
+	{
+		iter = iter->second.refs == 0 ? albums.erase(iter) : std::next(iter);
+	}
+
+	for (auto iter = artists.begin(); iter != artists.end();)
+	{
+		iter = iter->second.refs == 0 ? artists.erase(iter) : std::next(iter);
+	}
+}
+
+auto lib::search_index::candidates(const std::string &word) const -> std::vector<size_t>
+{
+	std::vector<size_t> results;
+
+	// Too short for trigrams, use all words starting with it instead
+	if (word.size() < gram_size)
+	{
+		for (auto token = tokens.lower_bound(word);
+			token != tokens.end() && lib::strings::starts_with(token->first, word);
+			++token)
+		{
+			lib::vector::append(results, token->second);
+		}
+
+		std::sort(results.begin(), results.end());
+		results.erase(std::unique(results.begin(), results.end()), results.end());
+		return results;
+	}
+
+	std::vector<const std::vector<size_t> *> postings;
+	for (size_t i = 0; i + gram_size <= word.size(); i++)
+	{
+		const auto trigram = trigrams.find(word.substr(i, gram_size));
+		if (trigram == trigrams.end())
+		{
+			return results;
+		}
+		postings.push_back(&trigram->second);
+	}
+
+	// Start with the smallest list to keep intersections small
+	std::sort(postings.begin(), postings.end(),
+		[](const std::vector<size_t> *postings1, const std::vector<size_t> *postings2) -> bool
+		{
+			return postings1->size() < postings2->size();
+		});
+
+	results = *postings.front();
+	for (auto current = std::next(postings.cbegin()); current != postings.cend(); ++current)
+	{
+		std::vector<size_t> intersection;
+		std::set_intersection(results.cbegin(), results.cend(),
+			(*current)->cbegin(), (*current)->cend(), std::back_inserter(intersection));
+		results = std::move(intersection);
+	}
+
+	return results;
+}
+
+auto lib::search_index::is_word_char(char chr) -> bool
+{
+	const auto value = static_cast<unsigned char>(chr);
+	return value >= 0x80 || std::isalnum(value) != 0;
+}
+
+auto lib::search_index::split_words(const std::string &str) -> std::vector<std::string>
+{
+	std::vector<std::string> words;
+	std::string word;
+
+	for (const auto chr: str)
+	{
+		if (is_word_char(chr))
+		{
+			word.push_back(chr);
+		}
+		else if (!word.empty())
+		{
+			words.push_back(word);
+			word.clear();
+		}
+	}
+
+	if (!word.empty())
+	{
+		words.push_back(word);
+	}
+
+	return words;
+}
+
+auto lib::search_index::match_score(const std::string &str, const std::string &word) -> int
+{
+	constexpr int whole_word = 3;
+	constexpr int word_start = 2;
+	constexpr int anywhere = 1;
+
+	auto best = 0;
+	for (auto pos = str.find(word); pos != std::string::npos; pos = str.find(word, pos + 1))
+	{
+		const auto end = pos + word.size();
+		const auto starts = pos == 0 || !is_word_char(str[pos - 1]);
+		const auto ends = end == str.size() || !is_word_char(str[end]);
+
+		best = std::max(best, starts
+			? ends ? whole_word : word_start
+			: anywhere);
+
+		if (best == whole_word)
+		{
+			break;
+		}
+	}
+
+	return best;
+}
+
+auto lib::search_index::entry_score(const std::vector<std::string> &words,
+	const std::vector<std::pair<const std::string *, int>> &fields) -> int
+{
+	auto total = 0;
+
+	for (const auto &word: words)
+	{
+		auto best = 0;
+		for (const auto &field: fields)
+		{
+			best = std::max(best, match_score(*field.first, word) * field.second);
+		}
+
+		if (best == 0)
+		{
+			return 0;
+		}
+		total += best;
+	}
+
+	return total;
+}
+
+void lib::search_index::update_entities(const lib::spt::track &track, bool add)
+{
+	auto update = [add](entry &entry) -> bool
+	{
+		if (add)
+		{
+			return entry.refs++ == 0;
+		}
+
+		if (entry.refs > 0)
+		{
+			entry.refs--;
+		}
+		return false;
+	};
+
+	if (!track.album.id.empty())
+	{
+		auto &album = albums[track.album.id];
+		if (update(album))
+		{
+			album.album.id = track.album.id;
+			album.album.name = track.album.name;
+			album.album.artist = track.artists.empty()
+				? std::string()
+				: track.artists.front().name;
+			album.name = lib::strings::normalize(track.album.name);
+		}
+	}
+
+	for (const auto &track_artist: track.artists)
+	{
+		if (track_artist.id.empty())
+		{
+			continue;
+		}
+
+		auto &artist = artists[track_artist.id];
+		if (update(artist))
+		{
+			artist.artist.id = track_artist.id;
+			artist.artist.name = track_artist.name;
+			artist.name = lib::strings::normalize(track_artist.name);
+		}
+	}
+}
+
+void lib::to_json(nlohmann::json &j, const search_index &index)
+{
+	// Removed tracks are skipped, so positions are different from in memory
+	std::vector<size_t> positions(index.tracks.size());
+	nlohmann::json tracks = nlohmann::json::array();
+
+	for (size_t i = 0; i < index.tracks.size(); i++)
+	{
+		if (index.tracks[i].refs > 0)
+		{
+			positions[i] = tracks.size();
+			tracks.push_back(index.tracks[i].track);
+		}
+	}
+
+	nlohmann::json sources = nlohmann::json::object();
+	for (const auto &source: index.sources)
+	{
+		auto &source_positions = sources[source.first];
+		source_positions = nlohmann::json::array();
+
+		for (const auto track_index: source.second)
+		{
+			source_positions.push_back(positions[track_index]);
+		}
+	}
+
+	j = nlohmann::json{
+		{"tracks", tracks},
+		{"sources", sources},
+	};
+}
+
+void lib::from_json(const nlohmann::json &j, search_index &index)
+{
+	index = lib::search_index();
+	if (!j.is_object())
+	{
+		return;
+	}
+
+	const auto tracks = j.at("tracks").get<std::vector<lib::spt::track>>();
+
+	for (const auto &source: j.at("sources").items())
+	{
+		std::vector<lib::spt::track> source_tracks;
+		source_tracks.reserve(source.value().size());
+
+		for (const auto &position: source.value())
+		{
+			source_tracks.push_back(tracks.at(position.get<size_t>()));
+		}
+
+		index.add_source(source.key(), source_tracks);
+	}
+}
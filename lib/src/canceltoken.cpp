@@ -0,0 +1,100 @@
+#include "lib/canceltoken.hpp"
+
+thread_local lib::cancel_token lib::cancel_token::active;
+
+//region cancel_token
+
+lib::cancel_token::cancel_token(const std::shared_ptr<state> &shared)
+	: shared(shared)
+{
+}
+
+auto lib::cancel_token::is_cancelled() const -> bool
+{
+	return shared && shared->cancelled;
+}
+
+auto lib::cancel_token::on_cancel(const std::function<void()> &callback) const -> size_t
+{
+	if (!shared)
+	{
+		return 0;
+	}
+
+	if (shared->cancelled)
+	{
+		callback();
+		return 0;
+	}
+
+	const auto id = shared->next_id++;
+	shared->callbacks[id] = callback;
+	return id;
+}
+
+void lib::cancel_token::remove(size_t id) const
+{
+	if (shared)
+	{
+		shared->callbacks.erase(id);
+	}
+}
+
+auto lib::cancel_token::current() -> cancel_token
+{
+	return active;
+}
+
+//endregion
+
+//region cancel_scope
+
+lib::cancel_scope::cancel_scope()
+	: shared(std::make_shared<cancel_token::state>())
+{
+}
+
+lib::cancel_scope::~cancel_scope()
+{
+	cancel();
+}
+
+auto lib::cancel_scope::token() const -> cancel_token
+{
+	return cancel_token(shared);
+}
+
+void lib::cancel_scope::cancel()
+{
+	if (shared->cancelled)
+	{
+		return;
+	}
+	shared->cancelled = true;
+
+	// Callbacks may remove themselves while called
+	std::map<size_t, std::function<void()>> callbacks;
+	callbacks.swap(shared->callbacks);
+
+	for (const auto &callback: callbacks)
+	{
+		callback.second();
+	}
+}
+
+//endregion
+
+//region cancel_context
+
+lib::cancel_context::cancel_context(const cancel_token &token)
+	: previous(cancel_token::active)
+{
+	cancel_token::active = token;
+}
+
+lib::cancel_context::~cancel_context()
+{
+	cancel_token::active = previous;
+}
+
+//endregion
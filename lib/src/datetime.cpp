@@ -13,6 +13,12 @@ lib::date_time::date_time(const date_time &date)
 	tm = date.tm;
 }
 
+auto lib::date_time::operator=(const date_time &date) -> date_time &
+{
+	tm = date.tm;
+	return *this;
+}
+
 lib::date_time::date_time(int year, int month, int day, int hour, int minute, int second)
 {
 	tm.tm_year = year - c_year_offset;
@@ -49,7 +55,13 @@ auto lib::date_time::now() -> lib::date_time
 {
 	lib::date_time date;
 	auto time = std::time(nullptr);
-	date.tm = *std::localtime(&time);
+
+	// Messages are logged from any thread
+#ifdef _WIN32
+	localtime_s(&date.tm, &time);
+#else
+	localtime_r(&time, &date.tm);
+#endif
 
 	return date;
 }
@@ -71,6 +83,12 @@ auto lib::date_time::seconds_since_epoch() -> unsigned long
 	return static_cast<unsigned long>(seconds.count());
 }
 
+auto lib::date_time::is_later(const std::string &iso_date1, const std::string &iso_date2) -> bool
+{
+	// ISO dates from the API are always UTC, so they can be compared as strings
+	return iso_date1 > iso_date2;
+}
+
 auto lib::date_time::is_valid() const -> bool
 {
 	return tm.tm_year > 0
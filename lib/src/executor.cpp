@@ -0,0 +1,203 @@
+#include "lib/executor.hpp"
+#include "lib/log.hpp"
+#include "lib/trace.hpp"
+
+#include <algorithm>
+
+namespace
+{
+	/**
+	 * Executor and queue the current thread is a worker of
+	 */
+	thread_local const lib::executor *current_executor = nullptr;
+	thread_local size_t current_index = 0;
+}
+
+std::mutex lib::executor::dispatcher_mutex;
+std::function<void(const lib::executor::task &)> lib::executor::dispatcher;
+
+lib::executor::executor(size_t thread_count)
+	: next_queue(0),
+	pending(0)
+{
+	const auto count = std::max<size_t>(thread_count, 1);
+
+	queues.reserve(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		queues.emplace_back(new worker_queue());
+	}
+
+	threads.reserve(count);
+	for (size_t i = 0; i < count; i++)
+	{
+		threads.emplace_back(&executor::run, this, i);
+	}
+}
+
+lib::executor::~executor()
+{
+	{
+		std::lock_guard<std::mutex> lock(wake_mutex);
+		stopping = true;
+	}
+	wake.notify_all();
+
+	for (auto &thread: threads)
+	{
+		thread.join();
+	}
+}
+
+auto lib::executor::shared() -> executor &
+{
+	static executor instance(std::thread::hardware_concurrency());
+	return instance;
+}
+
+void lib::executor::post(const task &task)
+{
+	// Workers keep their own tasks, as they're likely related to what they're working on
+	auto index = current_queue();
+	if (index >= queues.size())
+	{
+		index = next_queue++ % queues.size();
+	}
+
+	// Counted before added, so it's never taken before counted
+	{
+		std::lock_guard<std::mutex> lock(wake_mutex);
+		pending++;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(queues[index]->mutex);
+		queues[index]->tasks.push_back(task);
+	}
+	wake.notify_one();
+}
+
+auto lib::executor::try_run_one() -> bool
+{
+	const auto index = current_queue();
+
+	task task;
+	if (!take(index < queues.size() ? index : 0, task))
+	{
+		return false;
+	}
+
+	run_task(task);
+	return true;
+}
+
+auto lib::executor::thread_count() const -> size_t
+{
+	return threads.size();
+}
+
+void lib::executor::set_dispatcher(const std::function<void(const task &)> &func)
+{
+	std::lock_guard<std::mutex> lock(dispatcher_mutex);
+	dispatcher = func;
+}
+
+void lib::executor::dispatch(const task &task)
+{
+	std::function<void(const lib::executor::task &)> current;
+	{
+		std::lock_guard<std::mutex> lock(dispatcher_mutex);
+		current = dispatcher;
+	}
+
+	if (current)
+	{
+		current(task);
+		return;
+	}
+
+	task();
+}
+
+auto lib::executor::current_queue() const -> size_t
+{
+	return current_executor == this
+		? current_index
+		: queues.size();
+}
+
+auto lib::executor::take(size_t index, task &task) -> bool
+{
+	// Newest task from own queue
+	{
+		auto &own = *queues[index];
+		std::lock_guard<std::mutex> lock(own.mutex);
+		if (!own.tasks.empty())
+		{
+			task = std::move(own.tasks.back());
+			own.tasks.pop_back();
+			pending--;
+			return true;
+		}
+	}
+
+	// Oldest task from any other queue
+	for (size_t i = 1; i < queues.size(); i++)
+	{
+		auto &other = *queues[(index + i) % queues.size()];
+		std::lock_guard<std::mutex> lock(other.mutex);
+		if (!other.tasks.empty())
+		{
+			task = std::move(other.tasks.front());
+			other.tasks.pop_front();
+			pending--;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void lib::executor::run(size_t index)
+{
+	current_executor = this;
+	current_index = index;
+	lib::trace::set_thread_name("worker " + std::to_string(index));
+
+	while (true)
+	{
+		task task;
+		if (take(index, task))
+		{
+			run_task(task);
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(wake_mutex);
+		wake.wait(lock, [this]() -> bool
+		{
+			return stopping || pending > 0;
+		});
+
+		if (stopping && pending == 0)
+		{
+			return;
+		}
+	}
+}
+
+void lib::executor::run_task(const task &task)
+{
+	try
+	{
+		task();
+	}
+	catch (const std::exception &e)
+	{
+		lib::log::error("Task failed: {}", e.what());
+	}
+	catch (...)
+	{
+		lib::log::error("Task failed");
+	}
+}
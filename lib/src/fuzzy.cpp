@@ -0,0 +1,177 @@
+#include "lib/fuzzy.hpp"
+#include "lib/strings.hpp"
+#include "lib/parallel.hpp"
+
+#include <algorithm>
+
+lib::fuzzy::fuzzy(const std::string &query)
+{
+	for (const auto &word: lib::strings::split(lib::strings::normalize(query), ' '))
+	{
+		if (!word.empty())
+		{
+			words.emplace_back(word);
+		}
+	}
+}
+
+auto lib::fuzzy::is_empty() const -> bool
+{
+	return words.empty();
+}
+
+auto lib::fuzzy::score(const std::string &text) const -> int
+{
+	// Empty query matches everything equally
+	if (words.empty())
+	{
+		return 1;
+	}
+
+	auto total = 0;
+	for (const auto &word: words)
+	{
+		const auto dist = word.distance(text);
+		if (dist > word.max)
+		{
+			return 0;
+		}
+
+		// Longer words are more specific, and exact matches always score highest
+		total += static_cast<int>(word.length + 1 - dist);
+	}
+
+	return total;
+}
+
+auto lib::fuzzy::filter(const std::vector<std::string> &texts) const
+-> std::vector<std::pair<size_t, int>>
+{
+	// Same thread if not enough texts to be worth splitting up
+	if (texts.size() < min_chunk_size * 2)
+	{
+		return filter(texts, 0, texts.size());
+	}
+
+	std::vector<std::vector<std::pair<size_t, int>>> results(
+		(texts.size() + min_chunk_size - 1) / min_chunk_size);
+
+	lib::parallel::for_range(lib::executor::shared(), texts.size(), min_chunk_size,
+		[this, &texts, &results](size_t begin, size_t end)
+		{
+			results[begin / min_chunk_size] = filter(texts, begin, end);
+		});
+
+	std::vector<std::pair<size_t, int>> matches;
+	for (const auto &result: results)
+	{
+		matches.insert(matches.end(), result.cbegin(), result.cend());
+	}
+
+	return matches;
+}
+
+auto lib::fuzzy::filter(const std::vector<std::string> &texts,
+	size_t begin, size_t end) const -> std::vector<std::pair<size_t, int>>
+{
+	std::vector<std::pair<size_t, int>> matches;
+
+	for (auto i = begin; i < end; i++)
+	{
+		const auto current = score(texts[i]);
+		if (current > 0)
+		{
+			matches.emplace_back(i, current);
+		}
+	}
+
+	return matches;
+}
+
+auto lib::fuzzy::distance(const std::string &pattern, const std::string &text) -> size_t
+{
+	return word(pattern).distance(text);
+}
+
+auto lib::fuzzy::max_distance(const std::string &word) -> size_t
+{
+	const auto has_digit = std::any_of(word.cbegin(), word.cend(), [](char chr) -> bool
+	{
+		return chr >= '0' && chr <= '9';
+	});
+
+	if (has_digit || word.size() < 4)
+	{
+		return 0;
+	}
+
+	return word.size() < 8 ? 1 : 2;
+}
+
+//region word
+
+lib::fuzzy::word::word(const std::string &text)
+	: length(text.size() < max_length ? text.size() : max_length),
+	max(max_distance(text))
+{
+	peq.fill(0);
+	for (size_t i = 0; i < length; i++)
+	{
+		peq[static_cast<unsigned char>(text[i])] |= 1ULL << i;
+	}
+}
+
+auto lib::fuzzy::word::distance(const std::string &text) const -> size_t
+{
+	if (length == 0)
+	{
+		return 0;
+	}
+
+	// Vertical deltas of the current column, all +1 as the first column is 0..m
+	uint64_t pv = ~0ULL;
+	uint64_t mv = 0;
+
+	const auto last = 1ULL << (length - 1);
+	auto current = length;
+	auto best = length;
+
+	for (const auto chr: text)
+	{
+		const auto eq = peq[static_cast<unsigned char>(chr)];
+		const auto xv = eq | mv;
+		const auto xh = (((eq & pv) + pv) ^ pv) | eq;
+
+		auto ph = mv | ~(xh | pv);
+		auto mh = pv & xh;
+
+		if ((ph & last) != 0)
+		{
+			current++;
+		}
+		else if ((mh & last) != 0)
+		{
+			current--;
+		}
+
+		// Match can start anywhere in text, so the top row is always 0
+		ph <<= 1;
+		mh <<= 1;
+
+		pv = mh | ~(xv | ph);
+		mv = ph & xv;
+
+		if (current < best)
+		{
+			best = current;
+			if (best == 0)
+			{
+				break;
+			}
+		}
+	}
+
+	return best;
+}
+
+//endregion
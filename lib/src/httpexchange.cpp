@@ -0,0 +1,125 @@
+#include "lib/httpexchange.hpp"
+
+#include "lib/base64.hpp"
+#include "lib/json.hpp"
+#include "lib/log.hpp"
+
+#include <fstream>
+
+namespace
+{
+	/**
+	 * Valid UTF-8, that can be stored in JSON as is
+	 */
+	auto is_utf8(const std::string &str) -> bool
+	{
+		try
+		{
+			nlohmann::json(str).dump(-1, ' ', false, nlohmann::json::error_handler_t::strict);
+			return true;
+		}
+		catch (const nlohmann::json::type_error &)
+		{
+			return false;
+		}
+	}
+}
+
+auto lib::http_exchange::key() const -> std::string
+{
+	return key(method, url, body);
+}
+
+auto lib::http_exchange::key(const std::string &method, const std::string &url,
+	const std::string &body) -> std::string
+{
+	return method + ' ' + url + '\n' + body;
+}
+
+auto lib::http_exchange::load(const ghc::filesystem::path &path) -> std::vector<http_exchange>
+{
+	const auto json = lib::json::load(path);
+	if (!json.is_array())
+	{
+		lib::log::warn("No recorded requests in {}", path.string());
+		return {};
+	}
+
+	return json.get<std::vector<http_exchange>>();
+}
+
+auto lib::http_exchange::save(const ghc::filesystem::path &path,
+	const std::vector<http_exchange> &exchanges) -> bool
+{
+	// Written next to it first, to not leave a partial file if anything fails
+	auto temp_path = path;
+	temp_path += ".tmp";
+
+	try
+	{
+		const auto data = nlohmann::json(exchanges).dump();
+
+		std::ofstream file(temp_path.string(), std::ios::binary);
+		file << data;
+		file.close();
+
+		if (!file)
+		{
+			throw std::runtime_error("Failed to write file");
+		}
+
+		ghc::filesystem::rename(temp_path, path);
+	}
+	catch (const std::exception &e)
+	{
+		lib::log::error("Failed to save recorded requests to {}: {}",
+			path.string(), e.what());
+
+		std::error_code error;
+		ghc::filesystem::remove(temp_path, error);
+		return false;
+	}
+
+	lib::log::info("Saved {} recorded requests to {}", exchanges.size(), path.string());
+	return true;
+}
+
+void lib::to_json(nlohmann::json &j, const http_exchange &e)
+{
+	j = nlohmann::json{
+		{"method", e.method},
+		{"url", e.url},
+		{"body", e.body},
+		{"status", e.status},
+		{"duration", e.duration},
+	};
+
+	if (is_utf8(e.response))
+	{
+		j["response"] = e.response;
+	}
+	else
+	{
+		j["response_base64"] = lib::base64::encode(e.response);
+	}
+}
+
+void lib::from_json(const nlohmann::json &j, http_exchange &e)
+{
+	if (!j.is_object())
+	{
+		return;
+	}
+
+	j.at("method").get_to(e.method);
+	j.at("url").get_to(e.url);
+	lib::json::get(j, "body", e.body);
+	lib::json::get(j, "status", e.status);
+	lib::json::get(j, "response", e.response);
+
+	if (j.contains("response_base64"))
+	{
+		e.response = lib::base64::decode(j.at("response_base64").get<std::string>());
+	}
+	lib::json::get(j, "duration", e.duration);
+}
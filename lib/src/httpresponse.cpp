@@ -0,0 +1,24 @@
+#include "lib/httpresponse.hpp"
+
+#include <utility>
+
+lib::http_response::http_response(int status, std::string body)
+	: status(status),
+	body(std::move(body))
+{
+}
+
+auto lib::http_response::is_success() const -> bool
+{
+	return status >= 200 && status < 300;
+}
+
+auto lib::http_response::is_retryable() const -> bool
+{
+	constexpr int too_many_requests = 429;
+	constexpr int server_error = 500;
+
+	return status == 0
+		|| status == too_many_requests
+		|| status >= server_error;
+}
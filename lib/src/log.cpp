@@ -1,40 +1,190 @@
 #include "lib/log.hpp"
 
-std::vector<lib::log_message> lib::log::messages = std::vector<log_message>();
+constexpr size_t lib::log::queue_capacity;
+constexpr size_t lib::log::history_capacity;
+constexpr std::chrono::milliseconds lib::log::flush_interval;
 
-bool lib::log::log_to_stdout = true;
+std::atomic<bool> lib::log::log_to_stdout(true);
 
 void lib::log::message(log_type log_type, const std::string &message)
 {
-	log_message msg(log_type, message);
-	messages.push_back(msg);
+	add(log_message(log_type, message));
+}
 
-	if (!log_to_stdout)
+void lib::log::add(const log_message &message)
+{
+	start();
+
+	auto &current = get_sink();
+	if (!buffer().push(message))
 	{
-		return;
+		// Full, so print what's waiting as soon as possible
+		current.wake.notify_one();
 	}
 
-	if (log_type == log_type::information || log_type == log_type::verbose)
+	// Background thread is stopped when exiting
+	if (!current.running)
 	{
-		std::cout << msg.to_string() << std::endl;
+		flush();
+	}
+}
+
+auto lib::log::get_messages() -> std::vector<log_message>
+{
+	flush();
+	return buffer().messages();
+}
+
+auto lib::log::get_messages(size_t &next) -> std::vector<log_message>
+{
+	flush();
+	return buffer().messages_since(next);
+}
+
+void lib::log::flush()
+{
+	auto &current = get_sink();
+	std::lock_guard<std::mutex> lock(current.file_mutex);
+
+	const auto &file = current.file;
+	buffer().drain([&file](const log_message &message)
+	{
+		print(message);
+		if (file)
+		{
+			file->write(message);
+		}
+	});
+
+	if (file)
+	{
+		file->flush();
+	}
+
+	if (log_to_stdout)
+	{
+		std::cout.flush();
+		std::cerr.flush();
+	}
+}
+
+void lib::log::set_category_enabled(const std::string &category, bool enabled)
+{
+	auto &current = get_categories();
+	std::lock_guard<std::mutex> lock(current.mutex);
+
+	if (enabled)
+	{
+		current.enabled.insert(category);
 	}
 	else
 	{
-		std::cerr << msg.to_string() << std::endl;
+		current.enabled.erase(category);
+	}
+
+	current.any = !current.enabled.empty();
+}
+
+auto lib::log::is_category_enabled(const std::string &category) -> bool
+{
+	auto &current = get_categories();
+	if (!current.any)
+	{
+		return false;
 	}
+
+	std::lock_guard<std::mutex> lock(current.mutex);
+	return current.enabled.find(category) != current.enabled.end();
 }
 
-auto lib::log::get_messages() -> const std::vector<log_message> &
+void lib::log::set_file(const std::shared_ptr<log_file> &file)
 {
-	return messages;
+	// Previous file gets everything logged until now
+	flush();
+
+	auto &current = get_sink();
+	std::lock_guard<std::mutex> lock(current.file_mutex);
+	current.file = file;
 }
 
 void lib::log::clear()
 {
-	messages.clear();
+	buffer().clear();
 }
 
 void lib::log::set_log_to_stdout(bool value)
 {
 	log_to_stdout = value;
 }
+
+auto lib::log::buffer() -> log_buffer &
+{
+	// Never destroyed, as messages can be logged during static destruction
+	static auto *instance = new log_buffer(queue_capacity, history_capacity);
+	return *instance;
+}
+
+auto lib::log::get_sink() -> sink &
+{
+	static auto *instance = new sink();
+	return *instance;
+}
+
+auto lib::log::get_categories() -> categories &
+{
+	static auto *instance = new categories();
+	return *instance;
+}
+
+void lib::log::start()
+{
+	static std::once_flag started;
+	std::call_once(started, []()
+	{
+		auto &current = get_sink();
+		current.running = true;
+		current.thread = std::thread([&current]()
+		{
+			std::unique_lock<std::mutex> lock(current.mutex);
+			while (!current.stopping)
+			{
+				current.wake.wait_for(lock, flush_interval);
+
+				lock.unlock();
+				flush();
+				lock.lock();
+			}
+		});
+
+		std::atexit(&lib::log::stop);
+	});
+}
+
+void lib::log::stop()
+{
+	auto &current = get_sink();
+	{
+		std::lock_guard<std::mutex> lock(current.mutex);
+		current.stopping = true;
+	}
+	current.wake.notify_one();
+
+	current.thread.join();
+	current.running = false;
+	flush();
+}
+
+void lib::log::print(const log_message &message)
+{
+	if (!log_to_stdout)
+	{
+		return;
+	}
+
+	const auto type = message.get_log_type();
+	auto &stream = type == log_type::information || type == log_type::verbose
+		? std::cout
+		: std::cerr;
+
+	stream << message.to_string() << '\n';
+}
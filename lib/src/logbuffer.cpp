@@ -0,0 +1,94 @@
+#include "lib/logbuffer.hpp"
+#include "lib/fmt.hpp"
+
+#include <algorithm>
+
+lib::log_buffer::log_buffer(size_t queue_capacity, size_t history_capacity)
+	: queue(queue_capacity),
+	dropped(0),
+	history_capacity(history_capacity)
+{
+}
+
+auto lib::log_buffer::push(const lib::log_message &message) -> bool
+{
+	if (queue.push(message))
+	{
+		return true;
+	}
+
+	dropped++;
+	return false;
+}
+
+void lib::log_buffer::drain(const std::function<void(const lib::log_message &)> &sink)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	lib::log_message message;
+	while (queue.pop(message))
+	{
+		sink(message);
+		add_to_history(message);
+	}
+
+	// Dropped messages should at least leave a trace
+	const auto dropped_count = dropped.exchange(0);
+	if (dropped_count > 0)
+	{
+		const lib::log_message warning(lib::log_type::warning,
+			lib::fmt::format("{} log messages dropped", dropped_count));
+
+		sink(warning);
+		add_to_history(warning);
+	}
+}
+
+auto lib::log_buffer::messages() const -> std::vector<lib::log_message>
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return {history.cbegin(), history.cend()};
+}
+
+auto lib::log_buffer::messages_since(size_t &next) const -> std::vector<lib::log_message>
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	// Messages removed from history are skipped
+	const auto first = total - history.size();
+	const auto start = std::max(next, first);
+	next = total;
+
+	if (start >= total)
+	{
+		return {};
+	}
+
+	return {
+		history.cbegin() + static_cast<long>(start - first),
+		history.cend(),
+	};
+}
+
+void lib::log_buffer::clear()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	lib::log_message message;
+	while (queue.pop(message))
+	{
+	}
+
+	dropped = 0;
+	history.clear();
+}
+
+void lib::log_buffer::add_to_history(const lib::log_message &message)
+{
+	if (history.size() >= history_capacity)
+	{
+		history.pop_front();
+	}
+	history.push_back(message);
+	total++;
+}
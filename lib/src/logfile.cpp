@@ -0,0 +1,174 @@
+#include "lib/logfile.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+
+lib::log_file::log_file(const ghc::filesystem::path &path, size_t max_size, size_t max_files)
+	: path(path),
+	max_size(max_size),
+	max_files(std::max<size_t>(max_files, 1))
+{
+	open();
+}
+
+void lib::log_file::write(const lib::log_message &message)
+{
+	auto line = format(message);
+	line.push_back('\n');
+
+	if (size > 0 && size + line.size() > max_size)
+	{
+		rotate();
+	}
+
+	if (!stream.is_open())
+	{
+		return;
+	}
+
+	stream.write(line.data(), static_cast<std::streamsize>(line.size()));
+	size += line.size();
+}
+
+void lib::log_file::flush()
+{
+	if (stream.is_open())
+	{
+		stream.flush();
+	}
+}
+
+auto lib::log_file::format(const lib::log_message &message) -> std::string
+{
+	const auto &time = message.get_date_time();
+
+	char timestamp[32];
+	std::snprintf(timestamp, sizeof(timestamp), "%04d-%02d-%02dT%02d:%02d:%02d",
+		time.get_year(), time.get_month(), time.get_day(),
+		time.get_hour(), time.get_minute(), time.get_second());
+
+	std::string line(timestamp);
+	line.push_back('\t');
+	line.push_back(type_char(message.get_log_type()));
+	line.push_back('\t');
+	line.append(message.get_category().empty()
+		? "-"
+		: escape(message.get_category()));
+	line.push_back('\t');
+	line.append(escape(message.get_message()));
+
+	for (const auto &field: message.get_fields())
+	{
+		line.push_back('\t');
+		line.append(escape(field.first));
+		line.push_back('=');
+		line.append(escape(field.second));
+	}
+
+	return line;
+}
+
+void lib::log_file::open()
+{
+	// Errors aren't logged, as this is called while writing log messages
+	std::error_code error;
+	if (path.has_parent_path())
+	{
+		ghc::filesystem::create_directories(path.parent_path(), error);
+	}
+
+	const auto current_size = ghc::filesystem::file_size(path, error);
+	size = error ? 0 : static_cast<size_t>(current_size);
+
+	if (size >= max_size)
+	{
+		rotate();
+		return;
+	}
+
+	stream.open(path.string(), std::ios::out | std::ios::app | std::ios::binary);
+	if (!stream.is_open())
+	{
+		std::cerr << "Failed to open log file: " << path.string() << '\n';
+	}
+}
+
+void lib::log_file::rotate()
+{
+	stream.close();
+
+	std::error_code error;
+	for (auto i = max_files - 1; i > 0; i--)
+	{
+		const auto from = i == 1 ? path : numbered(i - 1);
+		if (ghc::filesystem::exists(from, error))
+		{
+			ghc::filesystem::rename(from, numbered(i), error);
+		}
+	}
+
+	size = 0;
+	stream.open(path.string(), std::ios::out | std::ios::trunc | std::ios::binary);
+}
+
+auto lib::log_file::numbered(size_t index) const -> ghc::filesystem::path
+{
+	auto result = path;
+	result += "." + std::to_string(index);
+	return result;
+}
+
+auto lib::log_file::escape(const std::string &value) -> std::string
+{
+	std::string result;
+	result.reserve(value.size());
+
+	for (const auto &chr: value)
+	{
+		switch (chr)
+		{
+			case '\t':
+				result.append("\\t");
+				break;
+
+			case '\n':
+				result.append("\\n");
+				break;
+
+			case '\r':
+				result.append("\\r");
+				break;
+
+			case '\\':
+				result.append("\\\\");
+				break;
+
+			default:
+				result.push_back(chr);
+				break;
+		}
+	}
+
+	return result;
+}
+
+auto lib::log_file::type_char(lib::log_type log_type) -> char
+{
+	switch (log_type)
+	{
+		case lib::log_type::information:
+			return 'I';
+
+		case lib::log_type::warning:
+			return 'W';
+
+		case lib::log_type::error:
+			return 'E';
+
+		case lib::log_type::verbose:
+			return 'D';
+	}
+
+	return '?';
+}
@@ -0,0 +1,46 @@
+#include "lib/logfilter.hpp"
+#include "lib/strings.hpp"
+
+#include <algorithm>
+
+lib::log_filter::log_filter(const std::string &text, const std::vector<lib::log_type> &types)
+	: text(lib::strings::to_lower(text)),
+	types(types)
+{
+}
+
+auto lib::log_filter::matches(const lib::log_message &message) const -> bool
+{
+	if (!types.empty()
+		&& std::find(types.cbegin(), types.cend(), message.get_log_type()) == types.cend())
+	{
+		return false;
+	}
+
+	if (text.empty())
+	{
+		return true;
+	}
+
+	return lib::strings::contains(lib::strings::to_lower(message.get_message()), text)
+		|| lib::strings::contains(lib::strings::to_lower(message.get_category()), text);
+}
+
+auto lib::log_filter::is_empty() const -> bool
+{
+	return text.empty() && types.empty();
+}
+
+auto lib::log_filter::apply(const std::vector<lib::log_message> &messages,
+	size_t from) const -> std::vector<size_t>
+{
+	std::vector<size_t> indices;
+	for (auto i = from; i < messages.size(); i++)
+	{
+		if (matches(messages.at(i)))
+		{
+			indices.push_back(i);
+		}
+	}
+	return indices;
+}
@@ -14,10 +14,30 @@ lib::log_message::log_message(log_type log_type, const std::string &message)
 {
 }
 
+lib::log_message::log_message(log_type log_type, const std::string &category,
+	const std::string &message, const log_fields &fields)
+	: log_message(log_type, message)
+{
+	this->category = category;
+	this->fields = fields;
+}
+
 auto lib::log_message::to_string() const -> std::string
 {
-	return lib::fmt::format("[{}] [{}] {}", get_time(),
-		get_type_short(), message);
+	if (category.empty())
+	{
+		return lib::fmt::format("[{}] [{}] {}", get_time(),
+			get_type_short(), message);
+	}
+
+	auto result = lib::fmt::format("[{}] [{}] [{}] {}", get_time(),
+		get_type_short(), category, message);
+
+	for (const auto &field: fields)
+	{
+		result.append(lib::fmt::format(" {}={}", field.first, field.second));
+	}
+	return result;
 }
 
 auto lib::log_message::get_type_short() const -> std::string
@@ -69,3 +89,23 @@ auto lib::log_message::get_message() const -> std::string
 {
 	return message;
 }
+
+auto lib::log_message::get_log_type() const -> log_type
+{
+	return logType;
+}
+
+auto lib::log_message::get_date_time() const -> const date_time &
+{
+	return time;
+}
+
+auto lib::log_message::get_category() const -> const std::string &
+{
+	return category;
+}
+
+auto lib::log_message::get_fields() const -> const log_fields &
+{
+	return fields;
+}
@@ -0,0 +1,62 @@
+#include "lib/parallel.hpp"
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+void lib::parallel::for_range(lib::executor &executor, size_t size, size_t grain_size,
+	const std::function<void(size_t, size_t)> &func)
+{
+	grain_size = std::max<size_t>(grain_size, 1);
+	const auto count = (size + grain_size - 1) / grain_size;
+
+	// Not worth using other threads
+	if (count <= 1)
+	{
+		if (size > 0)
+		{
+			func(0, size);
+		}
+		return;
+	}
+
+	std::atomic<size_t> remaining(count);
+	std::mutex error_mutex;
+	std::exception_ptr error;
+
+	for (size_t i = 0; i < count; i++)
+	{
+		const auto begin = i * grain_size;
+		const auto end = std::min(begin + grain_size, size);
+
+		executor.post([&func, &remaining, &error_mutex, &error, begin, end]()
+		{
+			try
+			{
+				func(begin, end);
+			}
+			catch (...)
+			{
+				std::lock_guard<std::mutex> lock(error_mutex);
+				error = std::current_exception();
+			}
+			remaining--;
+		});
+	}
+
+	// Run tasks while waiting, so waiting from a worker never blocks it
+	while (remaining > 0)
+	{
+		if (!executor.try_run_one())
+		{
+			std::this_thread::yield();
+		}
+	}
+
+	if (error)
+	{
+		std::rethrow_exception(error);
+	}
+}
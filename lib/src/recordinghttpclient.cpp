@@ -0,0 +1,111 @@
+#include "lib/recordinghttpclient.hpp"
+
+#include "lib/log.hpp"
+
+lib::recording_http_client::recording_http_client(const lib::http_client &http_client,
+	size_t max_exchanges)
+	: http(http_client),
+	max_exchanges(max_exchanges)
+{
+}
+
+void lib::recording_http_client::get(const std::string &url, const lib::headers &headers,
+	lib::callback<std::string> &callback) const
+{
+	http.get(url, headers, record("GET", url, std::string(), callback));
+}
+
+void lib::recording_http_client::put(const std::string &url, const std::string &body,
+	const lib::headers &headers, lib::callback<std::string> &callback) const
+{
+	http.put(url, body, headers, record("PUT", url, body, callback));
+}
+
+void lib::recording_http_client::post(const std::string &url, const std::string &body,
+	const lib::headers &headers, lib::callback<std::string> &callback) const
+{
+	http.post(url, body, headers, record("POST", url, body, callback));
+}
+
+auto lib::recording_http_client::post(const std::string &url, const lib::headers &headers,
+	const std::string &post_data) const -> std::string
+{
+	// Only used for access tokens, so never recorded to not save any credentials
+	return http.post(url, headers, post_data);
+}
+
+void lib::recording_http_client::del(const std::string &url, const std::string &body,
+	const lib::headers &headers, lib::callback<std::string> &callback) const
+{
+	http.del(url, body, headers, record("DELETE", url, body, callback));
+}
+
+void lib::recording_http_client::send(const std::string &method, const std::string &url,
+	const std::string &body, const lib::headers &headers,
+	lib::callback<lib::http_response> &callback) const
+{
+	const auto started = clock::now();
+
+	http.send(method, url, body, headers,
+		[this, method, url, body, started, callback](const lib::http_response &response)
+		{
+			lib::http_exchange exchange;
+			exchange.method = method;
+			exchange.url = url;
+			exchange.body = body;
+			exchange.status = response.status;
+			exchange.response = response.body;
+			add(exchange, started);
+
+			callback(response);
+		});
+}
+
+auto lib::recording_http_client::get_exchanges() const -> std::vector<lib::http_exchange>
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return exchanges;
+}
+
+auto lib::recording_http_client::save(const ghc::filesystem::path &path) const -> bool
+{
+	return lib::http_exchange::save(path, get_exchanges());
+}
+
+auto lib::recording_http_client::record(const std::string &method, const std::string &url,
+	const std::string &body, lib::callback<std::string> &callback) const
+-> std::function<void(const std::string &)>
+{
+	const auto started = clock::now();
+
+	return [this, method, url, body, started, callback](const std::string &response)
+	{
+		lib::http_exchange exchange;
+		exchange.method = method;
+		exchange.url = url;
+		exchange.body = body;
+		exchange.response = response;
+		add(exchange, started);
+
+		callback(response);
+	};
+}
+
+void lib::recording_http_client::add(lib::http_exchange exchange,
+	clock::time_point started) const
+{
+	exchange.duration = std::chrono::duration_cast<std::chrono::milliseconds>(clock::now()
+		- started).count();
+
+	std::lock_guard<std::mutex> lock(mutex);
+	if (exchanges.size() >= max_exchanges)
+	{
+		return;
+	}
+
+	exchanges.push_back(std::move(exchange));
+	if (exchanges.size() == max_exchanges)
+	{
+		lib::log::warn("Recorded {} requests, not recording any more", max_exchanges);
+	}
+}
@@ -0,0 +1,208 @@
+#include "lib/replayhttpclient.hpp"
+
+#include "lib/canceltoken.hpp"
+#include "lib/executor.hpp"
+#include "lib/fmt.hpp"
+#include "lib/log.hpp"
+
+#include <thread>
+
+lib::replay_http_client::replay_http_client(const std::vector<lib::http_exchange> &exchanges)
+	: latency(0)
+{
+	for (const auto &exchange: exchanges)
+	{
+		recorded[exchange.key()].exchanges.push_back(exchange);
+	}
+}
+
+lib::replay_http_client::~replay_http_client()
+{
+	{
+		std::lock_guard<std::mutex> lock(delayed_mutex);
+		stopping = true;
+	}
+	wake.notify_all();
+
+	if (timer.joinable())
+	{
+		timer.join();
+	}
+}
+
+void lib::replay_http_client::get(const std::string &url, const lib::headers &/*headers*/,
+	lib::callback<std::string> &callback) const
+{
+	respond("GET", url, std::string(), callback);
+}
+
+void lib::replay_http_client::put(const std::string &url, const std::string &body,
+	const lib::headers &/*headers*/, lib::callback<std::string> &callback) const
+{
+	respond("PUT", url, body, callback);
+}
+
+void lib::replay_http_client::post(const std::string &url, const std::string &body,
+	const lib::headers &/*headers*/, lib::callback<std::string> &callback) const
+{
+	respond("POST", url, body, callback);
+}
+
+auto lib::replay_http_client::post(const std::string &url, const lib::headers &/*headers*/,
+	const std::string &post_data) const -> std::string
+{
+	const auto exchange = next("POST", url, post_data);
+	const auto duration = delay(exchange);
+	if (duration.count() > 0)
+	{
+		std::this_thread::sleep_for(duration);
+	}
+	return exchange.response;
+}
+
+void lib::replay_http_client::del(const std::string &url, const std::string &body,
+	const lib::headers &/*headers*/, lib::callback<std::string> &callback) const
+{
+	respond("DELETE", url, body, callback);
+}
+
+void lib::replay_http_client::send(const std::string &method, const std::string &url,
+	const std::string &body, const lib::headers &/*headers*/,
+	lib::callback<lib::http_response> &callback) const
+{
+	// Not cancellable, as callers rely on always getting a response
+	const auto exchange = next(method, url, body);
+	deliver(delay(exchange), [exchange, callback]()
+	{
+		callback(lib::http_response(exchange.status, exchange.response));
+	});
+}
+
+void lib::replay_http_client::set_latency(std::chrono::milliseconds value)
+{
+	latency = value;
+}
+
+void lib::replay_http_client::set_recorded_latency(bool value)
+{
+	recorded_latency = value;
+}
+
+void lib::replay_http_client::set_bandwidth(size_t value)
+{
+	bandwidth = value;
+}
+
+auto lib::replay_http_client::get_unmatched() const -> std::vector<std::string>
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return unmatched;
+}
+
+auto lib::replay_http_client::next(const std::string &method, const std::string &url,
+	const std::string &body) const -> lib::http_exchange
+{
+	std::lock_guard<std::mutex> lock(mutex);
+
+	const auto iter = recorded.find(lib::http_exchange::key(method, url, body));
+	if (iter == recorded.end())
+	{
+		lib::log::warn("No recorded response for {} {}", method, url);
+		unmatched.push_back(lib::fmt::format("{} {}", method, url));
+
+		lib::http_exchange exchange;
+		exchange.method = method;
+		exchange.url = url;
+		exchange.body = body;
+		return exchange;
+	}
+
+	auto &responses = iter->second;
+	const auto index = std::min(responses.replayed, responses.exchanges.size() - 1);
+	responses.replayed++;
+	return responses.exchanges.at(index);
+}
+
+auto lib::replay_http_client::delay(const lib::http_exchange &exchange) const
+-> std::chrono::milliseconds
+{
+	auto duration = recorded_latency
+		? std::chrono::milliseconds(exchange.duration)
+		: latency;
+
+	if (bandwidth > 0)
+	{
+		duration += std::chrono::milliseconds(exchange.response.size() * 1000 / bandwidth);
+	}
+
+	return duration;
+}
+
+void lib::replay_http_client::deliver(std::chrono::milliseconds duration,
+	const std::function<void()> &func) const
+{
+	if (duration.count() <= 0)
+	{
+		func();
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(delayed_mutex);
+		delayed.emplace(std::chrono::steady_clock::now() + duration, func);
+
+		// Only started when needed, as most replays have no latency
+		if (!timer.joinable())
+		{
+			timer = std::thread(&lib::replay_http_client::run_timer, this);
+		}
+	}
+	wake.notify_all();
+}
+
+void lib::replay_http_client::run_timer() const
+{
+	std::unique_lock<std::mutex> lock(delayed_mutex);
+
+	while (!stopping)
+	{
+		if (delayed.empty())
+		{
+			wake.wait(lock);
+			continue;
+		}
+
+		const auto first = delayed.begin();
+		if (std::chrono::steady_clock::now() < first->first)
+		{
+			wake.wait_until(lock, first->first);
+			continue;
+		}
+
+		const auto func = first->second;
+		delayed.erase(first);
+
+		lock.unlock();
+		lib::executor::dispatch(func);
+		lock.lock();
+	}
+}
+
+void lib::replay_http_client::respond(const std::string &method, const std::string &url,
+	const std::string &body, lib::callback<std::string> &callback) const
+{
+	const auto token = lib::cancel_token::current();
+	const auto exchange = next(method, url, body);
+
+	deliver(delay(exchange), [token, exchange, callback]()
+	{
+		// Owner is gone while waiting
+		if (token.is_cancelled())
+		{
+			return;
+		}
+
+		lib::cancel_context context(token);
+		callback(exchange.response);
+	});
+}
@@ -43,6 +43,33 @@ auto lib::spt::api::error_message(const std::string &url, const std::string &dat
 	return message;
 }
 
+auto lib::spt::api::json_result(const std::string &url,
+	const std::string &data) -> lib::result<nlohmann::json>
+{
+	nlohmann::json json;
+	try
+	{
+		if (!data.empty())
+		{
+			json = nlohmann::json::parse(data);
+		}
+	}
+	catch (const std::exception &e)
+	{
+		lib::log::warn("{} failed: {}", url, e.what());
+		return lib::result<nlohmann::json>::fail(e.what());
+	}
+
+	const auto message = lib::spt::error::error_message(json);
+	if (!message.empty())
+	{
+		lib::log::error("{} failed: {}", url, message);
+		return lib::result<nlohmann::json>::fail(message);
+	}
+
+	return lib::result<nlohmann::json>::ok(json);
+}
+
 void lib::spt::api::select_device(const std::vector<lib::spt::device> &/*devices*/,
 	lib::callback<lib::spt::device> &callback)
 {
@@ -74,23 +101,114 @@ auto lib::spt::api::get_current_device() const -> const std::string &
 	return settings.general.last_device;
 }
 
+void lib::spt::api::send(const lib::spt::mutation &mutation,
+	lib::callback<lib::http_response> &callback)
+{
+	auto headers = request.auth_headers();
+	headers["Content-Type"] = "application/json";
+
+	// HTTP clients always respond to send, so never counted as cancelled
+	lib::cancel_context context{lib::cancel_token()};
+	const auto measured = metrics.begin(mutation.method, mutation.url, mutation.body.size());
+
+	http.send(mutation.method, lib::spt::to_full_url(mutation.url),
+		mutation.body, headers, [this, measured, callback](const lib::http_response &response)
+		{
+			metrics.end(measured, response.body.size());
+			if (!response.is_success())
+			{
+				metrics.failed(measured);
+			}
+
+			callback(response);
+		});
+}
+
+auto lib::spt::api::get_metrics() -> lib::spt::api_metrics &
+{
+	return metrics;
+}
+
+auto lib::spt::api::parse_json(const lib::spt::api_metrics::request &measured,
+	const std::string &url, const std::string &response, nlohmann::json &json) -> bool
+{
+	metrics.end(measured, response.size());
+	const auto started = std::chrono::steady_clock::now();
+
+	try
+	{
+		json = response.empty()
+			? nlohmann::json()
+			: nlohmann::json::parse(response);
+	}
+	catch (const nlohmann::json::parse_error &e)
+	{
+		metrics.parsed(measured, started);
+		metrics.failed(measured);
+
+		lib::log::error("{} failed to parse: {}", url, e.what());
+		lib::log::debug("JSON: {}", response);
+		return false;
+	}
+
+	metrics.parsed(measured, started);
+	if (json.is_object() && json.contains("error"))
+	{
+		metrics.failed(measured);
+	}
+	return true;
+}
+
+auto lib::spt::api::parse_error(const lib::spt::api_metrics::request &measured,
+	const std::string &url, const std::string &response) -> std::string
+{
+	metrics.end(measured, response.size());
+	const auto started = std::chrono::steady_clock::now();
+
+	auto message = error_message(url, response);
+
+	metrics.parsed(measured, started);
+	if (!message.empty())
+	{
+		metrics.failed(measured);
+	}
+	return message;
+}
+
+auto lib::spt::api::parse_result(const lib::spt::api_metrics::request &measured,
+	const std::string &url, const std::string &response) -> lib::result<nlohmann::json>
+{
+	metrics.end(measured, response.size());
+	const auto started = std::chrono::steady_clock::now();
+
+	auto result = json_result(url, response);
+
+	metrics.parsed(measured, started);
+	if (!result.success())
+	{
+		metrics.failed(measured);
+	}
+	return result;
+}
+
 //region GET
 
 void lib::spt::api::get(const std::string &url, lib::callback<nlohmann::json> &callback)
 {
+	const auto measured = metrics.begin("GET", url, 0);
+
 	http.get(lib::spt::to_full_url(url), request.auth_headers(),
-		[url, callback](const std::string &response)
+		[this, url, callback, measured](const std::string &response)
 		{
-			try
+			nlohmann::json json;
+			if (!parse_json(measured, url, response, json))
 			{
-				callback(response.empty()
-					? nlohmann::json()
-					: nlohmann::json::parse(response));
+				return;
 			}
-			catch (const nlohmann::json::parse_error &e)
+
+			try
 			{
-				lib::log::error("{} failed to parse: {}", url, e.what());
-				lib::log::debug("JSON: {}", response);
+				callback(json);
 			}
 			catch (const std::exception &e)
 			{
@@ -149,10 +267,12 @@ void lib::spt::api::put(const std::string &url, const nlohmann::json &body,
 		? std::string()
 		: body.dump();
 
+	const auto measured = metrics.begin("PUT", url, data.size());
+
 	http.put(lib::spt::to_full_url(url), data, header,
-		[this, url, body, callback](const std::string &response)
+		[this, url, body, callback, measured](const std::string &response)
 		{
-			auto error = error_message(url, response);
+			auto error = parse_error(measured, url, response);
 
 			const auto noDevice = lib::strings::contains(error, "No active device found");
 			const auto invalidDevice = lib::strings::contains(error, "Device not found");
@@ -191,6 +311,7 @@ void lib::spt::api::put(const std::string &url, const nlohmann::json &body,
 								if (status.empty())
 								{
 									set_current_device(device.id);
+									metrics.retried("PUT", url);
 									this->put(get_device_url(url, device), body, callback);
 								}
 							});
@@ -210,6 +331,25 @@ void lib::spt::api::put(const std::string &url, lib::callback<std::string> &call
 	put(url, nlohmann::json(), callback);
 }
 
+void lib::spt::api::put(const std::string &url, const nlohmann::json &body,
+	lib::callback<lib::result<nlohmann::json>> &callback)
+{
+	auto headers = request.auth_headers();
+	headers["Content-Type"] = "application/json";
+
+	auto data = body.is_null()
+		? std::string()
+		: body.dump();
+
+	const auto measured = metrics.begin("PUT", url, data.size());
+
+	http.put(lib::spt::to_full_url(url), data, headers,
+		[this, url, callback, measured](const std::string &response)
+		{
+			callback(parse_result(measured, url, response));
+		});
+}
+
 //endregion
 
 //region POST
@@ -219,10 +359,27 @@ void lib::spt::api::post(const std::string &url, lib::callback<std::string> &cal
 	auto headers = request.auth_headers();
 	headers["Content-Type"] = "application/x-www-form-urlencoded";
 
+	const auto measured = metrics.begin("POST", url, 0);
+
 	http.post(lib::spt::to_full_url(url), headers,
-		[url, callback](const std::string &response)
+		[this, url, callback, measured](const std::string &response)
 		{
-			callback(error_message(url, response));
+			callback(parse_error(measured, url, response));
+		});
+}
+
+void lib::spt::api::post(const std::string &url,
+	lib::callback<lib::result<nlohmann::json>> &callback)
+{
+	auto headers = request.auth_headers();
+	headers["Content-Type"] = "application/x-www-form-urlencoded";
+
+	const auto measured = metrics.begin("POST", url, 0);
+
+	http.post(lib::spt::to_full_url(url), headers,
+		[this, url, callback, measured](const std::string &response)
+		{
+			callback(parse_result(measured, url, response));
 		});
 }
 
@@ -236,19 +393,20 @@ void lib::spt::api::post(const std::string &url, const nlohmann::json &json,
 		? std::string()
 		: json.dump();
 
+	const auto measured = metrics.begin("POST", url, data.size());
+
 	http.post(lib::spt::to_full_url(url), data, headers,
-		[url, callback](const std::string &response)
+		[this, url, callback, measured](const std::string &response)
 		{
-			try
+			nlohmann::json result;
+			if (!parse_json(measured, url, response, result))
 			{
-				callback(response.empty()
-					? nlohmann::json()
-					: nlohmann::json::parse(response));
+				return;
 			}
-			catch (const nlohmann::json::parse_error &e)
+
+			try
 			{
-				lib::log::error("{} failed to parse: {}", url, e.what());
-				lib::log::debug("JSON: {}", response);
+				callback(result);
 			}
 			catch (const std::exception &e)
 			{
@@ -272,10 +430,12 @@ void lib::spt::api::del(const std::string &url, const nlohmann::json &json,
 		? std::string()
 		: json.dump();
 
+	const auto measured = metrics.begin("DELETE", url, data.size());
+
 	http.del(lib::spt::to_full_url(url), data, headers,
-		[url, callback](const std::string &response)
+		[this, url, callback, measured](const std::string &response)
 		{
-			callback(error_message(url, response));
+			callback(parse_error(measured, url, response));
 		});
 }
 
@@ -284,4 +444,23 @@ void lib::spt::api::del(const std::string &url, lib::callback<std::string> &call
 	del(url, nlohmann::json(), callback);
 }
 
+void lib::spt::api::del(const std::string &url, const nlohmann::json &json,
+	lib::callback<lib::result<nlohmann::json>> &callback)
+{
+	auto headers = request.auth_headers();
+	headers["Content-Type"] = "application/json";
+
+	auto data = json.is_null()
+		? std::string()
+		: json.dump();
+
+	const auto measured = metrics.begin("DELETE", url, data.size());
+
+	http.del(lib::spt::to_full_url(url), data, headers,
+		[this, url, callback, measured](const std::string &response)
+		{
+			callback(parse_result(measured, url, response));
+		});
+}
+
 //endregion
@@ -0,0 +1,304 @@
+#include "lib/spotify/apimetrics.hpp"
+#include "lib/log.hpp"
+#include "lib/strings.hpp"
+#include "lib/trace.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+
+constexpr size_t lib::spt::endpoint_metrics::bucket_count;
+constexpr std::array<long long, lib::spt::endpoint_metrics::bucket_count - 1>
+	lib::spt::endpoint_metrics::bucket_bounds;
+
+//region endpoint_metrics
+
+auto lib::spt::endpoint_metrics::average_latency() const -> std::chrono::milliseconds
+{
+	const auto finished = requests - std::min(in_flight + cancelled, requests);
+	if (finished == 0)
+	{
+		return std::chrono::milliseconds(0);
+	}
+
+	return total_latency / static_cast<long long>(finished);
+}
+
+auto lib::spt::endpoint_metrics::percentile(double percent) const -> std::chrono::milliseconds
+{
+	size_t total = 0;
+	for (const auto count: histogram)
+	{
+		total += count;
+	}
+
+	if (total == 0)
+	{
+		return std::chrono::milliseconds(0);
+	}
+
+	const auto target = static_cast<size_t>(std::ceil(static_cast<double>(total) * percent / 100.0));
+
+	size_t seen = 0;
+	for (size_t i = 0; i < bucket_bounds.size(); i++)
+	{
+		seen += histogram.at(i);
+		if (seen >= target)
+		{
+			return std::min(std::chrono::milliseconds(bucket_bounds.at(i)), max_latency);
+		}
+	}
+
+	return max_latency;
+}
+
+void lib::spt::endpoint_metrics::add_latency(std::chrono::milliseconds latency)
+{
+	total_latency += latency;
+	max_latency = std::max(max_latency, latency);
+
+	const auto bound = std::lower_bound(bucket_bounds.cbegin(), bucket_bounds.cend(),
+		latency.count());
+	histogram.at(static_cast<size_t>(bound - bucket_bounds.cbegin()))++;
+}
+
+void lib::spt::to_json(nlohmann::json &j, const endpoint_metrics &m)
+{
+	nlohmann::json histogram = nlohmann::json::object();
+	for (size_t i = 0; i < m.histogram.size(); i++)
+	{
+		const auto key = i < endpoint_metrics::bucket_bounds.size()
+			? std::to_string(endpoint_metrics::bucket_bounds.at(i))
+			: std::string("inf");
+
+		histogram[key] = m.histogram.at(i);
+	}
+
+	j = nlohmann::json{
+		{"requests", m.requests},
+		{"errors", m.errors},
+		{"retries", m.retries},
+		{"in_flight", m.in_flight},
+		{"cancelled", m.cancelled},
+		{"bytes_sent", m.bytes_sent},
+		{"bytes_received", m.bytes_received},
+		{"average_ms", m.average_latency().count()},
+		{"p50_ms", m.percentile(50).count()},
+		{"p95_ms", m.percentile(95).count()},
+		{"max_ms", m.max_latency.count()},
+		{"parse_us", m.total_parse.count()},
+		{"histogram_ms", histogram},
+	};
+}
+
+//endregion
+
+//region api_metrics
+
+auto lib::spt::api_metrics::begin(const std::string &method, const std::string &url,
+	size_t bytes_sent) -> request
+{
+	request result;
+	result.endpoint = endpoint(method, url);
+	result.started = std::chrono::steady_clock::now();
+	if (lib::trace::is_enabled())
+	{
+		result.trace_started = lib::trace::now();
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		auto &current = metrics[result.endpoint];
+		current.requests++;
+		current.in_flight++;
+		current.bytes_sent += bytes_sent;
+	}
+
+	// HTTP clients abort requests when cancelled, so end is never called
+	result.token = lib::cancel_token::current();
+	result.cancel_id = result.token.on_cancel([this, result]()
+	{
+		cancelled(result);
+	});
+
+	return result;
+}
+
+void lib::spt::api_metrics::end(const request &request, size_t bytes_received)
+{
+	// Already counted as cancelled
+	if (request.token.is_cancelled())
+	{
+		return;
+	}
+	request.token.remove(request.cancel_id);
+
+	const auto latency = std::chrono::duration_cast<std::chrono::milliseconds>(
+		std::chrono::steady_clock::now() - request.started);
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		auto &current = metrics[request.endpoint];
+
+		// Could have been reset while in flight
+		if (current.in_flight == 0)
+		{
+			current.requests++;
+		}
+		else
+		{
+			current.in_flight--;
+		}
+
+		current.bytes_received += bytes_received;
+		current.add_latency(latency);
+	}
+
+	log(request, latency, bytes_received);
+	lib::trace::complete(request.endpoint, "http", request.trace_started);
+}
+
+void lib::spt::api_metrics::parsed(const request &request,
+	std::chrono::steady_clock::time_point started)
+{
+	const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - started);
+
+	if (lib::trace::is_enabled())
+	{
+		lib::trace::complete(request.endpoint, "json", lib::trace::now() - duration.count());
+	}
+
+	std::lock_guard<std::mutex> lock(mutex);
+	metrics[request.endpoint].total_parse += duration;
+}
+
+void lib::spt::api_metrics::failed(const request &request)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	metrics[request.endpoint].errors++;
+}
+
+void lib::spt::api_metrics::cancelled(const request &request)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	auto &current = metrics[request.endpoint];
+
+	// Could have been reset while in flight
+	if (current.in_flight == 0)
+	{
+		current.requests++;
+	}
+	else
+	{
+		current.in_flight--;
+	}
+
+	current.cancelled++;
+}
+
+void lib::spt::api_metrics::retried(const std::string &method, const std::string &url)
+{
+	const auto name = endpoint(method, url);
+
+	std::lock_guard<std::mutex> lock(mutex);
+	metrics[name].retries++;
+}
+
+auto lib::spt::api_metrics::endpoints() const -> std::map<std::string, endpoint_metrics>
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	return metrics;
+}
+
+auto lib::spt::api_metrics::to_json() const -> nlohmann::json
+{
+	nlohmann::json endpoints_json = nlohmann::json::object();
+	for (const auto &entry: endpoints())
+	{
+		endpoints_json[entry.first] = entry.second;
+	}
+
+	return {
+		{"endpoints", endpoints_json},
+	};
+}
+
+void lib::spt::api_metrics::reset()
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	metrics.clear();
+}
+
+auto lib::spt::api_metrics::endpoint(const std::string &method, const std::string &url) -> std::string
+{
+	auto path = url.substr(0, url.find('?'));
+
+	// Full URL, like https://api.spotify.com/v1/me
+	const auto scheme = path.find("://");
+	if (scheme != std::string::npos)
+	{
+		const auto host_end = path.find('/', scheme + 3);
+		path = host_end == std::string::npos
+			? std::string()
+			: path.substr(host_end + 1);
+	}
+
+	if (lib::strings::starts_with(path, "v1/"))
+	{
+		path = path.substr(3);
+	}
+
+	auto is_id = [](const std::string &segment) -> bool
+	{
+		// Spotify IDs are 22 characters of base 62
+		return segment.size() == 22
+			&& std::all_of(segment.cbegin(), segment.cend(), [](char chr) -> bool
+			{
+				return std::isalnum(static_cast<unsigned char>(chr)) != 0;
+			});
+	};
+
+	auto is_number = [](const std::string &segment) -> bool
+	{
+		return !segment.empty()
+			&& std::all_of(segment.cbegin(), segment.cend(), [](char chr) -> bool
+			{
+				return std::isdigit(static_cast<unsigned char>(chr)) != 0;
+			});
+	};
+
+	auto segments = lib::strings::split(path, '/');
+	for (size_t i = 0; i < segments.size(); i++)
+	{
+		if (i > 0 && segments.at(i - 1) == "users")
+		{
+			segments[i] = "{user_id}";
+		}
+		else if (is_id(segments.at(i)))
+		{
+			segments[i] = "{id}";
+		}
+		else if (is_number(segments.at(i)))
+		{
+			segments[i] = "{n}";
+		}
+	}
+
+	return lib::fmt::format("{} {}", method, lib::strings::join(segments, "/"));
+}
+
+void lib::spt::api_metrics::log(const request &request, std::chrono::milliseconds latency,
+	size_t bytes_received)
+{
+	lib::log::event(lib::log_type::information, "api", request.endpoint,
+		[latency, bytes_received]() -> lib::log_fields
+		{
+			return {
+				{"duration_ms", std::to_string(latency.count())},
+				{"bytes", std::to_string(bytes_received)},
+			};
+		});
+}
+
+//endregion
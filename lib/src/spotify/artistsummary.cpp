@@ -0,0 +1,38 @@
+#include "lib/spotify/artistsummary.hpp"
+#include "lib/json.hpp"
+
+auto lib::spt::artist_summary::is_null() const -> bool
+{
+	return sources == 0;
+}
+
+auto lib::spt::artist_summary::score() const -> double
+{
+	return static_cast<double>(tracks)
+		+ static_cast<double>(sources) * source_weight;
+}
+
+void lib::spt::to_json(nlohmann::json &j, const artist_summary &a)
+{
+	j = nlohmann::json{
+		{"name", a.name},
+		{"id", a.id},
+		{"sources", a.sources},
+		{"tracks", a.tracks},
+		{"last_added", a.last_added},
+	};
+}
+
+void lib::spt::from_json(const nlohmann::json &j, artist_summary &a)
+{
+	if (!j.is_object())
+	{
+		return;
+	}
+
+	j.at("name").get_to(a.name);
+	lib::json::get(j, "id", a.id);
+	lib::json::get(j, "sources", a.sources);
+	lib::json::get(j, "tracks", a.tracks);
+	lib::json::get(j, "last_added", a.last_added);
+}
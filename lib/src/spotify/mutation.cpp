@@ -0,0 +1,90 @@
+#include "lib/spotify/mutation.hpp"
+#include "lib/spotify/api.hpp"
+#include "lib/format.hpp"
+#include "lib/json.hpp"
+#include "lib/strings.hpp"
+
+auto lib::spt::mutation::cancels(const mutation &other) const -> bool
+{
+	return !target.empty()
+		&& target == other.target
+		&& value != other.value;
+}
+
+auto lib::spt::mutation::duplicates(const mutation &other) const -> bool
+{
+	return !target.empty()
+		&& target == other.target
+		&& value == other.value;
+}
+
+auto lib::spt::mutation::is_idempotent() const -> bool
+{
+	return !target.empty();
+}
+
+auto lib::spt::mutation::save_tracks(const std::vector<std::string> &track_ids,
+	bool saved) -> mutation
+{
+	const nlohmann::json body{
+		{"ids", track_ids},
+	};
+
+	mutation result;
+	result.method = saved ? "PUT" : "DELETE";
+	result.url = "me/tracks";
+	result.body = body.dump();
+	result.target = lib::fmt::format("track_saved:{}", lib::strings::join(track_ids, ","));
+	result.value = saved;
+	return result;
+}
+
+auto lib::spt::mutation::follow(lib::follow_type type, const std::vector<std::string> &ids,
+	bool following) -> mutation
+{
+	const auto type_string = lib::spt::api::follow_type_string(type);
+	const auto joined_ids = lib::strings::join(ids, ",");
+
+	mutation result;
+	result.method = following ? "PUT" : "DELETE";
+	result.url = lib::fmt::format("me/following?type={}&ids={}", type_string, joined_ids);
+	result.target = lib::fmt::format("{}_followed:{}", type_string, joined_ids);
+	result.value = following;
+	return result;
+}
+
+auto lib::spt::mutation::follow_playlist(const std::string &playlist_id,
+	bool following) -> mutation
+{
+	mutation result;
+	result.method = following ? "PUT" : "DELETE";
+	result.url = lib::fmt::format("playlists/{}/followers", playlist_id);
+	result.target = lib::fmt::format("playlist_followed:{}", playlist_id);
+	result.value = following;
+	return result;
+}
+
+void lib::spt::to_json(nlohmann::json &j, const mutation &m)
+{
+	j = nlohmann::json{
+		{"method", m.method},
+		{"url", m.url},
+		{"body", m.body},
+		{"target", m.target},
+		{"value", m.value},
+	};
+}
+
+void lib::spt::from_json(const nlohmann::json &j, mutation &m)
+{
+	if (!j.is_object())
+	{
+		return;
+	}
+
+	j.at("method").get_to(m.method);
+	j.at("url").get_to(m.url);
+	lib::json::get(j, "body", m.body);
+	lib::json::get(j, "target", m.target);
+	lib::json::get(j, "value", m.value);
+}
@@ -0,0 +1,189 @@
+#include "lib/spotify/mutationqueue.hpp"
+#include "lib/fmt.hpp"
+#include "lib/json.hpp"
+#include "lib/log.hpp"
+#include "lib/spotify/error.hpp"
+
+#include <algorithm>
+
+constexpr std::chrono::minutes lib::spt::mutation_queue::max_backoff;
+
+lib::spt::mutation_queue::mutation_queue(lib::spt::api &spotify,
+	const ghc::filesystem::path &path, std::chrono::milliseconds backoff)
+	: spotify(spotify),
+	path(path),
+	initial_backoff(backoff),
+	backoff(backoff)
+{
+	load();
+}
+
+auto lib::spt::mutation_queue::add(const lib::spt::mutation &mutation) -> bool
+{
+	// Sending again after restarting could for example add a track to the queue twice
+	if (!mutation.is_idempotent())
+	{
+		lib::log::warn("{} {} can't be sent again, so can't be queued",
+			mutation.method, mutation.url);
+		return false;
+	}
+
+	// Mutation being sent can't be changed anymore
+	const auto first = mutations.begin() + (sending ? 1 : 0);
+
+	const auto cancelled = std::find_if(first, mutations.end(),
+		[&mutation](const lib::spt::mutation &pending) -> bool
+		{
+			return mutation.cancels(pending)
+				|| mutation.duplicates(pending);
+		});
+
+	if (cancelled == mutations.end())
+	{
+		mutations.push_back(mutation);
+	}
+	else if (mutation.cancels(*cancelled))
+	{
+		lib::log::debug("Mutation of {} undone before being sent", mutation.target);
+		mutations.erase(cancelled);
+	}
+
+	save();
+
+	// Retry now, as user probably expects it to work
+	next_attempt = std::chrono::steady_clock::time_point();
+	flush();
+	return true;
+}
+
+void lib::spt::mutation_queue::flush()
+{
+	if (sending
+		|| mutations.empty()
+		|| std::chrono::steady_clock::now() < next_attempt)
+	{
+		return;
+	}
+
+	sending = true;
+	spotify.send(mutations.front(), [this](const lib::http_response &response)
+	{
+		sent(response);
+	});
+}
+
+void lib::spt::mutation_queue::sent(const lib::http_response &response)
+{
+	sending = false;
+	const auto mutation = mutations.front();
+
+	if (!response.is_success() && response.is_retryable())
+	{
+		lib::log::debug("{} {} failed with status {}, retrying in {} ms",
+			mutation.method, mutation.url, response.status, backoff.count());
+
+		spotify.get_metrics().retried(mutation.method, mutation.url);
+		next_attempt = std::chrono::steady_clock::now() + backoff;
+		backoff = std::min<std::chrono::milliseconds>(backoff * 2, max_backoff);
+		return;
+	}
+
+	mutations.erase(mutations.begin());
+
+	if (!response.is_success())
+	{
+		// Sending it again won't help
+		lib::log::error("{} {} failed with status {}: {}",
+			mutation.method, mutation.url, response.status, response.body);
+
+		if (failed_callback)
+		{
+			failed_callback(mutation, error_message(response));
+		}
+	}
+	else if (sent_callback)
+	{
+		sent_callback(mutation);
+	}
+
+	backoff = initial_backoff;
+	save();
+	flush();
+}
+
+auto lib::spt::mutation_queue::state(const std::string &target, bool value) const -> bool
+{
+	for (auto iter = mutations.crbegin(); iter != mutations.crend(); ++iter)
+	{
+		if (iter->target == target)
+		{
+			return iter->value;
+		}
+	}
+	return value;
+}
+
+auto lib::spt::mutation_queue::pending() const -> const std::vector<lib::spt::mutation> &
+{
+	return mutations;
+}
+
+void lib::spt::mutation_queue::on_sent(const std::function<void(const lib::spt::mutation &)> &callback)
+{
+	sent_callback = callback;
+}
+
+void lib::spt::mutation_queue::on_failed(const std::function<void(const lib::spt::mutation &,
+	const std::string &)> &callback)
+{
+	failed_callback = callback;
+}
+
+auto lib::spt::mutation_queue::error_message(const lib::http_response &response) -> std::string
+{
+	try
+	{
+		const auto message = lib::spt::error::error_message(nlohmann::json::parse(response.body));
+		if (!message.empty())
+		{
+			return message;
+		}
+	}
+	catch (const std::exception &)
+	{
+		// Not JSON, so no message
+	}
+
+	return lib::fmt::format("Request failed with status {}", response.status);
+}
+
+void lib::spt::mutation_queue::load()
+{
+	if (!ghc::filesystem::exists(path))
+	{
+		return;
+	}
+
+	try
+	{
+		mutations = lib::json::load<std::vector<lib::spt::mutation>>(path);
+		lib::log::debug("Loaded {} pending mutations", mutations.size());
+	}
+	catch (const std::exception &e)
+	{
+		lib::log::warn("Failed to load pending mutations: {}", e.what());
+	}
+}
+
+void lib::spt::mutation_queue::save() const
+{
+	std::error_code error;
+	if (mutations.empty())
+	{
+		ghc::filesystem::remove(path, error);
+		return;
+	}
+
+	ghc::filesystem::create_directories(path.parent_path(), error);
+	lib::json::save(path, mutations);
+}
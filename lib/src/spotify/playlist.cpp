@@ -102,9 +102,8 @@ auto lib::spt::playlist::is_null() const -> bool
 	return id.empty();
 }
 
-auto lib::spt::playlist::is_up_to_date(const std::string &playlist_snapshot,
-	const lib::spt::user &current_user) const -> bool
+auto lib::spt::playlist::is_up_to_date(const std::string &playlist_snapshot) const -> bool
 {
-	return owner_id != current_user.id
+	return !snapshot.empty()
 		&& snapshot == playlist_snapshot;
 }
@@ -0,0 +1,250 @@
+#include "lib/spotify/playlisteditor.hpp"
+#include "lib/spotify/util.hpp"
+
+#include <algorithm>
+
+lib::spt::playlist_editor::playlist_editor(lib::spt::api &spotify, lib::cache &cache)
+	: spotify(spotify),
+	cache(cache)
+{
+}
+
+void lib::spt::playlist_editor::add(const std::string &playlist_id,
+	const std::vector<std::string> &track_uris,
+	lib::callback<lib::result<std::string>> &callback)
+{
+	// Only patched if still the same when responded to
+	const auto initial = cache.get_playlist_summary(playlist_id).snapshot;
+
+	spotify.add_to_playlist(playlist_id, track_uris,
+		[this, playlist_id, track_uris, initial, callback](const lib::result<std::string> &result)
+		{
+			callback(result);
+			if (!result.success())
+			{
+				return;
+			}
+
+			// Not cached, so fetched in full when opened
+			auto cached = cache.get_playlist(playlist_id);
+			if (cached.is_null())
+			{
+				return;
+			}
+
+			const auto snapshot = result.value();
+			if (snapshot.empty() || cached.snapshot != initial)
+			{
+				invalidate(cached);
+				save(cached);
+				return;
+			}
+
+			const auto offset = cached.tracks.size();
+			spotify.playlist_tracks(playlist_id, offset,
+				[this, playlist_id, initial, offset, track_uris, snapshot]
+					(const std::vector<lib::spt::track> &added)
+				{
+					// Playlist may have been synced while fetching
+					auto current = cache.get_playlist(playlist_id);
+					apply_add(current, initial, offset, track_uris, added, snapshot);
+					save(current);
+				});
+		});
+}
+
+void lib::spt::playlist_editor::remove(const std::string &playlist_id,
+	const std::vector<std::pair<int, std::string>> &track_index_uris,
+	lib::callback<lib::result<std::string>> &callback)
+{
+	// Only patched if still the same when responded to
+	const auto initial = cache.get_playlist_summary(playlist_id).snapshot;
+
+	spotify.remove_from_playlist(playlist_id, track_index_uris,
+		[this, playlist_id, track_index_uris, initial, callback]
+			(const lib::result<std::string> &result)
+		{
+			if (result.success())
+			{
+				auto cached = cache.get_playlist(playlist_id);
+				if (!cached.is_null())
+				{
+					apply_remove(cached, initial, track_index_uris, result.value());
+					save(cached);
+				}
+			}
+
+			callback(result);
+		});
+}
+
+void lib::spt::playlist_editor::reorder(const std::string &playlist_id,
+	const std::vector<size_t> &order, lib::callback<lib::result<std::string>> &callback)
+{
+	const auto cached = cache.get_playlist(playlist_id);
+	if (cached.is_null()
+		|| cached.tracks.size() != order.size()
+		|| !lib::spt::playlist_move::is_valid_order(order))
+	{
+		callback(lib::result<std::string>::fail("Playlist is outdated, refresh and try again"));
+		return;
+	}
+
+	const auto moves = std::make_shared<std::vector<lib::spt::playlist_move>>(
+		lib::spt::playlist_move::from_order(order));
+
+	lib::log::debug("Reordering {} tracks in {} moves", order.size(), moves->size());
+
+	const auto initial = cached.snapshot;
+	move(playlist_id, moves, 0, initial,
+		[this, playlist_id, order, initial, callback](const lib::result<std::string> &result)
+		{
+			auto current = cache.get_playlist(playlist_id);
+			if (!current.is_null())
+			{
+				if (result.success()
+					&& current.snapshot == initial
+					&& current.tracks.size() == order.size())
+				{
+					std::vector<lib::spt::track> tracks;
+					tracks.reserve(order.size());
+					for (const auto position: order)
+					{
+						tracks.push_back(current.tracks.at(position));
+					}
+					current.tracks = tracks;
+					current.snapshot = result.value();
+				}
+				else
+				{
+					// Partially reordered, or changed while reordering
+					invalidate(current);
+				}
+				save(current);
+			}
+
+			callback(result);
+		});
+}
+
+void lib::spt::playlist_editor::move(const std::string &playlist_id,
+	const std::shared_ptr<std::vector<lib::spt::playlist_move>> &moves,
+	size_t index, const std::string &snapshot,
+	lib::callback<lib::result<std::string>> &callback)
+{
+	if (index >= moves->size())
+	{
+		callback(lib::result<std::string>::ok(snapshot));
+		return;
+	}
+
+	// Each move depends on the previous one, so only one can be sent at a time
+	spotify.reorder_playlist(playlist_id, moves->at(index), snapshot,
+		[this, playlist_id, moves, index, callback](const lib::result<std::string> &result)
+		{
+			if (!result.success())
+			{
+				callback(result);
+				return;
+			}
+
+			move(playlist_id, moves, index + 1, result.value(), callback);
+		});
+}
+
+auto lib::spt::playlist_editor::apply_add(lib::spt::playlist &playlist,
+	const std::string &initial, size_t offset,
+	const std::vector<std::string> &track_uris,
+	const std::vector<lib::spt::track> &added,
+	const std::string &snapshot) -> bool
+{
+	if (snapshot.empty()
+		|| playlist.snapshot != initial
+		|| playlist.tracks.size() != offset
+		|| added.size() != track_uris.size())
+	{
+		invalidate(playlist);
+		return false;
+	}
+
+	for (size_t i = 0; i < added.size(); i++)
+	{
+		if (added.at(i).id != lib::spt::uri_to_id(track_uris.at(i)))
+		{
+			invalidate(playlist);
+			return false;
+		}
+	}
+
+	playlist.tracks.insert(playlist.tracks.end(), added.cbegin(), added.cend());
+	playlist.tracks_total = static_cast<int>(playlist.tracks.size());
+	playlist.snapshot = snapshot;
+	return true;
+}
+
+auto lib::spt::playlist_editor::apply_remove(lib::spt::playlist &playlist,
+	const std::string &initial,
+	const std::vector<std::pair<int, std::string>> &track_index_uris,
+	const std::string &snapshot) -> bool
+{
+	std::vector<std::pair<int, std::string>> removed = track_index_uris;
+	std::sort(removed.begin(), removed.end());
+	removed.erase(std::unique(removed.begin(), removed.end()), removed.end());
+
+	const auto is_valid = !snapshot.empty()
+		&& playlist.snapshot == initial
+		&& std::all_of(removed.cbegin(), removed.cend(),
+			[&playlist](const std::pair<int, std::string> &track) -> bool
+			{
+				return track.first >= 0
+					&& static_cast<size_t>(track.first) < playlist.tracks.size()
+					&& playlist.tracks.at(track.first).id == lib::spt::uri_to_id(track.second);
+			});
+
+	if (!is_valid)
+	{
+		invalidate(playlist);
+		return false;
+	}
+
+	// Remove from the end to keep earlier positions valid
+	for (auto iter = removed.crbegin(); iter != removed.crend(); ++iter)
+	{
+		playlist.tracks.erase(playlist.tracks.begin() + iter->first);
+	}
+
+	playlist.tracks_total = static_cast<int>(playlist.tracks.size());
+	playlist.snapshot = snapshot;
+	return true;
+}
+
+void lib::spt::playlist_editor::save(const lib::spt::playlist &playlist)
+{
+	cache.set_playlist(playlist);
+
+	// Keep old snapshot if outdated, so it's fetched again
+	if (playlist.snapshot.empty())
+	{
+		return;
+	}
+
+	auto playlists = cache.get_playlists();
+	for (auto &item: playlists)
+	{
+		if (item.id == playlist.id)
+		{
+			item.snapshot = playlist.snapshot;
+			item.tracks_total = playlist.tracks_total;
+			cache.set_playlists(playlists);
+			return;
+		}
+	}
+}
+
+void lib::spt::playlist_editor::invalidate(lib::spt::playlist &playlist)
+{
+	lib::log::warn("Playlist {} changed while editing, fetching it again later",
+		playlist.id);
+
+	playlist.snapshot.clear();
+}
@@ -0,0 +1,158 @@
+#include "lib/spotify/playlistmove.hpp"
+
+#include <algorithm>
+
+lib::spt::playlist_move::playlist_move(size_t range_start, size_t insert_before,
+	size_t range_length)
+	: range_start(range_start),
+	insert_before(insert_before),
+	range_length(range_length)
+{
+}
+
+auto lib::spt::playlist_move::is_valid_order(const std::vector<size_t> &order) -> bool
+{
+	std::vector<bool> found(order.size(), false);
+	for (const auto position: order)
+	{
+		if (position >= order.size() || found[position])
+		{
+			return false;
+		}
+		found[position] = true;
+	}
+	return true;
+}
+
+auto lib::spt::playlist_move::to_order(const std::vector<size_t> &positions)
+-> std::vector<size_t>
+{
+	auto sorted = positions;
+	std::sort(sorted.begin(), sorted.end());
+
+	std::vector<size_t> order;
+	order.reserve(positions.size());
+	for (const auto position: positions)
+	{
+		const auto iter = std::lower_bound(sorted.cbegin(), sorted.cend(), position);
+		order.push_back(static_cast<size_t>(iter - sorted.cbegin()));
+	}
+	return order;
+}
+
+auto lib::spt::playlist_move::from_order(const std::vector<size_t> &order)
+-> std::vector<playlist_move>
+{
+	std::vector<playlist_move> moves;
+	if (!is_valid_order(order))
+	{
+		return moves;
+	}
+
+	// New position of each track, in current order
+	std::vector<size_t> current(order.size());
+	for (size_t i = 0; i < order.size(); i++)
+	{
+		current[order[i]] = i;
+	}
+
+	// Tracks that stay in place, by new position
+	const auto increasing = longest_increasing(current);
+	std::vector<bool> fixed(order.size(), false);
+	for (size_t i = 0; i < current.size(); i++)
+	{
+		fixed[current[i]] = increasing[i];
+	}
+
+	auto position_of = [&current](size_t track) -> size_t
+	{
+		return static_cast<size_t>(std::find(current.cbegin(), current.cend(), track)
+			- current.cbegin());
+	};
+
+	size_t track = 0;
+	while (track < current.size())
+	{
+		if (fixed[track])
+		{
+			track++;
+			continue;
+		}
+
+		// Tracks already next to each other are moved together
+		const auto start = position_of(track);
+		size_t length = 1;
+		while (track + length < current.size()
+			&& !fixed[track + length]
+			&& start + length < current.size()
+			&& current[start + length] == track + length)
+		{
+			length++;
+		}
+
+		// Previous track is already in place, so insert after it
+		const auto before = track == 0 ? 0 : position_of(track - 1) + 1;
+		if (before != start)
+		{
+			moves.emplace_back(start, before, length);
+			moves.back().apply(current);
+		}
+
+		track += length;
+	}
+
+	return moves;
+}
+
+auto lib::spt::playlist_move::longest_increasing(const std::vector<size_t> &values)
+-> std::vector<bool>
+{
+	// Index of smallest last value of each subsequence length, and previous index of each value
+	std::vector<size_t> tails;
+	std::vector<size_t> previous(values.size(), values.size());
+
+	for (size_t i = 0; i < values.size(); i++)
+	{
+		const auto tail = std::lower_bound(tails.begin(), tails.end(), values[i],
+			[&values](size_t index, size_t value) -> bool
+			{
+				return values[index] < value;
+			});
+
+		if (tail != tails.begin())
+		{
+			previous[i] = *(tail - 1);
+		}
+
+		if (tail == tails.end())
+		{
+			tails.push_back(i);
+		}
+		else
+		{
+			*tail = i;
+		}
+	}
+
+	std::vector<bool> result(values.size(), false);
+	if (tails.empty())
+	{
+		return result;
+	}
+
+	for (auto i = tails.back(); i < values.size(); i = previous[i])
+	{
+		result[i] = true;
+	}
+
+	return result;
+}
+
+void lib::spt::to_json(nlohmann::json &j, const playlist_move &m)
+{
+	j = nlohmann::json{
+		{"range_start", m.range_start},
+		{"insert_before", m.insert_before},
+		{"range_length", m.range_length},
+	};
+}
@@ -0,0 +1,51 @@
+#include "lib/spotify/playlistsummary.hpp"
+#include "lib/datetime.hpp"
+
+lib::spt::playlist_summary::playlist_summary(const lib::spt::playlist &playlist)
+	: id(playlist.id),
+	track_count(playlist.tracks.size()),
+	owner_id(playlist.owner_id),
+	snapshot(playlist.snapshot)
+{
+	for (const auto &track: playlist.tracks)
+	{
+		duration += track.duration;
+
+		if (lib::date_time::is_later(track.added_at, latest_added))
+		{
+			latest_added = track.added_at;
+		}
+	}
+}
+
+auto lib::spt::playlist_summary::is_null() const -> bool
+{
+	return id.empty();
+}
+
+void lib::spt::to_json(nlohmann::json &j, const playlist_summary &p)
+{
+	j = nlohmann::json{
+		{"id", p.id},
+		{"latest_added", p.latest_added},
+		{"track_count", p.track_count},
+		{"duration", p.duration},
+		{"owner_id", p.owner_id},
+		{"snapshot", p.snapshot},
+	};
+}
+
+void lib::spt::from_json(const nlohmann::json &j, playlist_summary &p)
+{
+	if (!j.is_object())
+	{
+		return;
+	}
+
+	j.at("id").get_to(p.id);
+	lib::json::get(j, "latest_added", p.latest_added);
+	lib::json::get(j, "track_count", p.track_count);
+	lib::json::get(j, "duration", p.duration);
+	lib::json::get(j, "owner_id", p.owner_id);
+	lib::json::get(j, "snapshot", p.snapshot);
+}
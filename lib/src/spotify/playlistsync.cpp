@@ -0,0 +1,101 @@
+#include "lib/spotify/playlistsync.hpp"
+
+lib::spt::playlist_sync::playlist_sync(lib::spt::api &spotify,
+	lib::cache &cache, size_t max_running, std::chrono::milliseconds timeout)
+	: spotify(spotify),
+	cache(cache),
+	queue(max_running),
+	timeout(timeout)
+{
+}
+
+void lib::spt::playlist_sync::sync(const std::vector<lib::spt::playlist> &playlists,
+	lib::callback<lib::spt::playlist> &callback)
+{
+	check_timeouts();
+
+	for (const auto &playlist: playlists)
+	{
+		if (jobs.find(playlist.id) != jobs.end()
+			|| !is_changed(playlist, cache.get_playlist_summary(playlist.id)))
+		{
+			continue;
+		}
+
+		const auto job_generation = ++generation;
+		jobs[playlist.id].generation = job_generation;
+
+		queue.add([this, playlist, callback, job_generation](const lib::async_queue::done &done)
+		{
+			auto iter = jobs.find(playlist.id);
+			if (iter == jobs.end() || iter->second.generation != job_generation)
+			{
+				done();
+				return;
+			}
+
+			iter->second.started = std::chrono::steady_clock::now();
+			iter->second.done = done;
+
+			spotify.playlist_tracks(playlist, [this, playlist, callback, job_generation]
+				(const std::vector<lib::spt::track> &tracks)
+			{
+				// Timed out, and possibly replaced by a newer job, while fetching
+				auto current = jobs.find(playlist.id);
+				if (current == jobs.end() || current->second.generation != job_generation)
+				{
+					lib::log::debug("Ignoring late response for playlist {}", playlist.id);
+					return;
+				}
+
+				const auto done = current->second.done;
+				jobs.erase(current);
+
+				auto updated = playlist;
+				updated.tracks = tracks;
+				cache.set_playlist(updated);
+
+				callback(updated);
+				done();
+			});
+		});
+	}
+}
+
+void lib::spt::playlist_sync::check_timeouts()
+{
+	const auto now = std::chrono::steady_clock::now();
+	std::vector<lib::async_queue::done> timed_out;
+
+	for (auto iter = jobs.begin(); iter != jobs.end();)
+	{
+		const auto &current = iter->second;
+		if (!current.done || now - current.started < timeout)
+		{
+			++iter;
+			continue;
+		}
+
+		lib::log::warn("Fetching playlist {} timed out, retrying later", iter->first);
+		timed_out.push_back(current.done);
+		iter = jobs.erase(iter);
+	}
+
+	// Finishing jobs may start new ones, so only finish after iterating
+	for (const auto &done: timed_out)
+	{
+		done();
+	}
+}
+
+auto lib::spt::playlist_sync::is_changed(const lib::spt::playlist &playlist,
+	const lib::spt::playlist_summary &cached) -> bool
+{
+	return cached.is_null()
+		|| cached.snapshot != playlist.snapshot;
+}
+
+auto lib::spt::playlist_sync::remaining() const -> size_t
+{
+	return jobs.size();
+}
@@ -0,0 +1,225 @@
+#include "lib/spotify/releasefeed.hpp"
+#include "lib/datetime.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <utility>
+
+lib::spt::release_feed::release_feed(lib::spt::api &spotify,
+	lib::cache &cache, size_t max_running, std::chrono::milliseconds timeout)
+	: spotify(spotify),
+	cache(cache),
+	max_running(std::max<size_t>(max_running, 1)),
+	timeout(timeout)
+{
+}
+
+void lib::spt::release_feed::load(lib::callback<std::vector<lib::spt::track>> &callback)
+{
+	const auto date = lib::date_time::now().to_iso_date();
+	if (date == loaded_date)
+	{
+		callback(tracks);
+		return;
+	}
+
+	const auto load = std::make_shared<state>(max_running, date, callback);
+	current = load;
+
+	spotify.new_releases([this, load](const std::vector<lib::spt::album> &releases)
+	{
+		if (load == current)
+		{
+			fetch(releases, load);
+		}
+	});
+}
+
+void lib::spt::release_feed::check_timeouts()
+{
+	const auto load = current;
+	if (!load)
+	{
+		return;
+	}
+
+	const auto now = std::chrono::steady_clock::now();
+	std::vector<size_t> timed_out;
+	for (const auto &running: load->running)
+	{
+		if (now - running.second.first >= timeout)
+		{
+			timed_out.push_back(running.first);
+		}
+	}
+
+	for (const auto index: timed_out)
+	{
+		lib::log::warn("Fetching new release timed out, retrying on next load");
+
+		// Finishing may start the next album, so remove it first
+		const auto done = load->running.at(index).second;
+		load->running.erase(index);
+		load->timed_out = true;
+
+		loaded(load, index, {});
+		done();
+	}
+}
+
+void lib::spt::release_feed::fetch(const std::vector<lib::spt::album> &releases,
+	const std::shared_ptr<state> &load)
+{
+	std::vector<lib::spt::album> matches;
+	std::copy_if(releases.cbegin(), releases.cend(), std::back_inserter(matches),
+		[this](const lib::spt::album &album) -> bool
+		{
+			return is_match(album);
+		});
+
+	// Releases never change, so reuse tracks from previous load
+	std::map<std::string, std::vector<lib::spt::track>> previous;
+	for (const auto &track: cache.get_tracks(cache_id))
+	{
+		previous[track.album.id].push_back(track);
+	}
+
+	load->albums.resize(matches.size());
+	load->remaining = matches.size();
+
+	if (matches.empty())
+	{
+		loaded(load, 0, {});
+		return;
+	}
+
+	for (size_t i = 0; i < matches.size(); i++)
+	{
+		const auto &album = matches.at(i);
+		const auto cached = previous.find(album.id);
+		if (cached != previous.end())
+		{
+			loaded(load, i, cached->second);
+			continue;
+		}
+
+		// Queued jobs only hold a weak reference, as the queue is owned by the load
+		const std::weak_ptr<state> weak = load;
+		load->queue.add([this, weak, album, i](const lib::async_queue::done &done)
+		{
+			const auto owner = weak.lock();
+			if (!owner || owner != current)
+			{
+				done();
+				return;
+			}
+
+			owner->running[i] = std::make_pair(std::chrono::steady_clock::now(), done);
+
+			spotify.album_tracks(album, [this, owner, album, i, done]
+				(const std::vector<lib::spt::track> &results)
+			{
+				// Already skipped if timed out
+				if (owner->running.erase(i) == 0)
+				{
+					return;
+				}
+
+				loaded(owner, i, album_tracks(album, results));
+				done();
+			});
+		});
+	}
+}
+
+void lib::spt::release_feed::loaded(const std::shared_ptr<state> &load, size_t index,
+	const std::vector<lib::spt::track> &album_tracks)
+{
+	if (load != current)
+	{
+		return;
+	}
+
+	if (index < load->albums.size())
+	{
+		load->albums[index] = album_tracks;
+		load->remaining--;
+		load->since_callback++;
+	}
+
+	// Merging and reloading all tracks for every album is slow with many releases
+	if (load->remaining > 0 && load->since_callback < max_running)
+	{
+		return;
+	}
+	load->since_callback = 0;
+
+	const auto merged = merge(load->albums);
+	if (load->remaining == 0)
+	{
+		// Timed out releases aren't cached, so they're fetched again on next load
+		cache.set_tracks(cache_id, merged);
+		if (!load->timed_out)
+		{
+			loaded_date = load->date;
+			tracks = merged;
+		}
+	}
+
+	load->callback(merged);
+}
+
+auto lib::spt::release_feed::is_match(const lib::spt::album &album) const -> bool
+{
+	return !cache.get_artist_summary(album.artist).is_null();
+}
+
+auto lib::spt::release_feed::album_tracks(const lib::spt::album &album,
+	const std::vector<lib::spt::track> &tracks) -> std::vector<lib::spt::track>
+{
+	std::vector<lib::spt::track> results;
+	results.reserve(tracks.size());
+
+	for (const auto &track: tracks)
+	{
+		auto result = track;
+		result.album.id = album.id;
+		result.album.name = album.name;
+		result.added_at = album.release_date;
+		results.push_back(result);
+	}
+
+	return results;
+}
+
+auto lib::spt::release_feed::merge(const std::vector<std::vector<lib::spt::track>> &albums)
+-> std::vector<lib::spt::track>
+{
+	std::vector<lib::spt::track> merged;
+	for (const auto &album: albums)
+	{
+		merged.insert(merged.end(), album.cbegin(), album.cend());
+	}
+
+	// Stable to keep releases from the same date, and tracks, in order
+	std::stable_sort(merged.begin(), merged.end(),
+		[](const lib::spt::track &track1, const lib::spt::track &track2) -> bool
+		{
+			return track1.added_at > track2.added_at;
+		});
+
+	return merged;
+}
+
+//region state
+
+lib::spt::release_feed::state::state(size_t max_running, std::string date,
+	lib::callback<std::vector<lib::spt::track>> &callback)
+	: queue(max_running),
+	date(std::move(date)),
+	callback(callback)
+{
+}
+
+//endregion
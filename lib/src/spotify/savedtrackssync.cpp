@@ -0,0 +1,122 @@
+#include "lib/spotify/savedtrackssync.hpp"
+
+#include <unordered_map>
+
+lib::spt::saved_tracks_sync::saved_tracks_sync(lib::spt::api &spotify, lib::cache &cache)
+	: spotify(spotify),
+	cache(cache)
+{
+}
+
+void lib::spt::saved_tracks_sync::sync(lib::callback<std::vector<lib::spt::track>> &callback)
+{
+	const auto cached = cache.get_tracks(cache_id);
+
+	// Nothing to merge with
+	if (cached.empty())
+	{
+		fetch_all(callback);
+		return;
+	}
+
+	fetch(cached, {}, callback);
+}
+
+auto lib::spt::saved_tracks_sync::merge(const std::vector<lib::spt::track> &cached,
+	const std::vector<lib::spt::track> &fetched, size_t total,
+	std::vector<lib::spt::track> &merged) -> merge_result
+{
+	std::unordered_map<std::string, size_t> cached_indices;
+	cached_indices.reserve(cached.size());
+	for (size_t i = 0; i < cached.size(); i++)
+	{
+		cached_indices[key(cached[i])] = i;
+	}
+
+	for (size_t i = 0; i < fetched.size(); i++)
+	{
+		const auto cached_index = cached_indices.find(key(fetched[i]));
+		if (cached_index == cached_indices.end())
+		{
+			continue;
+		}
+
+		// Newer tracks, then everything cached from the first known track,
+		// skipping cached tracks saved before it, as they have been removed
+		std::vector<lib::spt::track> tracks;
+		tracks.reserve(i + cached.size() - cached_index->second);
+		tracks.insert(tracks.end(), fetched.cbegin(),
+			fetched.cbegin() + static_cast<std::ptrdiff_t>(i));
+		tracks.insert(tracks.end(), cached.cbegin()
+			+ static_cast<std::ptrdiff_t>(cached_index->second), cached.cend());
+
+		if (tracks.size() != total)
+		{
+			return merge_result::diverged;
+		}
+
+		merged = std::move(tracks);
+		return merge_result::merged;
+	}
+
+	// Everything was fetched without finding a cached track
+	if (fetched.size() >= total)
+	{
+		merged = fetched;
+		return merge_result::merged;
+	}
+
+	return merge_result::incomplete;
+}
+
+void lib::spt::saved_tracks_sync::fetch(const std::vector<lib::spt::track> &cached,
+	const std::vector<lib::spt::track> &fetched,
+	lib::callback<std::vector<lib::spt::track>> &callback)
+{
+	spotify.saved_tracks(fetched.size(), [this, cached, fetched, callback]
+		(const lib::spt::page<lib::spt::track> &page)
+	{
+		auto tracks = fetched;
+		lib::vector::append(tracks, page.items);
+
+		std::vector<lib::spt::track> merged;
+		const auto result = merge(cached, tracks, page.total, merged);
+
+		if (result == merge_result::incomplete && page.has_next && !page.items.empty())
+		{
+			fetch(cached, tracks, callback);
+			return;
+		}
+
+		if (result != merge_result::merged)
+		{
+			lib::log::debug("Saved tracks changed, fetching all {} tracks", page.total);
+			fetch_all(callback);
+			return;
+		}
+
+		// Avoid rewriting cache if nothing changed
+		if (merged.size() != cached.size()
+			|| merged.empty()
+			|| key(merged.front()) != key(cached.front()))
+		{
+			cache.set_tracks(cache_id, merged);
+		}
+
+		callback(merged);
+	});
+}
+
+void lib::spt::saved_tracks_sync::fetch_all(lib::callback<std::vector<lib::spt::track>> &callback)
+{
+	spotify.saved_tracks([this, callback](const std::vector<lib::spt::track> &tracks)
+	{
+		cache.set_tracks(cache_id, tracks);
+		callback(tracks);
+	});
+}
+
+auto lib::spt::saved_tracks_sync::key(const lib::spt::track &track) -> std::string
+{
+	return lib::fmt::format("{}/{}", track.id, track.added_at);
+}
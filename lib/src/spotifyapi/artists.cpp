@@ -35,3 +35,34 @@ void lib::spt::api::albums(const lib::spt::artist &artist,
 	get_items(lib::fmt::format("artists/{}/albums?country=from_token",
 		artist.id), callback);
 }
+
+auto lib::spt::api::artist(const std::string &id) -> lib::future<lib::spt::artist>
+{
+	lib::promise<lib::spt::artist> promise;
+	artist(id, promise.resolver());
+	return promise.get_future();
+}
+
+auto lib::spt::api::top_tracks(const lib::spt::artist &artist)
+-> lib::future<std::vector<lib::spt::track>>
+{
+	lib::promise<std::vector<lib::spt::track>> promise;
+	top_tracks(artist, promise.resolver());
+	return promise.get_future();
+}
+
+auto lib::spt::api::related_artists(const lib::spt::artist &artist)
+-> lib::future<std::vector<lib::spt::artist>>
+{
+	lib::promise<std::vector<lib::spt::artist>> promise;
+	related_artists(artist, promise.resolver());
+	return promise.get_future();
+}
+
+auto lib::spt::api::albums(const lib::spt::artist &artist)
+-> lib::future<std::vector<lib::spt::album>>
+{
+	lib::promise<std::vector<lib::spt::album>> promise;
+	albums(artist, promise.resolver());
+	return promise.get_future();
+}
@@ -15,6 +15,12 @@ void lib::spt::api::saved_tracks(lib::callback<std::vector<lib::spt::track>> &ca
 	get_items("me/tracks?limit=50", callback);
 }
 
+void lib::spt::api::saved_tracks(size_t offset,
+	lib::callback<lib::spt::page<lib::spt::track>> &callback)
+{
+	get(lib::fmt::format("me/tracks?limit=50&offset={}", offset), callback);
+}
+
 void lib::spt::api::add_saved_tracks(const std::vector<std::string> &track_ids,
 	lib::callback<std::string> &callback)
 {
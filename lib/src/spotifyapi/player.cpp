@@ -66,21 +66,21 @@ void lib::spt::api::play_tracks(int track_index, const std::vector<std::string>
 	lib::log::debug("Playing track {} ({} total)", track_index, all.size());
 
 	auto maxQueue = settings.spotify.max_queue;
-	std::vector<std::string> items;
+	nlohmann::json uris;
 	if (all.size() > static_cast<size_t>(maxQueue))
 	{
 		lib::log::info("Attempting to queue {} tracks, but only {} allowed",
 			all.size(), maxQueue);
-		items = lib::vector::sub(all, track_index, maxQueue);
+		uris = lib::vector::sub(all, track_index, maxQueue);
 		track_index = 0;
 	}
 	else
 	{
-		items = all;
+		uris = all;
 	}
 
 	nlohmann::json body{
-		{"uris", items},
+		{"uris", std::move(uris)},
 		{"offset", {
 			{"position", track_index}
 		}}
@@ -65,17 +65,48 @@ void lib::spt::api::playlist_tracks(const lib::spt::playlist &playlist,
 	}
 }
 
+void lib::spt::api::playlist_tracks(const std::string &playlist_id, size_t offset,
+	lib::callback<std::vector<lib::spt::track>> &callback)
+{
+	get_items(lib::fmt::format("playlists/{}/tracks?offset={}&market=from_token",
+		playlist_id, offset), callback);
+}
+
+auto lib::spt::api::snapshot_result(const lib::result<nlohmann::json> &result)
+-> lib::result<std::string>
+{
+	if (!result.success())
+	{
+		return lib::result<std::string>::fail(result.message());
+	}
+
+	// Edits always respond with a snapshot, so no response means the request failed
+	if (result.value().is_null())
+	{
+		return lib::result<std::string>::fail("No response from Spotify");
+	}
+
+	// Request still succeeded if snapshot is missing
+	std::string snapshot;
+	lib::json::get(result.value(), "snapshot_id", snapshot);
+	return lib::result<std::string>::ok(snapshot);
+}
+
 void lib::spt::api::add_to_playlist(const std::string &playlist_id,
 	const std::vector<std::string> &track_uris,
-	lib::callback<std::string> &callback)
+	lib::callback<lib::result<std::string>> &callback)
 {
 	post(lib::fmt::format("playlists/{}/tracks?uris={}",
-		playlist_id, lib::strings::join(track_uris, ",")), callback);
+		playlist_id, lib::strings::join(track_uris, ",")),
+		[callback](const lib::result<nlohmann::json> &result)
+		{
+			callback(snapshot_result(result));
+		});
 }
 
 void lib::spt::api::remove_from_playlist(const std::string &playlist_id,
 	const std::vector<std::pair<int, std::string>> &track_index_uris,
-	lib::callback<std::string> &callback)
+	lib::callback<lib::result<std::string>> &callback)
 {
 	auto tracks = nlohmann::json::array();
 
@@ -89,7 +120,30 @@ void lib::spt::api::remove_from_playlist(const std::string &playlist_id,
 		});
 	}
 
-	del(lib::fmt::format("playlists/{}/tracks", playlist_id), {
+	const nlohmann::json body{
 		{"tracks", tracks},
-	}, callback);
+	};
+
+	del(lib::fmt::format("playlists/{}/tracks", playlist_id), body,
+		[callback](const lib::result<nlohmann::json> &result)
+		{
+			callback(snapshot_result(result));
+		});
+}
+
+void lib::spt::api::reorder_playlist(const std::string &playlist_id,
+	const lib::spt::playlist_move &move, const std::string &snapshot,
+	lib::callback<lib::result<std::string>> &callback)
+{
+	nlohmann::json body = move;
+	if (!snapshot.empty())
+	{
+		body["snapshot_id"] = snapshot;
+	}
+
+	put(lib::fmt::format("playlists/{}/tracks", playlist_id), body,
+		[callback](const lib::result<nlohmann::json> &result)
+		{
+			callback(snapshot_result(result));
+		});
 }
@@ -202,3 +202,76 @@ auto lib::strings::erase_non_alpha(const std::string &str) -> std::string
 
 	return val;
 }
+
+auto lib::strings::normalize(const std::string &str) -> std::string
+{
+	// Replacements for U+00C0-U+017F, "?" means no replacement
+	constexpr const char *latin1 = "aaaaaa?ceeeeiiiidnooooo?ouuuuy??"
+		"aaaaaa?ceeeeiiiidnooooo?ouuuuy?y";
+	constexpr const char *latin_ext = "aaaaaaccccccccddddeeeeeeeeeegggggggg"
+		"hhhhiiiiiiiiii??jjkkklllllll"
+		"lllnnnnnnnnnoooooo??rrrrrrsssssssstttttt"
+		"uuuuuuuuuuuuwwyyyzzzzzzs";
+
+	std::string val;
+	val.reserve(str.size());
+
+	for (size_t i = 0; i < str.size(); i++)
+	{
+		const auto chr = static_cast<unsigned char>(str[i]);
+		if (chr < 0x80)
+		{
+			val.push_back(static_cast<char>(std::tolower(chr)));
+			continue;
+		}
+
+		const auto next = i + 1 < str.size()
+			? static_cast<unsigned char>(str[i + 1])
+			: 0;
+
+		if (chr < 0xc3 || chr > 0xc5 || (next & 0xc0) != 0x80)
+		{
+			val.push_back(str[i]);
+			continue;
+		}
+
+		const auto code_point = ((chr & 0x1f) << 6) | (next & 0x3f);
+		i++;
+
+		switch (code_point)
+		{
+			case 0xc6: // Æ
+			case 0xe6: // æ
+				val.append("ae");
+				continue;
+
+			case 0xdf: // ß
+				val.append("ss");
+				continue;
+
+			case 0x152: // Œ
+			case 0x153: // œ
+				val.append("oe");
+				continue;
+
+			default:
+				break;
+		}
+
+		const auto replacement = code_point < 0x100
+			? latin1[code_point - 0xc0]
+			: latin_ext[code_point - 0x100];
+
+		if (replacement == '?')
+		{
+			val.push_back(static_cast<char>(chr));
+			val.push_back(static_cast<char>(next));
+		}
+		else
+		{
+			val.push_back(replacement);
+		}
+	}
+
+	return val;
+}
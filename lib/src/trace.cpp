@@ -0,0 +1,143 @@
+#include "lib/trace.hpp"
+#include "lib/log.hpp"
+
+#include <chrono>
+#include <fstream>
+
+std::atomic<bool> lib::trace::enabled(false);
+
+void lib::trace::start()
+{
+	// Start measuring from now
+	now();
+	enabled = true;
+}
+
+void lib::trace::stop()
+{
+	enabled = false;
+}
+
+auto lib::trace::now() -> long long
+{
+	static const auto epoch = std::chrono::steady_clock::now();
+
+	return std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - epoch).count();
+}
+
+void lib::trace::complete(const std::string &name, const std::string &category,
+	long long started)
+{
+	if (!is_enabled() || started < 0)
+	{
+		return;
+	}
+
+	event item;
+	item.name = name;
+	item.category = category;
+	item.thread_id = thread_id();
+	item.timestamp = started;
+	item.duration = now() - started;
+
+	auto &current = get_events();
+	std::lock_guard<std::mutex> lock(current.mutex);
+	current.recorded.push_back(std::move(item));
+}
+
+void lib::trace::set_thread_name(const std::string &name)
+{
+	auto &current = get_events();
+	std::lock_guard<std::mutex> lock(current.mutex);
+	current.thread_names.emplace_back(thread_id(), name);
+}
+
+auto lib::trace::to_json() -> nlohmann::json
+{
+	auto &current = get_events();
+	std::lock_guard<std::mutex> lock(current.mutex);
+
+	auto trace_events = nlohmann::json::array();
+
+	for (const auto &thread_name: current.thread_names)
+	{
+		trace_events.push_back({
+			{"name", "thread_name"},
+			{"ph", "M"},
+			{"pid", 1},
+			{"tid", thread_name.first},
+			{"args", {
+				{"name", thread_name.second},
+			}},
+		});
+	}
+
+	for (const auto &item: current.recorded)
+	{
+		trace_events.push_back({
+			{"name", item.name},
+			{"cat", item.category},
+			{"ph", "X"},
+			{"pid", 1},
+			{"tid", item.thread_id},
+			{"ts", item.timestamp},
+			{"dur", item.duration},
+		});
+	}
+
+	return {
+		{"traceEvents", trace_events},
+		{"displayTimeUnit", "ms"},
+	};
+}
+
+auto lib::trace::save(const ghc::filesystem::path &path) -> bool
+{
+	std::ofstream file(path.string());
+	if (!file.is_open())
+	{
+		lib::log::error("Failed to save trace to {}", path.string());
+		return false;
+	}
+
+	file << to_json().dump();
+	lib::log::info("Trace saved to {}", path.string());
+	return true;
+}
+
+void lib::trace::clear()
+{
+	auto &current = get_events();
+	std::lock_guard<std::mutex> lock(current.mutex);
+	current.recorded.clear();
+}
+
+auto lib::trace::get_events() -> events &
+{
+	// Never destroyed, as spans can end during static destruction
+	static auto *instance = new events();
+	return *instance;
+}
+
+auto lib::trace::thread_id() -> size_t
+{
+	static std::atomic<size_t> next_id(1);
+	thread_local const auto id = next_id++;
+	return id;
+}
+
+lib::trace_span::trace_span(const char *name, const char *category)
+	: name(name),
+	category(category),
+	started(trace::is_enabled() ? trace::now() : -1)
+{
+}
+
+lib::trace_span::~trace_span()
+{
+	if (started >= 0)
+	{
+		trace::complete(name, category, started);
+	}
+}
@@ -0,0 +1,56 @@
+#include "lib/trackindex.hpp"
+#include "lib/fmt.hpp"
+#include "lib/fuzzy.hpp"
+
+#include <numeric>
+
+lib::track_index::track_index(const std::vector<lib::spt::track> &tracks)
+{
+	set_tracks(tracks);
+}
+
+void lib::track_index::set_tracks(const std::vector<lib::spt::track> &tracks)
+{
+	keys.clear();
+	keys.reserve(tracks.size());
+
+	for (const auto &track: tracks)
+	{
+		keys.push_back(key(track));
+	}
+}
+
+auto lib::track_index::size() const -> size_t
+{
+	return keys.size();
+}
+
+auto lib::track_index::filter(const std::string &query) const -> std::vector<size_t>
+{
+	const lib::fuzzy matcher(query);
+	std::vector<size_t> matches;
+
+	if (matcher.is_empty())
+	{
+		matches.resize(keys.size());
+		std::iota(matches.begin(), matches.end(), 0);
+		return matches;
+	}
+
+	const auto results = matcher.filter(keys);
+	matches.reserve(results.size());
+
+	for (const auto &result: results)
+	{
+		matches.push_back(result.first);
+	}
+
+	return matches;
+}
+
+auto lib::track_index::key(const lib::spt::track &track) -> std::string
+{
+	// Newline as separator to avoid matching across fields
+	return lib::strings::normalize(lib::fmt::format("{}\n{}\n{}", track.name,
+		lib::spt::entity::combine_names(track.artists, "\n"), track.album.name));
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "lib/httpclient.hpp"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace fixture
+{
+	/**
+	 * Holds on to requests until responded to, like a slow or lost connection
+	 */
+	class deferred_http_client: public lib::http_client
+	{
+	public:
+		void get(const std::string &url, const lib::headers &headers,
+			lib::callback<std::string> &callback) const override;
+
+		void put(const std::string &url, const std::string &body,
+			const lib::headers &headers, lib::callback<std::string> &callback) const override;
+
+		void post(const std::string &url, const std::string &body,
+			const lib::headers &headers, lib::callback<std::string> &callback) const override;
+
+		auto post(const std::string &url, const lib::headers &headers,
+			const std::string &post_data) const -> std::string override;
+
+		void del(const std::string &url, const std::string &body,
+			const lib::headers &headers, lib::callback<std::string> &callback) const override;
+
+		void send(const std::string &method, const std::string &url,
+			const std::string &body, const lib::headers &headers,
+			lib::callback<lib::http_response> &callback) const override;
+
+		/**
+		 * Number of requests sent so far, responded to or not
+		 */
+		auto size() const -> size_t;
+
+		/**
+		 * Full URL of request
+		 */
+		auto url(size_t index) const -> std::string;
+
+		/**
+		 * Respond to request, responding more than once is allowed
+		 * @param index Index of request, in order sent
+		 */
+		void respond(size_t index, const std::string &response) const;
+
+	private:
+		mutable std::vector<std::string> urls;
+		mutable std::vector<std::function<void(const std::string &)>> callbacks;
+
+		void add(const std::string &url, lib::callback<std::string> &callback) const;
+	};
+}
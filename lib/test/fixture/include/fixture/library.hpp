@@ -0,0 +1,156 @@
+#pragma once
+
+#include "lib/cache/jsoncache.hpp"
+#include "lib/spotify/artist.hpp"
+#include "lib/spotify/playlist.hpp"
+#include "lib/spotify/track.hpp"
+
+#include "thirdparty/json.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace fixture
+{
+	/**
+	 * Size of a generated library
+	 */
+	class scale
+	{
+	public:
+		/**
+		 * Saved ("liked") tracks
+		 */
+		size_t saved_tracks = 1000;
+
+		/**
+		 * Playlists owned or followed
+		 */
+		size_t playlists = 100;
+
+		/**
+		 * Tracks in each playlist, playlist n has n % (playlist_tracks + 1) tracks
+		 */
+		size_t playlist_tracks = 100;
+
+		/**
+		 * Distinct artists tracks are made by
+		 */
+		size_t artists = 500;
+
+		/**
+		 * Use non-ASCII characters in names, like "Mötley Crüe" or "東京事変"
+		 */
+		bool unicode = true;
+	};
+
+	/**
+	 * Generated library, the same for every run, so results can be compared
+	 * @note Nothing is stored, everything is generated from its index when requested
+	 */
+	class library
+	{
+	public:
+		explicit library(const fixture::scale &scale);
+
+		/**
+		 * Spotify ID, 22 base 62 characters
+		 */
+		static auto id(size_t index) -> std::string;
+
+		/**
+		 * Common word, repeating every few calls
+		 * @param unicode Sometimes use non-ASCII words
+		 */
+		static auto word(size_t index, bool unicode = false) -> std::string;
+
+		/**
+		 * Synced lyrics in LRC format
+		 */
+		static auto lrc(size_t line_count) -> std::string;
+
+		auto get_scale() const -> const fixture::scale &;
+
+		/**
+		 * Artist as returned from the API
+		 */
+		auto artist_json(size_t index) const -> nlohmann::json;
+
+		auto artist(size_t index) const -> lib::spt::artist;
+
+		/**
+		 * Track item as returned from the API, in saved tracks or a playlist
+		 */
+		auto track_json(size_t index) const -> nlohmann::json;
+
+		auto track(size_t index) const -> lib::spt::track;
+
+		/**
+		 * Tracks with index from first, up to, but not including, last
+		 */
+		auto tracks(size_t first, size_t last) const -> std::vector<lib::spt::track>;
+
+		/**
+		 * All saved tracks, most recently saved first
+		 */
+		auto saved_tracks() const -> std::vector<lib::spt::track>;
+
+		/**
+		 * Playlist as returned from the API
+		 * @param with_tracks Include all tracks, otherwise only reference to them
+		 */
+		auto playlist_json(size_t index, bool with_tracks) const -> nlohmann::json;
+
+		/**
+		 * Playlist with all tracks
+		 */
+		auto playlist(size_t index) const -> lib::spt::playlist;
+
+		/**
+		 * All playlists, without tracks, as in the playlist list
+		 */
+		auto playlists() const -> std::vector<lib::spt::playlist>;
+
+		/**
+		 * Page of saved tracks, as returned from me/tracks
+		 */
+		auto saved_tracks_page(size_t offset, size_t limit) const -> nlohmann::json;
+
+		/**
+		 * Page of playlists, as returned from me/playlists
+		 */
+		auto playlists_page(size_t offset, size_t limit) const -> nlohmann::json;
+
+		/**
+		 * Page of tracks in playlist, as returned from playlists/{id}/tracks
+		 */
+		auto playlist_tracks_page(size_t index, size_t offset,
+			size_t limit) const -> nlohmann::json;
+
+		/**
+		 * Save all playlists and saved tracks to cache
+		 */
+		void populate(lib::json_cache &cache) const;
+
+	private:
+		fixture::scale scale;
+
+		/**
+		 * Number of tracks in playlist
+		 */
+		auto playlist_track_count(size_t index) const -> size_t;
+
+		/**
+		 * Index of track at position in playlist
+		 */
+		auto playlist_track(size_t index, size_t position) const -> size_t;
+
+		/**
+		 * Paging object around items
+		 * @param url URL of collection, without query
+		 */
+		static auto page(const std::string &url, const nlohmann::json &items,
+			size_t offset, size_t limit, size_t total) -> nlohmann::json;
+	};
+}
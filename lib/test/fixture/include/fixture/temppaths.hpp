@@ -0,0 +1,33 @@
+#pragma once
+
+#include "lib/paths/paths.hpp"
+
+#include <string>
+
+namespace fixture
+{
+	/**
+	 * Config file and cache in the temporary directory,
+	 * removed when constructed and destroyed, so each use starts out empty
+	 */
+	class temp_paths: public lib::paths
+	{
+	public:
+		/**
+		 * @param name Unique name, to not conflict with other tests running at the same time
+		 */
+		explicit temp_paths(const std::string &name);
+
+		~temp_paths();
+
+		auto config_file() const -> ghc::filesystem::path override;
+
+		auto cache() const -> ghc::filesystem::path override;
+
+	private:
+		ghc::filesystem::path config_path;
+		ghc::filesystem::path cache_path;
+
+		void remove() const;
+	};
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "lib/spotify/track.hpp"
+
+#include <string>
+
+namespace fixture
+{
+	/**
+	 * Track with a single artist, where artist and album IDs are derived from their names
+	 * @param added_at ISO date, or empty if not added to anything
+	 */
+	auto make_track(const std::string &id, const std::string &name,
+		const std::string &artist, const std::string &album,
+		const std::string &added_at = std::string()) -> lib::spt::track;
+}
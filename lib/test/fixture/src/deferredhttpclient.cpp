@@ -0,0 +1,65 @@
+#include "fixture/deferredhttpclient.hpp"
+
+void fixture::deferred_http_client::get(const std::string &url,
+	const lib::headers &/*headers*/, lib::callback<std::string> &callback) const
+{
+	add(url, callback);
+}
+
+void fixture::deferred_http_client::put(const std::string &url, const std::string &/*body*/,
+	const lib::headers &/*headers*/, lib::callback<std::string> &callback) const
+{
+	add(url, callback);
+}
+
+void fixture::deferred_http_client::post(const std::string &url, const std::string &/*body*/,
+	const lib::headers &/*headers*/, lib::callback<std::string> &callback) const
+{
+	add(url, callback);
+}
+
+auto fixture::deferred_http_client::post(const std::string &/*url*/,
+	const lib::headers &/*headers*/, const std::string &/*post_data*/) const -> std::string
+{
+	return std::string();
+}
+
+void fixture::deferred_http_client::del(const std::string &url, const std::string &/*body*/,
+	const lib::headers &/*headers*/, lib::callback<std::string> &callback) const
+{
+	add(url, callback);
+}
+
+void fixture::deferred_http_client::send(const std::string &/*method*/, const std::string &url,
+	const std::string &/*body*/, const lib::headers &/*headers*/,
+	lib::callback<lib::http_response> &callback) const
+{
+	add(url, [callback](const std::string &response)
+	{
+		callback(lib::http_response(200, response));
+	});
+}
+
+auto fixture::deferred_http_client::size() const -> size_t
+{
+	return callbacks.size();
+}
+
+auto fixture::deferred_http_client::url(size_t index) const -> std::string
+{
+	return urls.at(index);
+}
+
+void fixture::deferred_http_client::respond(size_t index, const std::string &response) const
+{
+	// Copied, as responding may send new requests
+	const auto callback = callbacks.at(index);
+	callback(response);
+}
+
+void fixture::deferred_http_client::add(const std::string &url,
+	lib::callback<std::string> &callback) const
+{
+	urls.push_back(url);
+	callbacks.emplace_back(callback);
+}
@@ -0,0 +1,341 @@
+#include "fixture/library.hpp"
+
+#include "lib/fmt.hpp"
+#include "lib/spotify/savedtrackssync.hpp"
+
+#include <algorithm>
+
+namespace
+{
+	constexpr const char *api_url = "https://api.spotify.com/v1/";
+	constexpr const char *owner_id = "fixture";
+
+	/**
+	 * Number padded to at least two digits
+	 */
+	auto two_digits(size_t value) -> std::string
+	{
+		return value < 10
+			? lib::fmt::format("0{}", value)
+			: std::to_string(value);
+	}
+}
+
+fixture::library::library(const fixture::scale &scale)
+	: scale(scale)
+{
+	this->scale.artists = std::max<size_t>(this->scale.artists, 1);
+}
+
+auto fixture::library::id(size_t index) -> std::string
+{
+	const std::string charset = "0123456789"
+		"ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+		"abcdefghijklmnopqrstuvwxyz";
+
+	// Linear congruential generator, seeded by index
+	auto state = static_cast<unsigned long long>(index) * 2862933555777941757ULL + 3037000493ULL;
+
+	std::string result;
+	result.reserve(22);
+	for (auto i = 0; i < 22; i++)
+	{
+		state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+		result += charset.at((state >> 33U) % charset.size());
+	}
+	return result;
+}
+
+auto fixture::library::word(size_t index, bool unicode) -> std::string
+{
+	const std::vector<std::string> words{
+		"love", "night", "heart", "dance", "dream", "fire", "summer",
+		"girl", "time", "light", "world", "baby", "home", "money",
+	};
+
+	// Accents, Cyrillic, CJK and emoji
+	const std::vector<std::string> unicode_words{
+		"Mötley", "Crüe", "Beyoncé", "Rós", "Ноч", "東京", "事変",
+		"夜", "사랑", "Ñandú", "🔥", "Ærø", "Straße", "ça",
+	};
+
+	if (unicode && index % 5 == 0)
+	{
+		return unicode_words.at(index / 5 % unicode_words.size());
+	}
+	return words.at(index % words.size());
+}
+
+auto fixture::library::lrc(size_t line_count) -> std::string
+{
+	std::string lyrics = "[00:00.00]Artist: generated\n";
+
+	for (size_t i = 0; i < line_count; i++)
+	{
+		const auto time = i * 2350;
+		lyrics += lib::fmt::format("[{}:{}.{}]{} {} {}\n",
+			two_digits(time / 60000 % 100), two_digits(time / 1000 % 60), two_digits(time / 10 % 100),
+			word(i), word(i * 3), word(i / 2));
+	}
+	return lyrics;
+}
+
+auto fixture::library::get_scale() const -> const fixture::scale &
+{
+	return scale;
+}
+
+auto fixture::library::artist_json(size_t index) const -> nlohmann::json
+{
+	return {
+		{"id", id(index + 1000000)},
+		{"name", lib::fmt::format("{} {} {}",
+			word(index * 3, scale.unicode), word(index / 14, scale.unicode), index)},
+		{"popularity", static_cast<int>(index % 101)},
+		{"genres", {word(index), word(index / 3)}},
+		{"followers", {
+			{"href", nullptr},
+			{"total", static_cast<int>(index * 37 % 1000000)},
+		}},
+		{"external_urls", {
+			{"spotify", lib::fmt::format("https://open.spotify.com/artist/{}",
+				id(index + 1000000))},
+		}},
+		{"images", {
+			{
+				{"url", lib::fmt::format("https://i.scdn.co/image/{}", id(index + 1000000))},
+				{"width", 640},
+				{"height", 640},
+			},
+		}},
+	};
+}
+
+auto fixture::library::artist(size_t index) const -> lib::spt::artist
+{
+	return artist_json(index).get<lib::spt::artist>();
+}
+
+auto fixture::library::track_json(size_t index) const -> nlohmann::json
+{
+	const auto artist_index = index % scale.artists;
+	const auto album_index = index / 10;
+	const auto artist = artist_json(artist_index);
+
+	nlohmann::json images = nlohmann::json::array();
+	for (const auto size: {640, 300, 64})
+	{
+		images.push_back({
+			{"url", lib::fmt::format("https://i.scdn.co/image/{}{}", id(album_index), size)},
+			{"width", size},
+			{"height", size},
+		});
+	}
+
+	// One minute apart, most recent first
+	const auto minutes = index;
+
+	return {
+		{"added_at", lib::fmt::format("{}-{}-{}T{}:{}:00Z",
+			2022 - minutes / 483840, two_digits(12 - minutes / 40320 % 12),
+			two_digits(28 - minutes / 1440 % 28), two_digits(23 - minutes / 60 % 24),
+			two_digits(59 - minutes % 60))},
+		{"is_local", false},
+		{"track", {
+			{"id", id(index)},
+			{"name", lib::fmt::format("{} {} {}",
+				word(index, scale.unicode), word(index / 7, scale.unicode), index)},
+			{"duration_ms", 120000 + static_cast<int>(index % 180) * 1000},
+			{"is_playable", index % 50 != 0},
+			{"artists", {
+				{
+					{"id", artist.at("id")},
+					{"name", artist.at("name")},
+				},
+			}},
+			{"album", {
+				{"id", id(album_index + 2000000)},
+				{"name", lib::fmt::format("{} {}", word(album_index * 5, scale.unicode), album_index)},
+				{"images", images},
+			}},
+		}},
+	};
+}
+
+auto fixture::library::track(size_t index) const -> lib::spt::track
+{
+	return track_json(index).get<lib::spt::track>();
+}
+
+auto fixture::library::tracks(size_t first, size_t last) const -> std::vector<lib::spt::track>
+{
+	std::vector<lib::spt::track> tracks;
+	tracks.reserve(last > first ? last - first : 0);
+
+	for (auto i = first; i < last; i++)
+	{
+		tracks.push_back(track(i));
+	}
+	return tracks;
+}
+
+auto fixture::library::saved_tracks() const -> std::vector<lib::spt::track>
+{
+	return tracks(0, scale.saved_tracks);
+}
+
+auto fixture::library::playlist_json(size_t index, bool with_tracks) const -> nlohmann::json
+{
+	const auto count = playlist_track_count(index);
+	const auto playlist_id = id(index + 3000000);
+
+	nlohmann::json tracks;
+	if (with_tracks)
+	{
+		tracks = nlohmann::json::array();
+		for (size_t i = 0; i < count; i++)
+		{
+			tracks.push_back(track_json(playlist_track(index, i)));
+		}
+	}
+	else
+	{
+		tracks = {
+			{"href", lib::fmt::format("{}playlists/{}/tracks", api_url, playlist_id)},
+			{"total", count},
+		};
+	}
+
+	// Every third playlist is followed, not owned
+	const auto owned = index % 3 != 0;
+
+	return {
+		{"collaborative", index % 17 == 0},
+		{"id", playlist_id},
+		{"name", lib::fmt::format("{} {} {}",
+			word(index * 2, scale.unicode), word(index / 5, scale.unicode), index)},
+		{"description", index % 4 == 0
+			? std::string()
+			: lib::fmt::format("generated playlist with {} tracks", count)},
+		{"public", index % 2 == 0},
+		{"snapshot_id", id(index + 4000000)},
+		{"images", {
+			{
+				{"url", lib::fmt::format("https://i.scdn.co/image/{}", playlist_id)},
+			},
+		}},
+		{"owner", {
+			{"id", owned ? owner_id : lib::fmt::format("user{}", index)},
+			{"display_name", owned ? "Fixture" : lib::fmt::format("User {}", index)},
+		}},
+		{"tracks", tracks},
+	};
+}
+
+auto fixture::library::playlist(size_t index) const -> lib::spt::playlist
+{
+	return playlist_json(index, true).get<lib::spt::playlist>();
+}
+
+auto fixture::library::playlists() const -> std::vector<lib::spt::playlist>
+{
+	std::vector<lib::spt::playlist> playlists;
+	playlists.reserve(scale.playlists);
+
+	for (size_t i = 0; i < scale.playlists; i++)
+	{
+		playlists.push_back(playlist_json(i, false).get<lib::spt::playlist>());
+	}
+	return playlists;
+}
+
+auto fixture::library::saved_tracks_page(size_t offset, size_t limit) const -> nlohmann::json
+{
+	const auto end = std::min(offset + limit, scale.saved_tracks);
+
+	nlohmann::json items = nlohmann::json::array();
+	for (auto i = offset; i < end; i++)
+	{
+		items.push_back(track_json(i));
+	}
+
+	return page(lib::fmt::format("{}me/tracks", api_url),
+		items, offset, limit, scale.saved_tracks);
+}
+
+auto fixture::library::playlists_page(size_t offset, size_t limit) const -> nlohmann::json
+{
+	const auto end = std::min(offset + limit, scale.playlists);
+
+	nlohmann::json items = nlohmann::json::array();
+	for (auto i = offset; i < end; i++)
+	{
+		items.push_back(playlist_json(i, false));
+	}
+
+	return page(lib::fmt::format("{}me/playlists", api_url),
+		items, offset, limit, scale.playlists);
+}
+
+auto fixture::library::playlist_tracks_page(size_t index, size_t offset,
+	size_t limit) const -> nlohmann::json
+{
+	const auto count = playlist_track_count(index);
+	const auto end = std::min(offset + limit, count);
+
+	nlohmann::json items = nlohmann::json::array();
+	for (auto i = offset; i < end; i++)
+	{
+		items.push_back(track_json(playlist_track(index, i)));
+	}
+
+	return page(lib::fmt::format("{}playlists/{}/tracks", api_url, id(index + 3000000)),
+		items, offset, limit, count);
+}
+
+void fixture::library::populate(lib::json_cache &cache) const
+{
+	cache.set_playlists(playlists());
+
+	for (size_t i = 0; i < scale.playlists; i++)
+	{
+		cache.set_playlist(playlist(i));
+	}
+
+	cache.set_tracks(lib::spt::saved_tracks_sync::cache_id, saved_tracks());
+}
+
+auto fixture::library::playlist_track_count(size_t index) const -> size_t
+{
+	return index % (scale.playlist_tracks + 1);
+}
+
+auto fixture::library::playlist_track(size_t index, size_t position) const -> size_t
+{
+	// Partly overlapping saved tracks, partly not, but never repeating in the same playlist
+	const auto pool = scale.saved_tracks * 2 + scale.playlist_tracks;
+	return (index * 7919 + position) % pool;
+}
+
+auto fixture::library::page(const std::string &url, const nlohmann::json &items,
+	size_t offset, size_t limit, size_t total) -> nlohmann::json
+{
+	const auto page_url = [&url, limit](size_t page_offset) -> std::string
+	{
+		return lib::fmt::format("{}?offset={}&limit={}", url, page_offset, limit);
+	};
+
+	return {
+		{"href", page_url(offset)},
+		{"items", items},
+		{"limit", limit},
+		{"next", offset + limit < total
+			? nlohmann::json(page_url(offset + limit))
+			: nlohmann::json(nullptr)},
+		{"offset", offset},
+		{"previous", offset > 0
+			? nlohmann::json(page_url(offset > limit ? offset - limit : 0))
+			: nlohmann::json(nullptr)},
+		{"total", total},
+	};
+}
@@ -0,0 +1,34 @@
+#include "fixture/temppaths.hpp"
+
+#include "lib/fmt.hpp"
+
+fixture::temp_paths::temp_paths(const std::string &name)
+	: config_path(ghc::filesystem::temp_directory_path()
+		/ lib::fmt::format("spotify-qt-{}.json", name)),
+	cache_path(ghc::filesystem::temp_directory_path()
+		/ lib::fmt::format("spotify-qt-{}", name))
+{
+	remove();
+}
+
+fixture::temp_paths::~temp_paths()
+{
+	remove();
+}
+
+auto fixture::temp_paths::config_file() const -> ghc::filesystem::path
+{
+	return config_path;
+}
+
+auto fixture::temp_paths::cache() const -> ghc::filesystem::path
+{
+	return cache_path;
+}
+
+void fixture::temp_paths::remove() const
+{
+	std::error_code error;
+	ghc::filesystem::remove(config_path, error);
+	ghc::filesystem::remove_all(cache_path, error);
+}
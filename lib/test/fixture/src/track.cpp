@@ -0,0 +1,16 @@
+#include "fixture/track.hpp"
+
+#include "lib/fmt.hpp"
+
+auto fixture::make_track(const std::string &id, const std::string &name,
+	const std::string &artist, const std::string &album,
+	const std::string &added_at) -> lib::spt::track
+{
+	lib::spt::track track;
+	track.id = id;
+	track.name = name;
+	track.artists.emplace_back(lib::fmt::format("artist_{}", artist), artist);
+	track.album = lib::spt::entity(lib::fmt::format("album_{}", album), album);
+	track.added_at = added_at;
+	return track;
+}
@@ -0,0 +1,74 @@
+#include "lib/asyncqueue.hpp"
+#include "thirdparty/doctest.h"
+
+#include <vector>
+
+TEST_CASE("async_queue")
+{
+	lib::async_queue queue(2);
+
+	// Jobs finish when their done is called
+	std::vector<lib::async_queue::done> running;
+	std::vector<int> started;
+
+	auto add = [&queue, &running, &started](int id)
+	{
+		queue.add([&running, &started, id](const lib::async_queue::done &done)
+		{
+			started.push_back(id);
+			running.push_back(done);
+		});
+	};
+
+	SUBCASE("add")
+	{
+		add(1);
+		add(2);
+		add(3);
+
+		CHECK_EQ(started, std::vector<int>{1, 2});
+		CHECK_EQ(queue.running(), 2);
+		CHECK_EQ(queue.pending(), 1);
+
+		running.front()();
+		CHECK_EQ(started, std::vector<int>{1, 2, 3});
+		CHECK_EQ(queue.running(), 2);
+		CHECK_EQ(queue.pending(), 0);
+
+		// Calling done twice has no effect
+		running.front()();
+		CHECK_EQ(queue.running(), 2);
+
+		running.at(1)();
+		running.at(2)();
+		CHECK_EQ(queue.running(), 0);
+	}
+
+	SUBCASE("synchronous")
+	{
+		// Jobs finishing immediately doesn't block the queue
+		for (auto i = 0; i < 5; i++)
+		{
+			queue.add([&started, i](const lib::async_queue::done &done)
+			{
+				started.push_back(i);
+				done();
+			});
+		}
+
+		CHECK_EQ(started.size(), 5);
+		CHECK_EQ(queue.running(), 0);
+	}
+
+	SUBCASE("clear")
+	{
+		add(1);
+		add(2);
+		add(3);
+		queue.clear();
+
+		CHECK_EQ(queue.pending(), 0);
+		running.front()();
+		CHECK_EQ(started, std::vector<int>{1, 2});
+	}
+}
@@ -0,0 +1,110 @@
+#include "lib/cache/artistindex.hpp"
+#include "fixture/track.hpp"
+#include "thirdparty/doctest.h"
+
+TEST_CASE("artist_index")
+{
+	const std::vector<lib::spt::track> playlist1{
+		fixture::make_track("1", "Hello", "Adele", "25", "2021-01-01T00:00:00Z"),
+		fixture::make_track("2", "Skyfall", "Adele", "Skyfall", "2021-03-01T00:00:00Z"),
+		fixture::make_track("3", "Halo", "Beyoncé", "I Am... Sasha Fierce", "2021-02-01T00:00:00Z"),
+	};
+
+	const std::vector<lib::spt::track> playlist2{
+		fixture::make_track("1", "Hello", "Adele", "25", "2021-02-01T00:00:00Z"),
+	};
+
+	SUBCASE("get")
+	{
+		lib::artist_index index;
+		index.set_tracks("playlist1", playlist1);
+		index.set_tracks("playlist2", playlist2);
+
+		const auto adele = index.get("Adele");
+		CHECK_EQ(adele.id, "artist_Adele");
+		CHECK_EQ(adele.sources, 2);
+		CHECK_EQ(adele.tracks, 3);
+		CHECK_EQ(adele.last_added, "2021-03-01T00:00:00Z");
+
+		CHECK(index.contains("Beyoncé"));
+		CHECK_FALSE(index.contains("Mötley Crüe"));
+		CHECK(index.get("Mötley Crüe").is_null());
+	}
+
+	SUBCASE("set_tracks")
+	{
+		lib::artist_index index;
+		index.set_tracks("playlist1", playlist1);
+		index.set_tracks("playlist2", playlist2);
+
+		// Replaces previous tracks in source
+		index.set_tracks("playlist1", playlist2);
+		CHECK_FALSE(index.contains("Beyoncé"));
+
+		const auto adele = index.get("Adele");
+		CHECK_EQ(adele.sources, 2);
+		CHECK_EQ(adele.tracks, 2);
+		CHECK_EQ(adele.last_added, "2021-02-01T00:00:00Z");
+	}
+
+	SUBCASE("remove")
+	{
+		lib::artist_index index;
+		index.set_tracks("playlist1", playlist1);
+		index.set_tracks("playlist2", playlist2);
+		index.remove("playlist1");
+
+		CHECK_FALSE(index.contains("Beyoncé"));
+		CHECK_EQ(index.get("Adele").tracks, 1);
+	}
+
+	SUBCASE("top")
+	{
+		lib::artist_index index;
+		index.set_tracks("playlist1", playlist1);
+		index.set_tracks("playlist2", playlist2);
+
+		const auto top = index.top(10);
+		REQUIRE_EQ(top.size(), 2);
+		CHECK_EQ(top.front().name, "Adele");
+		CHECK(top.front().score() > top.back().score());
+		CHECK_EQ(index.top(1).size(), 1);
+	}
+
+	SUBCASE("json")
+	{
+		lib::artist_index index;
+		index.set_tracks("playlist1", playlist1);
+		index.set_tracks("playlist2", playlist2);
+
+		const nlohmann::json json = index;
+		const auto loaded = json.get<lib::artist_index>();
+		CHECK_EQ(loaded.source_ids(), index.source_ids());
+		CHECK_EQ(loaded.get("Adele").sources, 2);
+		CHECK_EQ(loaded.get("Adele").tracks, 3);
+		CHECK_EQ(loaded.get("Adele").last_added, "2021-03-01T00:00:00Z");
+
+		// Sources are kept, so they can be replaced later
+		auto updated = loaded;
+		updated.set_tracks("playlist1", playlist2);
+		CHECK_FALSE(updated.contains("Beyoncé"));
+		CHECK_EQ(updated.get("Adele").tracks, 2);
+	}
+
+	SUBCASE("is_empty")
+	{
+		lib::artist_index index;
+		CHECK(index.is_empty());
+
+		index.set_tracks({
+			{"playlist1", playlist1},
+			{"playlist2", playlist2},
+		});
+		CHECK_FALSE(index.is_empty());
+		CHECK_EQ(index.get("Adele").sources, 2);
+
+		index.remove("playlist1");
+		index.remove("playlist2");
+		CHECK(index.is_empty());
+	}
+}
@@ -0,0 +1,138 @@
+#include "lib/cache/jsoncache.hpp"
+#include "fixture/temppaths.hpp"
+#include "thirdparty/doctest.h"
+
+TEST_CASE("json_cache")
+{
+	const fixture::temp_paths paths("json-cache");
+
+	lib::spt::track track;
+	track.id = "track_id";
+	track.name = "Hello";
+	track.artists.emplace_back("artist_id", "Adele");
+	track.added_at = "2021-01-01T00:00:00Z";
+
+	lib::spt::playlist playlist;
+	playlist.id = "playlist_id";
+	playlist.name = "Playlist";
+	playlist.snapshot = "snapshot";
+	playlist.tracks = {track};
+
+	SUBCASE("search")
+	{
+		{
+			lib::json_cache cache(paths);
+			cache.set_playlist(playlist);
+			REQUIRE_EQ(cache.search("hello").tracks.size(), 1);
+		}
+
+		// Saved when closing
+		CHECK(ghc::filesystem::exists(paths.cache() / "index" / "search.json"));
+
+		// Updated after being loaded
+		lib::json_cache cache(paths);
+		CHECK_EQ(cache.search("hello").tracks.size(), 1);
+		track.id = "other_id";
+		track.name = "Halo";
+		cache.set_tracks("liked_tracks", {track});
+		CHECK_EQ(cache.search("halo").tracks.size(), 1);
+	}
+
+	SUBCASE("search after closing unexpectedly")
+	{
+		{
+			lib::json_cache cache(paths);
+			cache.set_playlist(playlist);
+			cache.search("hello");
+		}
+
+		// Cached without updating saved index
+		track.id = "other_id";
+		track.name = "Halo";
+		playlist.tracks = {track};
+		{
+			lib::json_cache cache(paths);
+			cache.set_playlist(playlist);
+		}
+
+		lib::json_cache cache(paths);
+		CHECK_EQ(cache.search("halo").tracks.size(), 1);
+		CHECK(cache.search("hello").tracks.empty());
+	}
+
+	SUBCASE("artists")
+	{
+		{
+			lib::json_cache cache(paths);
+			cache.set_playlist(playlist);
+		}
+
+		// Built from cached playlists
+		{
+			lib::json_cache cache(paths);
+			CHECK_EQ(cache.get_artist_summary("Adele").tracks, 1);
+		}
+
+		// Saved when closing
+		CHECK(ghc::filesystem::exists(paths.cache() / "summary" / "artists.json"));
+
+		// Updated after being loaded
+		lib::json_cache cache(paths);
+		CHECK_EQ(cache.get_artist_summary("Adele").tracks, 1);
+		track.id = "other_id";
+		cache.set_tracks("liked_tracks", {track});
+		CHECK_EQ(cache.get_artist_summary("Adele").tracks, 2);
+	}
+
+	SUBCASE("artists after closing unexpectedly")
+	{
+		{
+			lib::json_cache cache(paths);
+			cache.set_playlist(playlist);
+			cache.get_artist_summary("Adele");
+		}
+
+		// Cached without updating saved artists
+		track.artists = {lib::spt::entity("artist_id", "Beyoncé")};
+		playlist.tracks = {track};
+		{
+			lib::json_cache cache(paths);
+			cache.set_playlist(playlist);
+		}
+
+		lib::json_cache cache(paths);
+		CHECK(cache.get_artist_summary("Adele").is_null());
+		CHECK_EQ(cache.get_artist_summary("Beyoncé").tracks, 1);
+	}
+
+	SUBCASE("summaries")
+	{
+		{
+			lib::json_cache cache(paths);
+			cache.set_playlist(playlist);
+			CHECK_EQ(cache.get_playlist_summary(playlist.id).snapshot, "snapshot");
+		}
+
+		// Saved when closing
+		lib::json_cache cache(paths);
+		CHECK_EQ(cache.get_playlist_summary(playlist.id).track_count, 1);
+	}
+
+	SUBCASE("summaries after closing unexpectedly")
+	{
+		{
+			lib::json_cache cache(paths);
+			cache.set_playlist(playlist);
+		}
+
+		// Cached after summaries were saved, like when closing unexpectedly
+		playlist.snapshot = "new_snapshot";
+		playlist.tracks.push_back(track);
+		lib::json::save(paths.cache() / "playlist" / "playlist_id.json", playlist);
+
+		lib::json_cache cache(paths);
+		const auto summary = cache.get_playlist_summary(playlist.id);
+		CHECK_EQ(summary.snapshot, "new_snapshot");
+		CHECK_EQ(summary.track_count, 2);
+	}
+}
@@ -0,0 +1,111 @@
+#include "lib/cache/searchindex.hpp"
+#include "fixture/track.hpp"
+#include "thirdparty/doctest.h"
+
+TEST_CASE("search_index")
+{
+	const std::vector<lib::spt::track> playlist1{
+		fixture::make_track("1", "Hello", "Adele", "25"),
+		fixture::make_track("2", "Halo", "Beyoncé", "I Am... Sasha Fierce"),
+	};
+
+	const std::vector<lib::spt::track> playlist2{
+		fixture::make_track("1", "Hello", "Adele", "25"),
+		fixture::make_track("3", "Kickstart My Heart", "Mötley Crüe", "Dr. Feelgood"),
+	};
+
+	SUBCASE("is_empty")
+	{
+		lib::search_index index;
+		CHECK(index.is_empty());
+
+		index.set_tracks("playlist1", playlist1);
+		CHECK_FALSE(index.is_empty());
+	}
+
+	SUBCASE("size")
+	{
+		lib::search_index index;
+		index.set_tracks("playlist1", playlist1);
+		index.set_tracks("playlist2", playlist2);
+
+		// Tracks in multiple sources are only counted once
+		CHECK_EQ(index.size(), 3);
+	}
+
+	SUBCASE("search")
+	{
+		lib::search_index index;
+		index.set_tracks("playlist1", playlist1);
+		index.set_tracks("playlist2", playlist2);
+
+		// Name, artist and album
+		const auto hello = index.search("hello", 10);
+		REQUIRE_EQ(hello.tracks.size(), 1);
+		CHECK_EQ(hello.tracks.front().id, "1");
+		CHECK_EQ(index.search("adele", 10).tracks.size(), 1);
+		CHECK_EQ(index.search("feelgood", 10).tracks.size(), 1);
+
+		// Case and diacritics
+		CHECK_EQ(index.search("MOTLEY crue", 10).tracks.size(), 1);
+		CHECK_EQ(index.search("beyonce", 10).tracks.size(), 1);
+
+		// Short words match start of words
+		CHECK_EQ(index.search("h", 10).tracks.size(), 3);
+		CHECK_EQ(index.search("ha", 10).tracks.size(), 1);
+
+		// All words must match
+		CHECK(index.search("hello beyonce", 10).tracks.empty());
+
+		// Albums and artists
+		const auto albums = index.search("sasha", 10).albums;
+		REQUIRE_EQ(albums.size(), 1);
+		CHECK_EQ(albums.front().id, "album_I Am... Sasha Fierce");
+		CHECK_EQ(albums.front().artist, "Beyoncé");
+		CHECK_EQ(index.search("adele", 10).artists.size(), 1);
+
+		// Tracks in more sources are ranked first on equal score
+		const auto ranked = index.search("he", 10).tracks;
+		REQUIRE_EQ(ranked.size(), 2);
+		CHECK_EQ(ranked.front().id, "1");
+
+		// Typos, if nothing else is found
+		const auto typo = index.search("kikstart", 10);
+		REQUIRE_EQ(typo.tracks.size(), 1);
+		CHECK_EQ(typo.tracks.front().id, "3");
+		CHECK_EQ(index.search("bayonce", 10).artists.size(), 1);
+
+		// Limit
+		CHECK_EQ(index.search("h", 2).tracks.size(), 2);
+	}
+
+	SUBCASE("remove")
+	{
+		lib::search_index index;
+		index.set_tracks("playlist1", playlist1);
+		index.set_tracks("playlist2", playlist2);
+		index.remove("playlist1");
+
+		// Still referenced by playlist2
+		CHECK_EQ(index.search("hello", 10).tracks.size(), 1);
+		CHECK(index.search("halo", 10).tracks.empty());
+		CHECK(index.search("beyonce", 10).artists.empty());
+	}
+
+	SUBCASE("json")
+	{
+		lib::search_index index;
+		index.set_tracks("playlist1", playlist1);
+		index.set_tracks("playlist2", playlist2);
+		index.remove("playlist1");
+
+		const nlohmann::json json = index;
+		CHECK_EQ(json.at("tracks").size(), 2);
+
+		auto loaded = json.get<lib::search_index>();
+		CHECK_EQ(loaded.size(), 2);
+		CHECK_EQ(loaded.source_ids(), std::vector<std::string>{"playlist2"});
+		CHECK_EQ(loaded.search("motley", 10).tracks.size(), 1);
+		CHECK(loaded.search("halo", 10).tracks.empty());
+	}
+}
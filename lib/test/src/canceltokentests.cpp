@@ -0,0 +1,93 @@
+#include "lib/canceltoken.hpp"
+#include "thirdparty/doctest.h"
+
+TEST_CASE("cancel_token")
+{
+	SUBCASE("never cancelled by default")
+	{
+		lib::cancel_token token;
+		CHECK_FALSE(token.is_cancelled());
+
+		auto called = false;
+		CHECK_EQ(token.on_cancel([&called]()
+		{
+			called = true;
+		}), 0);
+		CHECK_FALSE(called);
+	}
+
+	SUBCASE("cancelled with scope")
+	{
+		lib::cancel_token token;
+		auto calls = 0;
+		{
+			lib::cancel_scope scope;
+			token = scope.token();
+			token.on_cancel([&calls]()
+			{
+				calls++;
+			});
+
+			const auto removed = token.on_cancel([&calls]()
+			{
+				calls += 10;
+			});
+			token.remove(removed);
+
+			CHECK_FALSE(token.is_cancelled());
+			CHECK_EQ(calls, 0);
+		}
+
+		CHECK(token.is_cancelled());
+		CHECK_EQ(calls, 1);
+
+		// Already cancelled, so called immediately
+		token.on_cancel([&calls]()
+		{
+			calls++;
+		});
+		CHECK_EQ(calls, 2);
+	}
+
+	SUBCASE("cancel once")
+	{
+		lib::cancel_scope scope;
+		const auto token = scope.token();
+
+		size_t id = 0;
+		auto calls = 0;
+		id = token.on_cancel([&token, &id, &calls]()
+		{
+			// Like a request finishing when aborted
+			token.remove(id);
+			calls++;
+		});
+
+		scope.cancel();
+		scope.cancel();
+		CHECK_EQ(calls, 1);
+	}
+
+	SUBCASE("context")
+	{
+		CHECK_FALSE(lib::cancel_token::current().is_cancelled());
+
+		lib::cancel_scope outer;
+		lib::cancel_scope inner;
+		inner.cancel();
+		{
+			lib::cancel_context outer_context(outer.token());
+			CHECK_FALSE(lib::cancel_token::current().is_cancelled());
+			{
+				lib::cancel_context inner_context(inner.token());
+				CHECK(lib::cancel_token::current().is_cancelled());
+			}
+			CHECK_FALSE(lib::cancel_token::current().is_cancelled());
+
+			outer.cancel();
+			CHECK(lib::cancel_token::current().is_cancelled());
+		}
+
+		CHECK_FALSE(lib::cancel_token::current().is_cancelled());
+	}
+}
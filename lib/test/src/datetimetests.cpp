@@ -62,4 +62,11 @@ TEST_CASE("date_time")
 		date_time = lib::date_time(2008, 9, 10, 11, 12, 14);
 		CHECK_EQ(date_time.to_iso_date_time(), "2008-09-10T11:12:14Z");
 	}
+
+	SUBCASE("is_later")
+	{
+		CHECK(lib::date_time::is_later("2021-02-01T00:00:00Z", "2021-01-31T23:59:59Z"));
+		CHECK(lib::date_time::is_later("2021-01-01T00:00:00Z", std::string()));
+		CHECK_FALSE(lib::date_time::is_later("2021-01-01T00:00:00Z", "2021-01-01T00:00:00Z"));
+	}
 }
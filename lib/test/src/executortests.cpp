@@ -0,0 +1,185 @@
+#include "lib/executor.hpp"
+#include "thirdparty/doctest.h"
+
+#include <atomic>
+#include <set>
+#include <stdexcept>
+
+TEST_CASE("executor")
+{
+	SUBCASE("run all tasks")
+	{
+		std::atomic<int> sum(0);
+		{
+			lib::executor executor(4);
+			CHECK_EQ(executor.thread_count(), 4);
+
+			for (auto i = 1; i <= 100; i++)
+			{
+				executor.post([&sum, i]()
+				{
+					sum += i;
+				});
+			}
+		}
+
+		// Destroying finishes all tasks
+		CHECK_EQ(sum, 5050);
+	}
+
+	SUBCASE("at least one thread")
+	{
+		lib::executor executor(0);
+		CHECK_EQ(executor.thread_count(), 1);
+	}
+
+	SUBCASE("multiple threads")
+	{
+		std::mutex mutex;
+		std::set<std::thread::id> ids;
+		std::atomic<int> started(0);
+		{
+			lib::executor executor(2);
+			for (auto i = 0; i < 2; i++)
+			{
+				executor.post([&mutex, &ids, &started]()
+				{
+					{
+						std::lock_guard<std::mutex> lock(mutex);
+						ids.insert(std::this_thread::get_id());
+					}
+
+					// Wait for other task, only possible if run at the same time
+					started++;
+					while (started < 2)
+					{
+						std::this_thread::yield();
+					}
+				});
+			}
+		}
+		CHECK_EQ(ids.size(), 2);
+	}
+
+	SUBCASE("stress")
+	{
+		// Tasks posting more tasks, so workers steal from each other
+		constexpr int outer = 200;
+		constexpr int inner = 50;
+		std::atomic<int> count(0);
+		{
+			lib::executor executor(4);
+			for (auto i = 0; i < outer; i++)
+			{
+				executor.post([&executor, &count]()
+				{
+					for (auto j = 0; j < inner; j++)
+					{
+						executor.post([&count]()
+						{
+							count++;
+						});
+					}
+				});
+			}
+		}
+		CHECK_EQ(count, outer * inner);
+	}
+
+	SUBCASE("try_run_one")
+	{
+		lib::executor executor(1);
+		std::atomic<bool> release(false);
+		executor.post([&release]()
+		{
+			while (!release)
+			{
+				std::this_thread::yield();
+			}
+		});
+
+		// Only worker is busy, so calling thread runs it
+		auto ran = false;
+		executor.post([&ran]()
+		{
+			ran = true;
+		});
+		while (!executor.try_run_one())
+		{
+			std::this_thread::yield();
+		}
+		CHECK(ran);
+		release = true;
+	}
+
+	SUBCASE("dispatch")
+	{
+		// No dispatcher runs immediately
+		auto ran = false;
+		lib::executor::dispatch([&ran]()
+		{
+			ran = true;
+		});
+		CHECK(ran);
+
+		std::vector<lib::executor::task> dispatched;
+		std::mutex mutex;
+		lib::executor::set_dispatcher([&dispatched, &mutex](const lib::executor::task &task)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			dispatched.push_back(task);
+		});
+
+		lib::future<int> future;
+		{
+			lib::executor executor(2);
+			future = executor.async<int>([]() -> int
+			{
+				return 42;
+			});
+		}
+
+		// Resolved when main thread runs dispatched tasks
+		CHECK_FALSE(future.is_ready());
+		REQUIRE_EQ(dispatched.size(), 1);
+		dispatched.front()();
+		REQUIRE(future.is_ready());
+		CHECK_EQ(future.value(), 42);
+
+		lib::executor::set_dispatcher({});
+	}
+
+	SUBCASE("exception")
+	{
+		std::atomic<bool> ran(false);
+		lib::future<int> future;
+		{
+			lib::executor executor(1);
+			executor.post([]()
+			{
+				throw std::runtime_error("task");
+			});
+
+			// Worker keeps running
+			executor.post([&ran]()
+			{
+				ran = true;
+			});
+
+			future = executor.async<int>([]() -> int
+			{
+				throw std::runtime_error("async");
+			});
+		}
+		CHECK(ran);
+
+		// Without dispatcher, failed on the worker
+		REQUIRE(future.is_failed());
+		std::string error;
+		future.fail([&error](const std::string &message)
+		{
+			error = message;
+		});
+		CHECK_EQ(error, "async");
+	}
+}
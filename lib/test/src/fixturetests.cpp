@@ -0,0 +1,187 @@
+#include "fixture/deferredhttpclient.hpp"
+#include "fixture/library.hpp"
+#include "fixture/temppaths.hpp"
+#include "lib/spotify/page.hpp"
+#include "lib/spotify/savedtrackssync.hpp"
+#include "thirdparty/doctest.h"
+
+#include <algorithm>
+#include <set>
+
+TEST_CASE("fixture::library")
+{
+	fixture::scale scale;
+	scale.saved_tracks = 250;
+	scale.playlists = 20;
+	scale.playlist_tracks = 30;
+	scale.artists = 40;
+
+	const fixture::library library(scale);
+
+	SUBCASE("id")
+	{
+		CHECK_EQ(fixture::library::id(1).size(), 22);
+		CHECK_EQ(fixture::library::id(1), fixture::library::id(1));
+		CHECK_NE(fixture::library::id(1), fixture::library::id(2));
+	}
+
+	SUBCASE("track")
+	{
+		const auto track = library.track(42);
+		CHECK(track.is_valid());
+		CHECK_EQ(track.id, fixture::library::id(42));
+		REQUIRE_EQ(track.artists.size(), 1);
+		CHECK_EQ(track.artists.front().name, library.artist(42 % scale.artists).name);
+		CHECK_FALSE(track.images.empty());
+	}
+
+	SUBCASE("saved_tracks")
+	{
+		const auto tracks = library.saved_tracks();
+		REQUIRE_EQ(tracks.size(), scale.saved_tracks);
+
+		// Most recently saved first
+		CHECK(std::is_sorted(tracks.cbegin(), tracks.cend(),
+			[](const lib::spt::track &track1, const lib::spt::track &track2) -> bool
+			{
+				return track1.added_at > track2.added_at;
+			}));
+
+		std::set<std::string> artists;
+		for (const auto &track: tracks)
+		{
+			artists.insert(track.artists.front().id);
+		}
+		CHECK_EQ(artists.size(), scale.artists);
+	}
+
+	SUBCASE("playlist")
+	{
+		const auto playlist = library.playlist(scale.playlist_tracks);
+		CHECK_FALSE(playlist.is_null());
+		REQUIRE_EQ(playlist.tracks.size(), scale.playlist_tracks);
+
+		std::set<std::string> ids;
+		for (const auto &track: playlist.tracks)
+		{
+			ids.insert(track.id);
+		}
+		CHECK_EQ(ids.size(), playlist.tracks.size());
+
+		const auto playlists = library.playlists();
+		REQUIRE_EQ(playlists.size(), scale.playlists);
+		CHECK_EQ(playlists.at(5).tracks_total, 5);
+		CHECK(playlists.at(5).tracks.empty());
+	}
+
+	SUBCASE("unicode")
+	{
+		const auto has_unicode = [](const std::string &str) -> bool
+		{
+			return std::any_of(str.cbegin(), str.cend(), [](char chr) -> bool
+			{
+				return static_cast<unsigned char>(chr) > 0x7f;
+			});
+		};
+
+		const auto tracks = library.saved_tracks();
+		CHECK(std::any_of(tracks.cbegin(), tracks.cend(),
+			[&has_unicode](const lib::spt::track &track) -> bool
+			{
+				return has_unicode(track.name);
+			}));
+
+		auto ascii_scale = scale;
+		ascii_scale.unicode = false;
+		const fixture::library ascii(ascii_scale);
+		const auto ascii_tracks = ascii.saved_tracks();
+		CHECK_FALSE(std::any_of(ascii_tracks.cbegin(), ascii_tracks.cend(),
+			[&has_unicode](const lib::spt::track &track) -> bool
+			{
+				return has_unicode(track.name)
+					|| has_unicode(track.artists.front().name);
+			}));
+	}
+
+	SUBCASE("pages")
+	{
+		std::vector<lib::spt::track> tracks;
+		size_t offset = 0;
+
+		while (true)
+		{
+			const auto page = library.saved_tracks_page(offset, 50)
+				.get<lib::spt::page<lib::spt::track>>();
+
+			CHECK_EQ(page.offset, offset);
+			CHECK_EQ(page.total, scale.saved_tracks);
+			tracks.insert(tracks.end(), page.items.cbegin(), page.items.cend());
+			offset += page.items.size();
+
+			if (!page.has_next)
+			{
+				break;
+			}
+		}
+
+		REQUIRE_EQ(tracks.size(), scale.saved_tracks);
+		CHECK_EQ(tracks.back().id, library.track(scale.saved_tracks - 1).id);
+
+		const auto last = library.playlists_page(15, 10);
+		CHECK_EQ(last.at("items").size(), 5);
+		CHECK(last.at("next").is_null());
+		CHECK(last.at("previous").is_string());
+
+		const auto playlist_tracks = library.playlist_tracks_page(7, 0, 50)
+			.get<lib::spt::page<lib::spt::track>>();
+		CHECK_EQ(playlist_tracks.items.size(), 7);
+		CHECK_EQ(playlist_tracks.items.front().id, library.playlist(7).tracks.front().id);
+	}
+
+	SUBCASE("populate")
+	{
+		const fixture::temp_paths paths("fixture");
+
+		lib::json_cache cache(paths);
+		library.populate(cache);
+
+		CHECK_EQ(cache.get_playlists().size(), scale.playlists);
+		CHECK_EQ(cache.get_playlist(fixture::library::id(3000009)).tracks.size(), 9);
+		CHECK_EQ(cache.get_tracks(lib::spt::saved_tracks_sync::cache_id).size(),
+			scale.saved_tracks);
+	}
+}
+
+TEST_CASE("fixture::deferred_http_client")
+{
+	const fixture::deferred_http_client http;
+	std::vector<std::string> responses;
+	const auto add_response = [&responses](const std::string &response)
+	{
+		responses.push_back(response);
+	};
+
+	http.get("https://example.com/a", {}, add_response);
+	http.put("https://example.com/b", std::string(), {}, add_response);
+
+	SUBCASE("size")
+	{
+		CHECK_EQ(http.size(), 2);
+		CHECK(responses.empty());
+	}
+
+	SUBCASE("url")
+	{
+		CHECK_EQ(http.url(0), "https://example.com/a");
+		CHECK_EQ(http.url(1), "https://example.com/b");
+	}
+
+	SUBCASE("respond")
+	{
+		// In any order, and more than once
+		http.respond(1, "b");
+		http.respond(0, "a");
+		http.respond(0, "a");
+		CHECK_EQ(responses, std::vector<std::string>{"b", "a", "a"});
+	}
+}
@@ -0,0 +1,209 @@
+#include "lib/future.hpp"
+#include "thirdparty/doctest.h"
+
+#include <string>
+
+TEST_CASE("future")
+{
+	SUBCASE("then")
+	{
+		lib::promise<int> promise;
+		auto future = promise.get_future();
+		CHECK_FALSE(future.is_ready());
+		CHECK_THROWS(future.value());
+
+		std::vector<int> values;
+		future.then([&values](const int &value)
+		{
+			values.push_back(value);
+		});
+		CHECK(values.empty());
+
+		promise.resolve(1);
+		promise.resolve(2);
+		CHECK(future.is_ready());
+		CHECK_EQ(future.value(), 1);
+		CHECK_EQ(values, std::vector<int>{1});
+
+		// Already resolved
+		future.then([&values](const int &value)
+		{
+			values.push_back(value * 10);
+		});
+		CHECK_EQ(values, std::vector<int>{1, 10});
+	}
+
+	SUBCASE("map")
+	{
+		lib::promise<int> promise;
+		const auto mapped = promise.get_future().map([](const int &value) -> std::string
+		{
+			return std::to_string(value * 2);
+		});
+
+		promise.resolve(21);
+		REQUIRE(mapped.is_ready());
+		CHECK_EQ(mapped.value(), "42");
+	}
+
+	SUBCASE("and_then")
+	{
+		lib::promise<int> first;
+		lib::promise<std::string> second;
+
+		auto requested = 0;
+		const auto chained = first.get_future().and_then(
+			[&requested, &second](const int &value) -> lib::future<std::string>
+			{
+				requested = value;
+				return second.get_future();
+			});
+
+		first.resolve(1);
+		CHECK_EQ(requested, 1);
+		CHECK_FALSE(chained.is_ready());
+
+		second.resolve("second");
+		REQUIRE(chained.is_ready());
+		CHECK_EQ(chained.value(), "second");
+	}
+
+	SUBCASE("when_all")
+	{
+		lib::promise<int> first;
+		lib::promise<int> second;
+		const auto all = lib::when_all(std::vector<lib::future<int>>{
+			first.get_future(),
+			second.get_future(),
+		});
+
+		// Resolved in any order, but values keep their order
+		second.resolve(2);
+		CHECK_FALSE(all.is_ready());
+		first.resolve(1);
+		REQUIRE(all.is_ready());
+		CHECK_EQ(all.value(), std::vector<int>{1, 2});
+
+		const auto none = lib::when_all(std::vector<lib::future<int>>());
+		CHECK(none.is_ready());
+
+		lib::promise<int> number;
+		lib::promise<std::string> text;
+		const auto both = lib::when_all(number.get_future(), text.get_future());
+		text.resolve("text");
+		number.resolve(3);
+		REQUIRE(both.is_ready());
+		CHECK_EQ(both.value().first, 3);
+		CHECK_EQ(both.value().second, "text");
+	}
+
+	SUBCASE("when_any")
+	{
+		lib::promise<int> first;
+		lib::promise<int> second;
+		const auto any = lib::when_any(std::vector<lib::future<int>>{
+			first.get_future(),
+			second.get_future(),
+		});
+
+		second.resolve(2);
+		first.resolve(1);
+		REQUIRE(any.is_ready());
+		CHECK_EQ(any.value(), 2);
+	}
+
+	SUBCASE("fail")
+	{
+		lib::promise<int> first;
+		lib::promise<int> second;
+		const auto mapped = first.get_future().map([](const int &value) -> int
+		{
+			return value * 2;
+		});
+		const auto all = lib::when_all(std::vector<lib::future<int>>{
+			mapped,
+			second.get_future(),
+		});
+
+		std::string error;
+		all.fail([&error](const std::string &message)
+		{
+			error = message;
+		});
+
+		first.reject("failed");
+		first.resolve(1);
+		CHECK(mapped.is_failed());
+		CHECK_FALSE(mapped.is_ready());
+		CHECK(all.is_failed());
+		CHECK_EQ(error, "failed");
+
+		// Already failed
+		error.clear();
+		all.fail([&error](const std::string &message)
+		{
+			error = message;
+		});
+		CHECK_EQ(error, "failed");
+
+		// Only fails when all fail
+		lib::promise<int> third;
+		const auto any = lib::when_any(std::vector<lib::future<int>>{
+			second.get_future(),
+			third.get_future(),
+		});
+		second.reject("second");
+		CHECK_FALSE(any.is_failed());
+		third.reject("third");
+		CHECK(any.is_failed());
+	}
+
+	SUBCASE("cancel")
+	{
+		lib::cancel_scope scope;
+		lib::promise<int> promise;
+		{
+			lib::cancel_context context(scope.token());
+			promise = lib::promise<int>();
+		}
+
+		auto called = false;
+		promise.get_future().then([&called](const int &/*value*/)
+		{
+			called = true;
+		});
+
+		scope.cancel();
+		promise.resolve(1);
+		CHECK_FALSE(called);
+	}
+
+	SUBCASE("context")
+	{
+		lib::cancel_scope scope;
+		lib::promise<int> promise;
+		{
+			lib::cancel_context context(scope.token());
+			promise = lib::promise<int>();
+		}
+
+		// Continuations run in the context the promise was created in
+		auto is_cancelled = true;
+		promise.get_future().then([&is_cancelled, &scope](const int &/*value*/)
+		{
+			scope.cancel();
+			is_cancelled = lib::cancel_token::current().is_cancelled();
+		});
+
+		promise.resolve(1);
+		CHECK(is_cancelled);
+		CHECK_FALSE(lib::cancel_token::current().is_cancelled());
+	}
+
+	SUBCASE("ready")
+	{
+		const auto future = lib::future<int>::ready(1);
+		REQUIRE(future.is_ready());
+		CHECK_EQ(future.value(), 1);
+	}
+}
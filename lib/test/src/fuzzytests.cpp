@@ -0,0 +1,95 @@
+#include "lib/fuzzy.hpp"
+#include "lib/stopwatch.hpp"
+#include "lib/strings.hpp"
+#include "thirdparty/doctest.h"
+
+TEST_CASE("fuzzy")
+{
+	SUBCASE("distance")
+	{
+		CHECK_EQ(lib::fuzzy::distance("hello", "hello"), 0);
+		CHECK_EQ(lib::fuzzy::distance("hello", "say hello world"), 0);
+
+		// Substitution, insertion and deletion
+		CHECK_EQ(lib::fuzzy::distance("hallo", "say hello world"), 1);
+		CHECK_EQ(lib::fuzzy::distance("helllo", "say hello world"), 1);
+		CHECK_EQ(lib::fuzzy::distance("helo", "say hello world"), 1);
+		CHECK_EQ(lib::fuzzy::distance("hlelo", "say hello world"), 2);
+
+		// Nothing in common
+		CHECK_EQ(lib::fuzzy::distance("abc", "xyz"), 3);
+		CHECK_EQ(lib::fuzzy::distance("abc", std::string()), 3);
+		CHECK_EQ(lib::fuzzy::distance(std::string(), "abc"), 0);
+	}
+
+	SUBCASE("max_distance")
+	{
+		CHECK_EQ(lib::fuzzy::max_distance("abc"), 0);
+		CHECK_EQ(lib::fuzzy::max_distance("abcd"), 1);
+		CHECK_EQ(lib::fuzzy::max_distance("abcdefgh"), 2);
+		CHECK_EQ(lib::fuzzy::max_distance("abcdefg1"), 0);
+	}
+
+	SUBCASE("score")
+	{
+		// Typos and missing diacritics
+		CHECK(lib::fuzzy("beyonse").score(lib::strings::normalize("Halo\nBeyoncé")) > 0);
+		CHECK(lib::fuzzy("Motly Crue").score(lib::strings::normalize("Mötley Crüe")) > 0);
+
+		// All words must match
+		CHECK_EQ(lib::fuzzy("halo adele").score("halo\nbeyonce"), 0);
+
+		// Exact match scores higher
+		CHECK(lib::fuzzy("hello").score("hello") > lib::fuzzy("hello").score("hallo"));
+
+		// Empty query matches everything
+		CHECK(lib::fuzzy(std::string()).is_empty());
+		CHECK(lib::fuzzy(" ").score("hello") > 0);
+	}
+
+	SUBCASE("filter")
+	{
+		std::vector<std::string> texts;
+		for (auto i = 0; i < 20000; i++)
+		{
+			texts.push_back(i % 1000 == 0
+				? "kickstart my heart"
+				: "track " + std::to_string(i));
+		}
+
+		const auto matches = lib::fuzzy("kikstart").filter(texts);
+		REQUIRE_EQ(matches.size(), 20);
+		CHECK_EQ(matches.front().first, 0);
+		CHECK_EQ(matches.back().first, 19000);
+		CHECK(std::is_sorted(matches.cbegin(), matches.cend()));
+	}
+}
+
+TEST_CASE("fuzzy benchmark" * doctest::skip())
+{
+	const std::vector<std::string> words{
+		"love", "night", "heart", "dance", "dream", "fire", "summer",
+		"girl", "time", "light", "world", "baby", "home", "money",
+	};
+
+	// Name, artists and album of 100k tracks
+	std::vector<std::string> texts;
+	texts.reserve(100000);
+	for (size_t i = 0; i < 100000; i++)
+	{
+		texts.push_back(lib::strings::join({
+			words[i % words.size()],
+			words[(i / 7) % words.size()],
+			"artist " + std::to_string(i % 5000),
+			"album " + std::to_string(i % 10000),
+		}, "\n"));
+	}
+
+	lib::stopwatch stopwatch;
+	stopwatch.start();
+	const auto matches = lib::fuzzy("sumer dreem").filter(texts);
+	stopwatch.stop();
+
+	MESSAGE(matches.size(), " matches in ", stopwatch.elapsed<std::chrono::milliseconds, long long>(), " ms");
+	CHECK_FALSE(matches.empty());
+}
@@ -0,0 +1,146 @@
+#include "lib/logbuffer.hpp"
+#include "thirdparty/doctest.h"
+
+#include <thread>
+
+TEST_CASE("log_buffer")
+{
+	auto message = [](int index) -> lib::log_message
+	{
+		return {lib::log_type::information, std::to_string(index)};
+	};
+
+	auto ignore = [](const lib::log_message &/*message*/)
+	{
+	};
+
+	SUBCASE("drain")
+	{
+		lib::log_buffer buffer(8, 8);
+		buffer.push(message(1));
+		buffer.push(message(2));
+		CHECK(buffer.messages().empty());
+
+		std::vector<std::string> drained;
+		buffer.drain([&drained](const lib::log_message &drained_message)
+		{
+			drained.push_back(drained_message.get_message());
+		});
+
+		CHECK_EQ(drained, std::vector<std::string>{"1", "2"});
+		REQUIRE_EQ(buffer.messages().size(), 2);
+		CHECK_EQ(buffer.messages().front().get_message(), "1");
+	}
+
+	SUBCASE("history is bounded")
+	{
+		lib::log_buffer buffer(8, 3);
+		for (auto i = 0; i < 5; i++)
+		{
+			buffer.push(message(i));
+		}
+		buffer.drain(ignore);
+
+		const auto messages = buffer.messages();
+		REQUIRE_EQ(messages.size(), 3);
+		CHECK_EQ(messages.front().get_message(), "2");
+		CHECK_EQ(messages.back().get_message(), "4");
+	}
+
+	SUBCASE("dropped")
+	{
+		lib::log_buffer buffer(2, 8);
+		CHECK(buffer.push(message(1)));
+		CHECK(buffer.push(message(2)));
+		CHECK_FALSE(buffer.push(message(3)));
+		buffer.drain(ignore);
+
+		const auto messages = buffer.messages();
+		REQUIRE_EQ(messages.size(), 3);
+		CHECK_EQ(messages.back().get_log_type(), lib::log_type::warning);
+		CHECK_EQ(messages.back().get_message(), "1 log messages dropped");
+	}
+
+	SUBCASE("messages since")
+	{
+		lib::log_buffer buffer(8, 3);
+		size_t next = 0;
+
+		buffer.push(message(1));
+		buffer.push(message(2));
+		buffer.drain(ignore);
+		CHECK_EQ(buffer.messages_since(next).size(), 2);
+		CHECK_EQ(next, 2);
+		CHECK(buffer.messages_since(next).empty());
+
+		// Only messages still in history
+		for (auto i = 3; i <= 7; i++)
+		{
+			buffer.push(message(i));
+		}
+		buffer.drain(ignore);
+
+		const auto messages = buffer.messages_since(next);
+		REQUIRE_EQ(messages.size(), 3);
+		CHECK_EQ(messages.front().get_message(), "5");
+		CHECK_EQ(next, 7);
+
+		buffer.clear();
+		buffer.push(message(8));
+		buffer.drain(ignore);
+		REQUIRE_EQ(buffer.messages_since(next).size(), 1);
+		CHECK_EQ(next, 8);
+	}
+
+	SUBCASE("clear")
+	{
+		lib::log_buffer buffer(8, 8);
+		buffer.push(message(1));
+		buffer.drain(ignore);
+		buffer.push(message(2));
+		buffer.clear();
+		buffer.drain(ignore);
+		CHECK(buffer.messages().empty());
+	}
+
+	SUBCASE("multiple threads")
+	{
+		constexpr int producers = 4;
+		constexpr int per_producer = 2000;
+		lib::log_buffer buffer(64, producers * per_producer + 1);
+
+		std::vector<std::thread> threads;
+		for (auto producer = 0; producer < producers; producer++)
+		{
+			threads.emplace_back([&buffer, &message]()
+			{
+				for (auto i = 0; i < per_producer; i++)
+				{
+					buffer.push(message(i));
+				}
+			});
+		}
+
+		// Drained while producing, like the background thread does
+		size_t drained = 0;
+		auto count = [&drained](const lib::log_message &/*message*/)
+		{
+			drained++;
+		};
+		for (auto i = 0; i < 100; i++)
+		{
+			buffer.drain(count);
+		}
+
+		for (auto &thread: threads)
+		{
+			thread.join();
+		}
+		buffer.drain(count);
+
+		// Messages are either kept, or counted as dropped
+		const auto messages = buffer.messages();
+		CHECK_EQ(messages.size(), drained);
+		CHECK_LE(messages.size(), producers * per_producer + 1);
+	}
+}
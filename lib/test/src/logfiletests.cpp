@@ -0,0 +1,105 @@
+#include "lib/logfile.hpp"
+#include "thirdparty/doctest.h"
+
+#include <fstream>
+
+namespace
+{
+	auto read_lines(const ghc::filesystem::path &path) -> std::vector<std::string>
+	{
+		std::ifstream stream(path.string());
+		std::vector<std::string> lines;
+		std::string line;
+		while (std::getline(stream, line))
+		{
+			lines.push_back(line);
+		}
+		return lines;
+	}
+}
+
+TEST_CASE("log_file")
+{
+	const auto directory = ghc::filesystem::temp_directory_path() / "spotify-qt-log";
+	const auto path = directory / "spotify-qt.log";
+	ghc::filesystem::remove_all(directory);
+
+	const lib::date_time time(2024, 5, 6, 7, 8, 9);
+
+	SUBCASE("format")
+	{
+		CHECK_EQ(lib::log_file::format(lib::log_message(time,
+			lib::log_type::warning, "hello world")),
+			"2024-05-06T07:08:09\tW\t-\thello world");
+
+		lib::log_message event(lib::log_type::information, "api", "GET\tme\n", {
+			{"endpoint", "/v1/me"},
+			{"duration_ms", "42"},
+		});
+		const auto line = lib::log_file::format(event);
+		CHECK_EQ(line.substr(19), "\tI\tapi\tGET\\tme\\n\tendpoint=/v1/me\tduration_ms=42");
+	}
+
+	SUBCASE("append")
+	{
+		{
+			lib::log_file file(path, 1024, 3);
+			file.write(lib::log_message(time, lib::log_type::information, "first"));
+			file.flush();
+		}
+		{
+			lib::log_file file(path, 1024, 3);
+			file.write(lib::log_message(time, lib::log_type::error, "second"));
+			file.flush();
+		}
+
+		const auto lines = read_lines(path);
+		REQUIRE_EQ(lines.size(), 2);
+		CHECK_EQ(lines.front().substr(20), "I\t-\tfirst");
+		CHECK_EQ(lines.back().substr(20), "E\t-\tsecond");
+	}
+
+	SUBCASE("rotate")
+	{
+		// Each line is 31 bytes, so each file fits 3 lines
+		lib::log_file file(path, 100, 3);
+		for (auto i = 0; i < 10; i++)
+		{
+			file.write(lib::log_message(time, lib::log_type::information,
+				"line " + std::to_string(i)));
+		}
+		file.flush();
+
+		CHECK_EQ(read_lines(path), std::vector<std::string>{
+			"2024-05-06T07:08:09\tI\t-\tline 9",
+		});
+
+		const auto previous = read_lines(directory / "spotify-qt.log.1");
+		REQUIRE_EQ(previous.size(), 3);
+		CHECK_EQ(previous.back().substr(24), "line 8");
+
+		const auto oldest = read_lines(directory / "spotify-qt.log.2");
+		REQUIRE_EQ(oldest.size(), 3);
+		CHECK_EQ(oldest.front().substr(24), "line 3");
+
+		CHECK_FALSE(ghc::filesystem::exists(directory / "spotify-qt.log.3"));
+	}
+
+	SUBCASE("single file")
+	{
+		lib::log_file file(path, 100, 1);
+		for (auto i = 0; i < 5; i++)
+		{
+			file.write(lib::log_message(time, lib::log_type::information,
+				"line " + std::to_string(i)));
+		}
+		file.flush();
+
+		const auto lines = read_lines(path);
+		REQUIRE_EQ(lines.size(), 2);
+		CHECK_EQ(lines.back().substr(24), "line 4");
+		CHECK_FALSE(ghc::filesystem::exists(directory / "spotify-qt.log.1"));
+	}
+
+	ghc::filesystem::remove_all(directory);
+}
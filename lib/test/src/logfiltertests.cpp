@@ -0,0 +1,55 @@
+#include "lib/logfilter.hpp"
+#include "thirdparty/doctest.h"
+
+TEST_CASE("log_filter")
+{
+	const std::vector<lib::log_message> messages{
+		{lib::log_type::information, "Playing track"},
+		{lib::log_type::warning, "Track not found"},
+		{lib::log_type::error, "Request failed"},
+		{lib::log_type::information, "api", "GET", {}},
+	};
+
+	SUBCASE("empty")
+	{
+		const lib::log_filter filter;
+		CHECK(filter.is_empty());
+		CHECK_EQ(filter.apply(messages, 0), std::vector<size_t>{0, 1, 2, 3});
+	}
+
+	SUBCASE("text")
+	{
+		const lib::log_filter filter("TRACK", {});
+		CHECK_FALSE(filter.is_empty());
+		CHECK_EQ(filter.apply(messages, 0), std::vector<size_t>{0, 1});
+	}
+
+	SUBCASE("category")
+	{
+		const lib::log_filter filter("api", {});
+		CHECK_EQ(filter.apply(messages, 0), std::vector<size_t>{3});
+	}
+
+	SUBCASE("types")
+	{
+		const lib::log_filter filter("", {
+			lib::log_type::warning,
+			lib::log_type::error,
+		});
+		CHECK_EQ(filter.apply(messages, 0), std::vector<size_t>{1, 2});
+	}
+
+	SUBCASE("text and type")
+	{
+		const lib::log_filter filter("track", {lib::log_type::warning});
+		CHECK(filter.matches(messages.at(1)));
+		CHECK_FALSE(filter.matches(messages.at(0)));
+	}
+
+	SUBCASE("from")
+	{
+		const lib::log_filter filter("track", {});
+		CHECK_EQ(filter.apply(messages, 1), std::vector<size_t>{1});
+		CHECK(filter.apply(messages, 4).empty());
+	}
+}
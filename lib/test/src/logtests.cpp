@@ -1,6 +1,9 @@
 #include "thirdparty/doctest.h"
 #include "lib/log.hpp"
 #include "lib/developermode.hpp"
+#include "lib/stopwatch.hpp"
+
+#include <fstream>
 
 TEST_CASE("log")
 {
@@ -57,5 +60,153 @@ TEST_CASE("log")
 		lib::log::debug("hello world");
 		lib::log::debug("hello {}", "world");
 		verify_messages();
+		lib::developer_mode::enabled = false;
+	}
+
+	SUBCASE("macros")
+	{
+		init_log();
+
+		auto evaluated = 0;
+		const auto argument = [&evaluated]() -> std::string
+		{
+			evaluated++;
+			return "world";
+		};
+
+		// Arguments aren't evaluated if not logged
+		LIB_LOG_DEBUG("hello {}", argument());
+		CHECK_EQ(evaluated, 0);
+
+		LIB_LOG_INFO("hello {}", argument());
+		LIB_LOG_WARN("hello world");
+		CHECK_EQ(evaluated, 1);
+		verify_messages();
+	}
+
+	SUBCASE("levels")
+	{
+		static_assert(lib::log::is_compiled(lib::log_type::error), "errors are always compiled");
+
+		lib::developer_mode::enabled = false;
+		CHECK(lib::log::is_enabled(lib::log_type::information));
+		CHECK(lib::log::is_enabled(lib::log_type::warning));
+		CHECK(lib::log::is_enabled(lib::log_type::error));
+		CHECK_FALSE(lib::log::is_enabled(lib::log_type::verbose));
+
+		lib::developer_mode::enabled = true;
+		CHECK(lib::log::is_enabled(lib::log_type::verbose));
+		lib::developer_mode::enabled = false;
+	}
+}
+
+TEST_CASE("log events")
+{
+	lib::log::clear();
+	lib::log::set_log_to_stdout(false);
+
+	SUBCASE("disabled by default")
+	{
+		CHECK_FALSE(lib::log::is_category_enabled("api"));
+		lib::log::event(lib::log_type::information, "api", "GET", {});
+		CHECK(lib::log::get_messages().empty());
+	}
+
+	SUBCASE("enabled")
+	{
+		lib::log::set_category_enabled("api", true);
+		lib::log::event(lib::log_type::information, "api", "GET", {
+			{"bytes", "100"},
+		});
+		lib::log::event(lib::log_type::information, "playback", "play", {});
+		lib::log::set_category_enabled("api", false);
+		lib::log::event(lib::log_type::information, "api", "GET", {});
+
+		const auto messages = lib::log::get_messages();
+		REQUIRE_EQ(messages.size(), 1);
+		CHECK_EQ(messages.front().get_category(), "api");
+		REQUIRE_EQ(messages.front().get_fields().size(), 1);
+		CHECK_EQ(messages.front().get_fields().front().second, "100");
 	}
+
+	SUBCASE("lazy fields")
+	{
+		auto evaluated = 0;
+		const auto get_fields = [&evaluated]() -> lib::log_fields
+		{
+			evaluated++;
+			return {{"bytes", "100"}};
+		};
+
+		lib::log::event(lib::log_type::information, "api", "GET", get_fields);
+		CHECK_EQ(evaluated, 0);
+
+		lib::log::set_category_enabled("api", true);
+		lib::log::event(lib::log_type::information, "api", "GET", get_fields);
+		lib::log::set_category_enabled("api", false);
+		CHECK_EQ(evaluated, 1);
+
+		const auto messages = lib::log::get_messages();
+		REQUIRE_EQ(messages.size(), 1);
+		CHECK_EQ(messages.front().get_fields().front().second, "100");
+	}
+
+	SUBCASE("file")
+	{
+		const auto path = ghc::filesystem::temp_directory_path() / "spotify-qt-log-events.log";
+		ghc::filesystem::remove(path);
+
+		lib::log::set_file(std::make_shared<lib::log_file>(path, 1024, 1));
+		lib::log::warn("hello {}", "file");
+		lib::log::flush();
+		lib::log::set_file(nullptr);
+		lib::log::warn("not in file");
+		lib::log::flush();
+
+		std::ifstream stream(path.string());
+		std::string line;
+		REQUIRE(std::getline(stream, line));
+		CHECK_EQ(line.substr(20), "W\t-\thello file");
+		CHECK_FALSE(std::getline(stream, line));
+
+		stream.close();
+		ghc::filesystem::remove(path);
+	}
+}
+
+TEST_CASE("log benchmark" * doctest::skip())
+{
+	lib::log::clear();
+	lib::log::set_log_to_stdout(false);
+	lib::developer_mode::enabled = false;
+
+	const nlohmann::json json{
+		{"name", "track"},
+		{"artists", {"first", "second", "third"}},
+		{"duration_ms", 180000},
+	};
+	constexpr int count = 1000000;
+
+	// Formatted, then ignored, as before checking level first
+	lib::stopwatch eager;
+	eager.start();
+	size_t length = 0;
+	for (auto i = 0; i < count; i++)
+	{
+		length += lib::fmt::format("JSON {}: {}", i, json).size();
+	}
+	eager.stop();
+
+	lib::stopwatch lazy;
+	lazy.start();
+	for (auto i = 0; i < count; i++)
+	{
+		lib::log::debug("JSON {}: {}", i, json);
+	}
+	lazy.stop();
+
+	MESSAGE("eager: ", eager.elapsed<std::chrono::milliseconds, long long>(), " ms");
+	MESSAGE("lazy: ", lazy.elapsed<std::chrono::milliseconds, long long>(), " ms");
+	CHECK_GT(length, 0);
+	CHECK(lib::log::get_messages().empty());
 }
@@ -0,0 +1,50 @@
+#include "lib/lrucache.hpp"
+#include "thirdparty/doctest.h"
+
+#include <string>
+
+TEST_CASE("lru_cache")
+{
+	lib::lru_cache<std::string, int> cache(2);
+
+	SUBCASE("get")
+	{
+		CHECK_EQ(cache.get("a"), nullptr);
+
+		cache.put("a", 1);
+		REQUIRE_NE(cache.get("a"), nullptr);
+		CHECK_EQ(*cache.get("a"), 1);
+	}
+
+	SUBCASE("put")
+	{
+		cache.put("a", 1);
+		cache.put("a", 2);
+		CHECK_EQ(cache.size(), 1);
+		CHECK_EQ(*cache.get("a"), 2);
+
+		// Least recently used is removed
+		cache.put("b", 3);
+		cache.get("a");
+		cache.put("c", 4);
+		CHECK_EQ(cache.size(), 2);
+		CHECK_NE(cache.get("a"), nullptr);
+		CHECK_EQ(cache.get("b"), nullptr);
+		CHECK_NE(cache.get("c"), nullptr);
+	}
+
+	SUBCASE("clear")
+	{
+		cache.put("a", 1);
+		cache.clear();
+		CHECK_EQ(cache.size(), 0);
+		CHECK_EQ(cache.get("a"), nullptr);
+	}
+
+	SUBCASE("no capacity")
+	{
+		lib::lru_cache<std::string, int> empty(0);
+		empty.put("a", 1);
+		CHECK_EQ(empty.size(), 0);
+	}
+}
@@ -0,0 +1,89 @@
+#include "lib/mpscqueue.hpp"
+#include "thirdparty/doctest.h"
+
+#include <thread>
+#include <vector>
+
+TEST_CASE("mpsc_queue")
+{
+	SUBCASE("capacity")
+	{
+		CHECK_EQ(lib::mpsc_queue<int>(0).capacity(), 2);
+		CHECK_EQ(lib::mpsc_queue<int>(4).capacity(), 4);
+		CHECK_EQ(lib::mpsc_queue<int>(5).capacity(), 8);
+	}
+
+	SUBCASE("push and pop")
+	{
+		lib::mpsc_queue<int> queue(4);
+
+		int item = 0;
+		CHECK_FALSE(queue.pop(item));
+
+		for (auto i = 0; i < 4; i++)
+		{
+			CHECK(queue.push(i));
+		}
+		CHECK_FALSE(queue.push(4));
+
+		// Wraps around
+		for (auto round = 0; round < 3; round++)
+		{
+			for (auto i = 0; i < 4; i++)
+			{
+				REQUIRE(queue.pop(item));
+				CHECK_EQ(item, i);
+				CHECK(queue.push(i));
+			}
+		}
+	}
+
+	SUBCASE("multiple producers")
+	{
+		constexpr int producers = 4;
+		constexpr int per_producer = 10000;
+		lib::mpsc_queue<int> queue(256);
+
+		std::vector<std::thread> threads;
+		for (auto producer = 0; producer < producers; producer++)
+		{
+			threads.emplace_back([&queue, producer]()
+			{
+				for (auto i = 0; i < per_producer; i++)
+				{
+					while (!queue.push(producer * per_producer + i))
+					{
+						std::this_thread::yield();
+					}
+				}
+			});
+		}
+
+		// Items from each producer are received in order
+		std::vector<int> last(producers, -1);
+		auto in_order = true;
+		auto received = 0;
+		while (received < producers * per_producer)
+		{
+			int item = 0;
+			if (!queue.pop(item))
+			{
+				std::this_thread::yield();
+				continue;
+			}
+
+			const auto producer = item / per_producer;
+			in_order = in_order && item % per_producer > last[producer];
+			last[producer] = item % per_producer;
+			received++;
+		}
+
+		for (auto &thread: threads)
+		{
+			thread.join();
+		}
+
+		CHECK(in_order);
+		CHECK_EQ(last, std::vector<int>(producers, per_producer - 1));
+	}
+}
@@ -0,0 +1,122 @@
+#include "lib/parallel.hpp"
+#include "lib/random.hpp"
+#include "thirdparty/doctest.h"
+
+#include <atomic>
+#include <numeric>
+
+TEST_CASE("parallel")
+{
+	lib::executor executor(4);
+
+	SUBCASE("for_range")
+	{
+		constexpr size_t size = 10007;
+		std::vector<int> visited(size, 0);
+		std::atomic<size_t> ranges(0);
+		std::atomic<bool> aligned(true);
+
+		lib::parallel::for_range(executor, size, 100,
+			[&visited, &ranges, &aligned](size_t begin, size_t end)
+			{
+				if (begin % 100 != 0)
+				{
+					aligned = false;
+				}
+				for (auto i = begin; i < end; i++)
+				{
+					visited[i]++;
+				}
+				ranges++;
+			});
+
+		CHECK_EQ(ranges, 101);
+		CHECK(aligned);
+		CHECK(std::all_of(visited.cbegin(), visited.cend(), [](int count) -> bool
+		{
+			return count == 1;
+		}));
+
+		// Nothing to do
+		lib::parallel::for_range(executor, 0, 100, [](size_t /*begin*/, size_t /*end*/)
+		{
+			FAIL("Called without items");
+		});
+	}
+
+	SUBCASE("nested")
+	{
+		// Waiting inside a worker helps instead of blocking it
+		std::atomic<int> count(0);
+		lib::parallel::for_range(executor, 64, 1, [&executor, &count](size_t, size_t)
+		{
+			lib::parallel::for_range(executor, 64, 1, [&count](size_t, size_t)
+			{
+				count++;
+			});
+		});
+		CHECK_EQ(count, 64 * 64);
+	}
+
+	SUBCASE("exception")
+	{
+		CHECK_THROWS_AS(lib::parallel::for_range(executor, 10, 1,
+			[](size_t begin, size_t /*end*/)
+			{
+				if (begin == 5)
+				{
+					throw std::runtime_error("failed");
+				}
+			}), std::runtime_error);
+	}
+
+	SUBCASE("sort")
+	{
+		lib::random random;
+		for (const auto size: {0, 1, 999, 1000, 1001, 54321})
+		{
+			std::vector<int> items(static_cast<size_t>(size));
+			for (auto &item: items)
+			{
+				item = random.next_int(0, 1000);
+			}
+
+			auto expected = items;
+			std::sort(expected.begin(), expected.end());
+
+			lib::parallel::sort(executor, items, std::less<int>(), 1000);
+			CHECK_EQ(items, expected);
+		}
+	}
+
+	SUBCASE("map_reduce")
+	{
+		std::vector<int> items(10000);
+		std::iota(items.begin(), items.end(), 1);
+
+		const auto sum = lib::parallel::map_reduce<int, long>(executor, items, 0,
+			[](const int &item) -> long
+			{
+				return item * 2L;
+			},
+			[](const long &first, const long &second) -> long
+			{
+				return first + second;
+			}, 64);
+		CHECK_EQ(sum, 10000L * 10001L);
+
+		// Combined in order
+		const std::vector<std::string> words{"a", "b", "c", "d", "e"};
+		const auto joined = lib::parallel::map_reduce<std::string, std::string>(executor,
+			words, std::string(),
+			[](const std::string &word) -> std::string
+			{
+				return word;
+			},
+			[](const std::string &first, const std::string &second) -> std::string
+			{
+				return first + second;
+			}, 2);
+		CHECK_EQ(joined, "abcde");
+	}
+}
@@ -0,0 +1,244 @@
+#include "fixture/library.hpp"
+#include "fixture/temppaths.hpp"
+#include "lib/recordinghttpclient.hpp"
+#include "lib/replayhttpclient.hpp"
+#include "lib/spotify/api.hpp"
+#include "lib/stopwatch.hpp"
+#include "thirdparty/doctest.h"
+
+#include <future>
+
+namespace
+{
+	auto make_exchange(const std::string &method, const std::string &url,
+		int status, const std::string &response) -> lib::http_exchange
+	{
+		lib::http_exchange exchange;
+		exchange.method = method;
+		exchange.url = url;
+		exchange.status = status;
+		exchange.response = response;
+		return exchange;
+	}
+}
+
+TEST_CASE("replay_http_client")
+{
+	const std::vector<lib::http_exchange> exchanges{
+		make_exchange("GET", "https://example.com/a", 200, "first"),
+		make_exchange("GET", "https://example.com/a", 200, "second"),
+		make_exchange("PUT", "https://example.com/b", 204, std::string()),
+	};
+
+	SUBCASE("replay")
+	{
+		const lib::replay_http_client http(exchanges);
+		std::vector<std::string> responses;
+		const auto add_response = [&responses](const std::string &response)
+		{
+			responses.push_back(response);
+		};
+
+		// In order, then repeating the last one
+		http.get("https://example.com/a", {}, add_response);
+		http.get("https://example.com/a", {}, add_response);
+		http.get("https://example.com/a", {}, add_response);
+		REQUIRE_EQ(responses.size(), 3);
+		CHECK_EQ(responses.at(0), "first");
+		CHECK_EQ(responses.at(1), "second");
+		CHECK_EQ(responses.at(2), "second");
+
+		auto status = -1;
+		http.send("PUT", "https://example.com/b", std::string(), {},
+			[&status](const lib::http_response &response)
+			{
+				status = response.status;
+			});
+		CHECK_EQ(status, 204);
+		CHECK(http.get_unmatched().empty());
+	}
+
+	SUBCASE("unmatched")
+	{
+		const lib::replay_http_client http(exchanges);
+
+		auto status = -1;
+		http.send("GET", "https://example.com/c", std::string(), {},
+			[&status](const lib::http_response &response)
+			{
+				status = response.status;
+			});
+		CHECK_EQ(status, 0);
+
+		// Same URL, but not the same method
+		http.send("PUT", "https://example.com/a", std::string(), {},
+			[](const lib::http_response &/*response*/)
+			{
+			});
+
+		const auto unmatched = http.get_unmatched();
+		REQUIRE_EQ(unmatched.size(), 2);
+		CHECK_EQ(unmatched.front(), "GET https://example.com/c");
+	}
+
+	SUBCASE("latency")
+	{
+		lib::replay_http_client http(exchanges);
+		http.set_latency(std::chrono::milliseconds(20));
+
+		std::promise<long long> responded;
+		lib::stopwatch stopwatch;
+		stopwatch.start();
+
+		http.get("https://example.com/a", {},
+			[&responded, &stopwatch](const std::string &/*response*/)
+			{
+				stopwatch.stop();
+				responded.set_value(stopwatch.elapsed<std::chrono::milliseconds, long long>());
+			});
+
+		// Returned without waiting for response
+		auto elapsed = responded.get_future();
+		CHECK_EQ(elapsed.wait_for(std::chrono::seconds(0)), std::future_status::timeout);
+		REQUIRE_EQ(elapsed.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+		CHECK_GE(elapsed.get(), 20);
+	}
+
+	SUBCASE("recorded latency")
+	{
+		auto slow = exchanges.at(0);
+		slow.duration = 50;
+		auto fast = exchanges.at(2);
+		fast.duration = 10;
+
+		lib::replay_http_client http({slow, fast});
+		http.set_recorded_latency(true);
+
+		std::mutex mutex;
+		std::vector<std::string> responses;
+		std::promise<void> done;
+
+		const auto add_response = [&mutex, &responses, &done](const std::string &response)
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			responses.push_back(response);
+			if (responses.size() == 2)
+			{
+				done.set_value();
+			}
+		};
+
+		http.get("https://example.com/a", {}, add_response);
+		http.send("PUT", "https://example.com/b", std::string(), {},
+			[&add_response](const lib::http_response &response)
+			{
+				add_response(std::to_string(response.status));
+			});
+
+		// Each waits for its own latency, so the faster one responds first
+		REQUIRE_EQ(done.get_future().wait_for(std::chrono::seconds(5)),
+			std::future_status::ready);
+		CHECK_EQ(responses, std::vector<std::string>{"204", "first"});
+	}
+
+	SUBCASE("record")
+	{
+		const lib::replay_http_client replay(exchanges);
+		const lib::recording_http_client http(replay);
+
+		http.get("https://example.com/a", {}, [](const std::string &/*response*/)
+		{
+		});
+		http.send("PUT", "https://example.com/b", std::string(), {},
+			[](const lib::http_response &/*response*/)
+			{
+			});
+
+		const auto path = ghc::filesystem::temp_directory_path() / "spotify-qt-recording.json";
+		http.save(path);
+
+		const auto loaded = lib::http_exchange::load(path);
+		REQUIRE_EQ(loaded.size(), 2);
+		CHECK_EQ(loaded.front().method, "GET");
+		CHECK_EQ(loaded.front().response, "first");
+		CHECK_EQ(loaded.back().status, 204);
+
+		ghc::filesystem::remove(path);
+	}
+
+	SUBCASE("save")
+	{
+		const fixture::temp_paths paths("recording");
+		const auto path = paths.cache() / "recording.json";
+		ghc::filesystem::create_directories(paths.cache());
+
+		// Start of a PNG image, not valid UTF-8
+		const std::string image("\x89PNG\r\n\x1a\n\x00\xff", 10);
+		const std::vector<lib::http_exchange> binary{
+			make_exchange("GET", "https://i.scdn.co/image/a", 200, image),
+			make_exchange("GET", "https://example.com/a", 200, "Mötley Crüe"),
+		};
+
+		REQUIRE(lib::http_exchange::save(path, binary));
+		const auto loaded = lib::http_exchange::load(path);
+		REQUIRE_EQ(loaded.size(), 2);
+		CHECK_EQ(loaded.front().response, image);
+		CHECK_EQ(loaded.back().response, "Mötley Crüe");
+
+		// Directory doesn't exist
+		const auto missing = paths.cache() / "missing" / "recording.json";
+		CHECK_FALSE(lib::http_exchange::save(missing, binary));
+		CHECK_FALSE(ghc::filesystem::exists(missing));
+	}
+
+	SUBCASE("limit")
+	{
+		const lib::replay_http_client replay(exchanges);
+		const lib::recording_http_client http(replay, 2);
+
+		for (auto i = 0; i < 3; i++)
+		{
+			http.get("https://example.com/a", {}, [](const std::string &/*response*/)
+			{
+			});
+		}
+
+		CHECK_EQ(http.get_exchanges().size(), 2);
+	}
+
+	SUBCASE("api")
+	{
+		fixture::scale scale;
+		scale.saved_tracks = 120;
+		const fixture::library library(scale);
+
+		// Saved tracks, as all pages were fetched from the API
+		std::vector<lib::http_exchange> pages;
+		for (size_t offset = 0; offset < scale.saved_tracks; offset += 50)
+		{
+			const auto url = offset == 0
+				? std::string("https://api.spotify.com/v1/me/tracks?limit=50")
+				: lib::fmt::format("https://api.spotify.com/v1/me/tracks?offset={}&limit=50", offset);
+			pages.push_back(make_exchange("GET", url, 200,
+				library.saved_tracks_page(offset, 50).dump()));
+		}
+
+		const fixture::temp_paths paths("replay");
+		lib::settings settings(paths);
+		settings.account.last_refresh = lib::date_time::seconds_since_epoch();
+
+		const lib::replay_http_client http(pages);
+		lib::spt::request request(settings, http);
+		lib::spt::api spotify(settings, http, request);
+
+		std::vector<lib::spt::track> tracks;
+		spotify.saved_tracks([&tracks](const std::vector<lib::spt::track> &result)
+		{
+			tracks = result;
+		});
+
+		CHECK(http.get_unmatched().empty());
+		REQUIRE_EQ(tracks.size(), scale.saved_tracks);
+		CHECK_EQ(tracks.back().id, library.track(scale.saved_tracks - 1).id);
+	}
+}
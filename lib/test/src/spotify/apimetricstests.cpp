@@ -0,0 +1,134 @@
+#include "lib/spotify/apimetrics.hpp"
+#include "thirdparty/doctest.h"
+
+TEST_CASE("spt::api_metrics")
+{
+	SUBCASE("endpoint")
+	{
+		CHECK_EQ(lib::spt::api_metrics::endpoint("GET", "me/player"),
+			"GET me/player");
+
+		CHECK_EQ(lib::spt::api_metrics::endpoint("GET",
+			"https://api.spotify.com/v1/artists/0OdUWJ0sBjDrqHygGUXeCF/top-tracks?market=from_token"),
+			"GET artists/{id}/top-tracks");
+
+		CHECK_EQ(lib::spt::api_metrics::endpoint("PUT",
+			"users/someone/playlists"),
+			"PUT users/{user_id}/playlists");
+
+		CHECK_EQ(lib::spt::api_metrics::endpoint("GET",
+			"browse/categories/toplists/playlists?offset=50"),
+			"GET browse/categories/toplists/playlists");
+	}
+
+	SUBCASE("requests")
+	{
+		lib::spt::api_metrics metrics;
+
+		const auto first = metrics.begin("GET", "me/player", 0);
+		const auto second = metrics.begin("PUT", "me/player/play", 100);
+
+		auto endpoints = metrics.endpoints();
+		REQUIRE_EQ(endpoints.size(), 2);
+		CHECK_EQ(endpoints.at("GET me/player").in_flight, 1);
+		CHECK_EQ(endpoints.at("PUT me/player/play").bytes_sent, 100);
+
+		metrics.end(first, 50);
+		metrics.parsed(first, std::chrono::steady_clock::now());
+		metrics.end(second, 10);
+		metrics.failed(second);
+		metrics.retried("PUT", "me/player/play");
+
+		endpoints = metrics.endpoints();
+		const auto &get = endpoints.at("GET me/player");
+		CHECK_EQ(get.requests, 1);
+		CHECK_EQ(get.in_flight, 0);
+		CHECK_EQ(get.errors, 0);
+		CHECK_EQ(get.bytes_received, 50);
+
+		const auto &put = endpoints.at("PUT me/player/play");
+		CHECK_EQ(put.errors, 1);
+		CHECK_EQ(put.retries, 1);
+	}
+
+	SUBCASE("reset while in flight")
+	{
+		lib::spt::api_metrics metrics;
+
+		const auto measured = metrics.begin("GET", "me", 0);
+		metrics.reset();
+		CHECK(metrics.endpoints().empty());
+
+		metrics.end(measured, 10);
+		const auto endpoints = metrics.endpoints();
+		CHECK_EQ(endpoints.at("GET me").requests, 1);
+		CHECK_EQ(endpoints.at("GET me").in_flight, 0);
+	}
+
+	SUBCASE("cancelled")
+	{
+		lib::spt::api_metrics metrics;
+		lib::cancel_scope scope;
+
+		lib::spt::api_metrics::request measured;
+		{
+			lib::cancel_context context(scope.token());
+			measured = metrics.begin("GET", "me", 0);
+		}
+		const auto finished = metrics.begin("GET", "me", 0);
+		metrics.end(finished, 10);
+
+		// Aborted, so never ends
+		scope.cancel();
+
+		auto endpoints = metrics.endpoints();
+		CHECK_EQ(endpoints.at("GET me").requests, 2);
+		CHECK_EQ(endpoints.at("GET me").in_flight, 0);
+		CHECK_EQ(endpoints.at("GET me").cancelled, 1);
+		CHECK_EQ(endpoints.at("GET me").errors, 0);
+
+		// Response arriving anyway isn't counted twice
+		metrics.end(measured, 10);
+		endpoints = metrics.endpoints();
+		CHECK_EQ(endpoints.at("GET me").requests, 2);
+		CHECK_EQ(endpoints.at("GET me").histogram.at(0), 1);
+	}
+
+	SUBCASE("latency")
+	{
+		lib::spt::endpoint_metrics metrics;
+		CHECK_EQ(metrics.percentile(95).count(), 0);
+
+		for (auto i = 0; i < 18; i++)
+		{
+			metrics.requests++;
+			metrics.add_latency(std::chrono::milliseconds(20));
+		}
+		metrics.requests += 2;
+		metrics.add_latency(std::chrono::milliseconds(700));
+		metrics.add_latency(std::chrono::milliseconds(30000));
+
+		CHECK_EQ(metrics.histogram.front(), 18);
+		CHECK_EQ(metrics.histogram.at(4), 1);
+		CHECK_EQ(metrics.histogram.back(), 1);
+
+		CHECK_EQ(metrics.average_latency().count(), (18 * 20 + 700 + 30000) / 20);
+		CHECK_EQ(metrics.percentile(50).count(), 50);
+		CHECK_EQ(metrics.percentile(95).count(), 1000);
+		CHECK_EQ(metrics.percentile(100).count(), 30000);
+		CHECK_EQ(metrics.max_latency.count(), 30000);
+	}
+
+	SUBCASE("json")
+	{
+		lib::spt::api_metrics metrics;
+		metrics.end(metrics.begin("GET", "me", 0), 10);
+
+		const auto json = metrics.to_json();
+		const auto &endpoint = json.at("endpoints").at("GET me");
+		CHECK_EQ(endpoint.at("requests").get<size_t>(), 1);
+		CHECK_EQ(endpoint.at("bytes_received").get<size_t>(), 10);
+		CHECK_EQ(endpoint.at("histogram_ms").at("50").get<size_t>(), 1);
+		CHECK_EQ(endpoint.at("histogram_ms").at("inf").get<size_t>(), 0);
+	}
+}
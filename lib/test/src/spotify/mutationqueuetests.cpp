@@ -0,0 +1,228 @@
+#include "lib/spotify/mutationqueue.hpp"
+#include "fixture/temppaths.hpp"
+#include "thirdparty/doctest.h"
+
+#include <deque>
+
+namespace
+{
+	/**
+	 * Responds to sent requests with scripted statuses, without any network access
+	 */
+	class scripted_http_client: public lib::http_client
+	{
+	public:
+		mutable std::deque<int> statuses;
+		mutable std::vector<std::string> sent;
+
+		void get(const std::string &/*url*/, const lib::headers &/*headers*/,
+			lib::callback<std::string> &callback) const override
+		{
+			callback(std::string());
+		}
+
+		void put(const std::string &/*url*/, const std::string &/*body*/,
+			const lib::headers &/*headers*/, lib::callback<std::string> &callback) const override
+		{
+			callback(std::string());
+		}
+
+		void post(const std::string &/*url*/, const std::string &/*body*/,
+			const lib::headers &/*headers*/, lib::callback<std::string> &callback) const override
+		{
+			callback(std::string());
+		}
+
+		auto post(const std::string &/*url*/, const lib::headers &/*headers*/,
+			const std::string &/*post_data*/) const -> std::string override
+		{
+			return std::string();
+		}
+
+		void del(const std::string &/*url*/, const std::string &/*body*/,
+			const lib::headers &/*headers*/, lib::callback<std::string> &callback) const override
+		{
+			callback(std::string());
+		}
+
+		void send(const std::string &method, const std::string &url,
+			const std::string &/*body*/, const lib::headers &/*headers*/,
+			lib::callback<lib::http_response> &callback) const override
+		{
+			// Offline, unless a status is scripted
+			auto status = 0;
+			if (!statuses.empty())
+			{
+				status = statuses.front();
+				statuses.pop_front();
+			}
+
+			sent.push_back(lib::fmt::format("{} {}", method, url));
+			callback(lib::http_response(status, std::string()));
+		}
+	};
+}
+
+TEST_CASE("spt::mutation_queue")
+{
+	lib::log::set_log_to_stdout(false);
+
+	const fixture::temp_paths paths("mutations");
+	lib::settings settings(paths);
+	settings.account.last_refresh = lib::date_time::seconds_since_epoch();
+
+	scripted_http_client http;
+	lib::spt::request request(settings, http);
+	lib::spt::api spotify(settings, http, request);
+
+	const auto path = paths.cache() / "mutations.json";
+	ghc::filesystem::remove(path);
+
+	const auto like = lib::spt::mutation::save_tracks({"track_id"}, true);
+	const auto unlike = lib::spt::mutation::save_tracks({"track_id"}, false);
+	const auto follow = lib::spt::mutation::follow_playlist("playlist_id", true);
+	const auto follow_artist = lib::spt::mutation::follow(lib::follow_type::artist,
+		{"artist_id"}, true);
+
+	// Adding to queue can't be undone, or safely sent again
+	lib::spt::mutation queue_track;
+	queue_track.method = "POST";
+	queue_track.url = "me/player/queue?uri=spotify:track:track_id";
+
+	SUBCASE("mutation")
+	{
+		CHECK(unlike.cancels(like));
+		CHECK_FALSE(unlike.duplicates(like));
+		CHECK(like.duplicates(like));
+		CHECK_FALSE(follow.cancels(like));
+
+		// Adding to queue can't be undone
+		CHECK_FALSE(queue_track.cancels(queue_track));
+		CHECK_FALSE(queue_track.duplicates(queue_track));
+		CHECK(like.is_idempotent());
+		CHECK_FALSE(queue_track.is_idempotent());
+
+		nlohmann::json json = like;
+		const auto parsed = json.get<lib::spt::mutation>();
+		CHECK_EQ(parsed.method, like.method);
+		CHECK_EQ(parsed.url, like.url);
+		CHECK_EQ(parsed.body, like.body);
+		CHECK_EQ(parsed.target, like.target);
+		CHECK_EQ(parsed.value, like.value);
+	}
+
+	SUBCASE("collapse")
+	{
+		lib::spt::mutation_queue queue(spotify, path, std::chrono::milliseconds(0));
+
+		queue.add(like);
+		queue.add(follow);
+		queue.add(follow);
+		CHECK_EQ(queue.pending().size(), 2);
+		CHECK(queue.state(like.target, false));
+
+		queue.add(unlike);
+		REQUIRE_EQ(queue.pending().size(), 1);
+		CHECK_EQ(queue.pending().front().target, follow.target);
+		// Nothing pending, so current state is kept
+		CHECK(queue.state(like.target, true));
+		CHECK(queue.state(follow.target, false));
+	}
+
+	SUBCASE("replay in order")
+	{
+		lib::spt::mutation_queue queue(spotify, path, std::chrono::milliseconds(0));
+
+		std::vector<std::string> targets;
+		queue.on_sent([&targets](const lib::spt::mutation &mutation)
+		{
+			targets.push_back(mutation.target);
+		});
+
+		std::vector<std::string> failed;
+		queue.on_failed([&failed](const lib::spt::mutation &mutation, const std::string &message)
+		{
+			failed.push_back(lib::fmt::format("{}: {}", mutation.url, message));
+		});
+
+		queue.add(like);
+		queue.add(follow);
+		queue.add(follow_artist);
+		CHECK_EQ(queue.pending().size(), 3);
+		http.sent.clear();
+
+		http.statuses = {200, 204, 404};
+		queue.flush();
+
+		// Not found can't be fixed by retrying, so it's dropped
+		CHECK(queue.pending().empty());
+		CHECK_EQ(targets, std::vector<std::string>{like.target, follow.target});
+		CHECK_EQ(failed, std::vector<std::string>{
+			"me/following?type=artist&ids=artist_id: Request failed with status 404",
+		});
+		REQUIRE_EQ(http.sent.size(), 3);
+		CHECK_EQ(http.sent.at(0), "PUT https://api.spotify.com/v1/me/tracks");
+		CHECK_EQ(http.sent.at(1), "PUT https://api.spotify.com/v1/playlists/playlist_id/followers");
+		CHECK_EQ(http.sent.at(2),
+			"PUT https://api.spotify.com/v1/me/following?type=artist&ids=artist_id");
+	}
+
+	SUBCASE("retry")
+	{
+		lib::spt::mutation_queue queue(spotify, path, std::chrono::milliseconds(0));
+
+		http.statuses = {0};
+		queue.add(like);
+		CHECK_EQ(queue.pending().size(), 1);
+
+		http.statuses = {429};
+		queue.flush();
+		CHECK_EQ(queue.pending().size(), 1);
+
+		http.statuses = {503, 200};
+		queue.flush();
+		CHECK_EQ(queue.pending().size(), 1);
+		queue.flush();
+		CHECK(queue.pending().empty());
+		CHECK_EQ(http.sent.size(), 4);
+	}
+
+	SUBCASE("backoff")
+	{
+		lib::spt::mutation_queue queue(spotify, path, std::chrono::minutes(1));
+
+		http.statuses = {0, 200};
+		queue.add(like);
+		queue.flush();
+		CHECK_EQ(queue.pending().size(), 1);
+		CHECK_EQ(http.sent.size(), 1);
+	}
+
+	SUBCASE("not idempotent")
+	{
+		lib::spt::mutation_queue queue(spotify, path, std::chrono::milliseconds(0));
+		CHECK_FALSE(queue.add(queue_track));
+		CHECK(queue.pending().empty());
+		CHECK(http.sent.empty());
+	}
+
+	SUBCASE("persist")
+	{
+		{
+			lib::spt::mutation_queue queue(spotify, path, std::chrono::milliseconds(0));
+			CHECK(queue.add(like));
+			CHECK(queue.add(follow));
+		}
+
+		lib::spt::mutation_queue queue(spotify, path, std::chrono::milliseconds(0));
+		REQUIRE_EQ(queue.pending().size(), 2);
+		CHECK_EQ(queue.pending().at(0).target, like.target);
+		CHECK_EQ(queue.pending().at(1).target, follow.target);
+
+		http.statuses = {200, 200};
+		queue.flush();
+		CHECK(queue.pending().empty());
+		CHECK_FALSE(ghc::filesystem::exists(path));
+	}
+
+}
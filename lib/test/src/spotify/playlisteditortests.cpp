@@ -0,0 +1,155 @@
+#include "lib/spotify/playlisteditor.hpp"
+#include "lib/cache/jsoncache.hpp"
+#include "fixture/deferredhttpclient.hpp"
+#include "fixture/temppaths.hpp"
+#include "thirdparty/doctest.h"
+
+TEST_CASE("spt::playlist_editor")
+{
+	lib::spt::playlist playlist;
+	playlist.id = "playlist_id";
+	playlist.snapshot = "snapshot_1";
+
+	for (const auto &id: {"a", "b", "c", "d"})
+	{
+		lib::spt::track track;
+		track.id = id;
+		playlist.tracks.push_back(track);
+	}
+
+	auto ids = [&playlist]() -> std::string
+	{
+		std::string result;
+		for (const auto &track: playlist.tracks)
+		{
+			result += track.id;
+		}
+		return result;
+	};
+
+	SUBCASE("apply_add")
+	{
+		lib::spt::track track;
+		track.id = "e";
+
+		SUBCASE("matching")
+		{
+			CHECK(lib::spt::playlist_editor::apply_add(playlist, "snapshot_1", 4,
+				{"spotify:track:e"}, {track}, "snapshot_2"));
+
+			CHECK_EQ(ids(), "abcde");
+			CHECK_EQ(playlist.tracks_total, 5);
+			CHECK_EQ(playlist.snapshot, "snapshot_2");
+		}
+
+		SUBCASE("changed while fetching")
+		{
+			CHECK_FALSE(lib::spt::playlist_editor::apply_add(playlist, "snapshot_1", 3,
+				{"spotify:track:e"}, {track}, "snapshot_2"));
+
+			CHECK_EQ(ids(), "abcd");
+			CHECK(playlist.snapshot.empty());
+		}
+
+		SUBCASE("changed while sending")
+		{
+			CHECK_FALSE(lib::spt::playlist_editor::apply_add(playlist, "snapshot_0", 4,
+				{"spotify:track:e"}, {track}, "snapshot_2"));
+
+			CHECK_EQ(ids(), "abcd");
+			CHECK(playlist.snapshot.empty());
+		}
+
+		SUBCASE("different tracks")
+		{
+			CHECK_FALSE(lib::spt::playlist_editor::apply_add(playlist, "snapshot_1", 4,
+				{"spotify:track:f"}, {track}, "snapshot_2"));
+
+			CHECK_EQ(ids(), "abcd");
+			CHECK(playlist.snapshot.empty());
+		}
+	}
+
+	SUBCASE("apply_remove")
+	{
+		SUBCASE("matching")
+		{
+			CHECK(lib::spt::playlist_editor::apply_remove(playlist, "snapshot_1", {
+				{3, "spotify:track:d"},
+				{1, "spotify:track:b"},
+				{1, "spotify:track:b"},
+			}, "snapshot_2"));
+
+			CHECK_EQ(ids(), "ac");
+			CHECK_EQ(playlist.tracks_total, 2);
+			CHECK_EQ(playlist.snapshot, "snapshot_2");
+		}
+
+		SUBCASE("different track at position")
+		{
+			CHECK_FALSE(lib::spt::playlist_editor::apply_remove(playlist, "snapshot_1", {
+				{0, "spotify:track:b"},
+			}, "snapshot_2"));
+
+			CHECK_EQ(ids(), "abcd");
+			CHECK(playlist.snapshot.empty());
+		}
+
+		SUBCASE("changed while sending")
+		{
+			CHECK_FALSE(lib::spt::playlist_editor::apply_remove(playlist, "snapshot_0", {
+				{0, "spotify:track:a"},
+			}, "snapshot_2"));
+
+			CHECK_EQ(ids(), "abcd");
+			CHECK(playlist.snapshot.empty());
+		}
+
+		SUBCASE("out of range")
+		{
+			CHECK_FALSE(lib::spt::playlist_editor::apply_remove(playlist, "snapshot_1", {
+				{4, "spotify:track:e"},
+			}, "snapshot_2"));
+
+			CHECK_EQ(ids(), "abcd");
+		}
+	}
+
+	SUBCASE("add")
+	{
+		const fixture::temp_paths paths("editor");
+
+		lib::settings settings(paths);
+		settings.account.last_refresh = lib::date_time::seconds_since_epoch();
+
+		const fixture::deferred_http_client http;
+		lib::spt::request request(settings, http);
+		lib::spt::api spotify(settings, http, request);
+
+		lib::json_cache cache(paths);
+		lib::spt::playlist_editor editor(spotify, cache);
+
+		// Snapshot, or error message if failed
+		std::vector<std::pair<bool, std::string>> results;
+		const auto on_added = [&results](const lib::result<std::string> &result)
+		{
+			results.emplace_back(result.success(),
+				result.success() ? result.value() : result.message());
+		};
+
+		editor.add(playlist.id, {"spotify:track:e"}, on_added);
+		editor.add(playlist.id, {"spotify:track:e"}, on_added);
+		REQUIRE_EQ(http.size(), 2);
+
+		// No response, like when offline
+		http.respond(0, std::string());
+		REQUIRE_EQ(results.size(), 1);
+		CHECK_FALSE(results.back().first);
+
+		http.respond(1, R"({"snapshot_id": "snapshot_2"})");
+		REQUIRE_EQ(results.size(), 2);
+		CHECK(results.back().first);
+		CHECK_EQ(results.back().second, "snapshot_2");
+
+	}
+}
@@ -0,0 +1,113 @@
+#include "lib/spotify/playlistmove.hpp"
+#include "thirdparty/doctest.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+TEST_CASE("spt::playlist_move")
+{
+	// Apply all moves to tracks in current order, and get the new order
+	auto reorder = [](const std::vector<size_t> &order) -> std::vector<size_t>
+	{
+		std::vector<size_t> tracks(order.size());
+		std::iota(tracks.begin(), tracks.end(), 0);
+
+		for (const auto &move: lib::spt::playlist_move::from_order(order))
+		{
+			move.apply(tracks);
+		}
+		return tracks;
+	};
+
+	SUBCASE("apply")
+	{
+		std::vector<int> items{0, 1, 2, 3, 4};
+
+		// Move forward, insert_before is before the move
+		lib::spt::playlist_move(0, 3, 2).apply(items);
+		CHECK_EQ(items, std::vector<int>{2, 0, 1, 3, 4});
+
+		lib::spt::playlist_move(3, 0, 2).apply(items);
+		CHECK_EQ(items, std::vector<int>{3, 4, 2, 0, 1});
+	}
+
+	SUBCASE("is_valid_order")
+	{
+		CHECK(lib::spt::playlist_move::is_valid_order({}));
+		CHECK(lib::spt::playlist_move::is_valid_order({2, 0, 1}));
+		CHECK_FALSE(lib::spt::playlist_move::is_valid_order({0, 0, 1}));
+		CHECK_FALSE(lib::spt::playlist_move::is_valid_order({0, 3, 1}));
+	}
+
+	SUBCASE("to_order")
+	{
+		CHECK(lib::spt::playlist_move::to_order({}).empty());
+		CHECK_EQ(lib::spt::playlist_move::to_order({2, 0, 1}), std::vector<size_t>{2, 0, 1});
+		CHECK_EQ(lib::spt::playlist_move::to_order({4, 0, 2}), std::vector<size_t>{2, 0, 1});
+		CHECK_EQ(lib::spt::playlist_move::to_order({1, 5}), std::vector<size_t>{0, 1});
+	}
+
+	SUBCASE("from_order")
+	{
+		SUBCASE("already in order")
+		{
+			CHECK(lib::spt::playlist_move::from_order({0, 1, 2, 3}).empty());
+		}
+
+		SUBCASE("single track")
+		{
+			const auto moves = lib::spt::playlist_move::from_order({3, 0, 1, 2});
+			REQUIRE_EQ(moves.size(), 1);
+			CHECK_EQ(moves.front().range_start, 3);
+			CHECK_EQ(moves.front().insert_before, 0);
+			CHECK_EQ(moves.front().range_length, 1);
+		}
+
+		SUBCASE("range of tracks")
+		{
+			// Swapping two halves is a single move
+			CHECK_EQ(lib::spt::playlist_move::from_order({3, 4, 5, 0, 1, 2}).size(), 1);
+			CHECK_EQ(reorder({3, 4, 5, 0, 1, 2}), std::vector<size_t>{3, 4, 5, 0, 1, 2});
+		}
+
+		SUBCASE("reversed")
+		{
+			const std::vector<size_t> order{4, 3, 2, 1, 0};
+			CHECK_EQ(lib::spt::playlist_move::from_order(order).size(), 4);
+			CHECK_EQ(reorder(order), order);
+		}
+
+		SUBCASE("invalid")
+		{
+			CHECK(lib::spt::playlist_move::from_order({0, 0, 1}).empty());
+		}
+
+		SUBCASE("random")
+		{
+			std::mt19937 random(1);
+
+			for (const auto size: {2, 10, 100, 2000})
+			{
+				std::vector<size_t> order(size);
+				std::iota(order.begin(), order.end(), 0);
+				std::shuffle(order.begin(), order.end(), random);
+
+				CHECK_EQ(reorder(order), order);
+				CHECK_LT(lib::spt::playlist_move::from_order(order).size(), order.size());
+			}
+		}
+
+		SUBCASE("sorting mostly sorted")
+		{
+			// Moving a few tracks only needs a few moves
+			std::vector<size_t> order(2000);
+			std::iota(order.begin(), order.end(), 0);
+			std::rotate(order.begin() + 10, order.begin() + 11, order.begin() + 500);
+			std::swap(order[1000], order[1500]);
+
+			CHECK_EQ(reorder(order), order);
+			CHECK_LE(lib::spt::playlist_move::from_order(order).size(), 3);
+		}
+	}
+}
@@ -0,0 +1,47 @@
+#include "lib/spotify/playlistsummary.hpp"
+#include "thirdparty/doctest.h"
+
+TEST_CASE("spt::playlist_summary")
+{
+	lib::spt::playlist playlist;
+	playlist.id = "playlist_id";
+	playlist.owner_id = "owner_id";
+	playlist.snapshot = "snapshot";
+
+	for (const auto &added_at: {"2021-02-01T12:00:00Z", "2021-03-01T12:00:00Z", ""})
+	{
+		lib::spt::track track;
+		track.added_at = added_at;
+		track.duration = 1000;
+		playlist.tracks.push_back(track);
+	}
+
+	SUBCASE("playlist")
+	{
+		const lib::spt::playlist_summary summary(playlist);
+		CHECK_FALSE(summary.is_null());
+		CHECK_EQ(summary.id, playlist.id);
+		CHECK_EQ(summary.latest_added, "2021-03-01T12:00:00Z");
+		CHECK_EQ(summary.track_count, 3);
+		CHECK_EQ(summary.duration, 3000);
+		CHECK_EQ(summary.owner_id, playlist.owner_id);
+		CHECK_EQ(summary.snapshot, playlist.snapshot);
+
+		CHECK(lib::spt::playlist_summary().is_null());
+		CHECK(lib::spt::playlist_summary(lib::spt::playlist()).latest_added.empty());
+	}
+
+	SUBCASE("json")
+	{
+		const lib::spt::playlist_summary summary1(playlist);
+		const nlohmann::json json = summary1;
+		const auto summary2 = json.get<lib::spt::playlist_summary>();
+
+		CHECK_EQ(summary1.id, summary2.id);
+		CHECK_EQ(summary1.latest_added, summary2.latest_added);
+		CHECK_EQ(summary1.track_count, summary2.track_count);
+		CHECK_EQ(summary1.duration, summary2.duration);
+		CHECK_EQ(summary1.owner_id, summary2.owner_id);
+		CHECK_EQ(summary1.snapshot, summary2.snapshot);
+	}
+}
@@ -0,0 +1,81 @@
+#include "lib/spotify/playlistsync.hpp"
+#include "lib/cache/jsoncache.hpp"
+#include "fixture/deferredhttpclient.hpp"
+#include "fixture/temppaths.hpp"
+#include "thirdparty/doctest.h"
+
+#include <thread>
+
+TEST_CASE("spt::playlist_sync")
+{
+	SUBCASE("is_changed")
+	{
+		lib::spt::playlist playlist;
+		playlist.id = "playlist_id";
+		playlist.snapshot = "snapshot_2";
+
+		// Not cached
+		CHECK(lib::spt::playlist_sync::is_changed(playlist, lib::spt::playlist_summary()));
+
+		lib::spt::playlist_summary cached(playlist);
+		CHECK_FALSE(lib::spt::playlist_sync::is_changed(playlist, cached));
+
+		cached.snapshot = "snapshot_1";
+		CHECK(lib::spt::playlist_sync::is_changed(playlist, cached));
+	}
+
+	SUBCASE("timeout")
+	{
+		const fixture::temp_paths paths("sync");
+
+		lib::settings settings(paths);
+		settings.account.last_refresh = lib::date_time::seconds_since_epoch();
+
+		const fixture::deferred_http_client http;
+		lib::spt::request request(settings, http);
+		lib::spt::api spotify(settings, http, request);
+
+		lib::json_cache cache(paths);
+		lib::spt::playlist_sync sync(spotify, cache, 1, std::chrono::milliseconds(0));
+
+		lib::spt::playlist playlist;
+		playlist.id = "playlist_id";
+		playlist.snapshot = "snapshot_1";
+		playlist.tracks_href = "https://api.spotify.com/v1/playlists/playlist_id/tracks";
+
+		const std::string no_tracks = R"({"items": [], "next": null})";
+		std::vector<std::string> synced;
+		const auto on_synced = [&synced](const lib::spt::playlist &updated)
+		{
+			synced.push_back(updated.snapshot);
+		};
+
+		sync.sync({playlist}, on_synced);
+		REQUIRE_EQ(http.size(), 1);
+		CHECK_EQ(sync.remaining(), 1);
+
+		// Never responded to in time
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		sync.check_timeouts();
+		CHECK_EQ(sync.remaining(), 0);
+
+		// Retried with a newer snapshot
+		playlist.snapshot = "snapshot_2";
+		sync.sync({playlist}, on_synced);
+		REQUIRE_EQ(http.size(), 2);
+		CHECK_EQ(sync.remaining(), 1);
+
+		// Late response to the first request doesn't finish the new job
+		http.respond(0, no_tracks);
+		CHECK(synced.empty());
+		CHECK_EQ(sync.remaining(), 1);
+		CHECK(cache.get_playlist(playlist.id).is_null());
+
+		http.respond(1, no_tracks);
+		REQUIRE_EQ(synced.size(), 1);
+		CHECK_EQ(synced.front(), "snapshot_2");
+		CHECK_EQ(sync.remaining(), 0);
+		CHECK_EQ(cache.get_playlist(playlist.id).snapshot, "snapshot_2");
+
+	}
+}
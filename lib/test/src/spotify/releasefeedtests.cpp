@@ -0,0 +1,128 @@
+#include "lib/spotify/releasefeed.hpp"
+#include "lib/cache/jsoncache.hpp"
+#include "fixture/deferredhttpclient.hpp"
+#include "fixture/temppaths.hpp"
+#include "thirdparty/doctest.h"
+
+#include <thread>
+
+TEST_CASE("spt::release_feed")
+{
+	SUBCASE("album_tracks")
+	{
+		lib::spt::album album;
+		album.id = "album_id";
+		album.name = "Album";
+		album.release_date = "2024-01-01";
+
+		lib::spt::track track;
+		track.id = "track_id";
+
+		const auto tracks = lib::spt::release_feed::album_tracks(album, {track});
+		REQUIRE_EQ(tracks.size(), 1);
+		CHECK_EQ(tracks.front().id, "track_id");
+		CHECK_EQ(tracks.front().album.id, "album_id");
+		CHECK_EQ(tracks.front().album.name, "Album");
+		CHECK_EQ(tracks.front().added_at, "2024-01-01");
+	}
+
+	SUBCASE("merge")
+	{
+		auto release = [](const std::string &album_id, const std::string &date,
+			size_t count) -> std::vector<lib::spt::track>
+		{
+			lib::spt::album album;
+			album.id = album_id;
+			album.release_date = date;
+
+			std::vector<lib::spt::track> tracks(count);
+			for (size_t i = 0; i < count; i++)
+			{
+				tracks[i].id = album_id + std::to_string(i);
+			}
+			return lib::spt::release_feed::album_tracks(album, tracks);
+		};
+
+		const auto merged = lib::spt::release_feed::merge({
+			release("a", "2024-01-01", 2),
+			{},
+			release("b", "2024-01-03", 1),
+			release("c", "2024-01-01", 1),
+		});
+
+		// Newest first, same date and tracks in original order
+		REQUIRE_EQ(merged.size(), 4);
+		CHECK_EQ(merged.at(0).id, "b0");
+		CHECK_EQ(merged.at(1).id, "a0");
+		CHECK_EQ(merged.at(2).id, "a1");
+		CHECK_EQ(merged.at(3).id, "c0");
+	}
+
+	SUBCASE("load")
+	{
+		const fixture::temp_paths paths("feed");
+
+		lib::settings settings(paths);
+		settings.account.last_refresh = lib::date_time::seconds_since_epoch();
+
+		const fixture::deferred_http_client http;
+		lib::spt::request request(settings, http);
+		lib::spt::api spotify(settings, http, request);
+
+		lib::spt::track track;
+		track.id = "track_id";
+		track.artists.emplace_back("artist_id", "Adele");
+		lib::json_cache cache(paths);
+		cache.set_tracks("saved_tracks", {track});
+
+		lib::spt::release_feed feed(spotify, cache, 2, std::chrono::milliseconds(0));
+
+		std::vector<size_t> loaded;
+		const auto on_loaded = [&loaded](const std::vector<lib::spt::track> &tracks)
+		{
+			loaded.push_back(tracks.size());
+		};
+
+		auto releases = nlohmann::json::array();
+		for (const auto *album_id: {"album1", "album2", "album3"})
+		{
+			releases.push_back({
+				{"id", album_id},
+				{"name", album_id},
+				{"release_date", "2024-01-01"},
+				{"artists", {{{"name", "Adele"}}}},
+			});
+		}
+
+		feed.load(on_loaded);
+		REQUIRE_EQ(http.size(), 1);
+		http.respond(0, nlohmann::json{
+			{"albums", {{"items", releases}, {"next", nullptr}}},
+		}.dump());
+
+		// Only two fetched at the same time
+		REQUIRE_EQ(http.size(), 3);
+		CHECK(loaded.empty());
+
+		// Never responded to in time, so skipped, and loaded together
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+		feed.check_timeouts();
+		REQUIRE_EQ(http.size(), 4);
+		REQUIRE_EQ(loaded.size(), 1);
+		CHECK_EQ(loaded.back(), 0);
+
+		// Late response is ignored
+		const std::string album_tracks = R"({"items": [{"id": "track_id"}], "next": null})";
+		http.respond(1, album_tracks);
+		CHECK_EQ(loaded.size(), 1);
+
+		http.respond(3, album_tracks);
+		REQUIRE_EQ(loaded.size(), 2);
+		CHECK_EQ(loaded.back(), 1);
+
+		// Incomplete, so loaded again
+		feed.load(on_loaded);
+		CHECK_EQ(http.size(), 5);
+
+	}
+}
@@ -0,0 +1,78 @@
+#include "lib/spotify/savedtrackssync.hpp"
+#include "thirdparty/doctest.h"
+
+TEST_CASE("spt::saved_tracks_sync")
+{
+	using merge_result = lib::spt::saved_tracks_sync::merge_result;
+
+	auto make_tracks = [](int first, int last) -> std::vector<lib::spt::track>
+	{
+		// Most recently saved first
+		std::vector<lib::spt::track> tracks;
+		for (auto i = last; i >= first; i--)
+		{
+			lib::spt::track track;
+			track.id = std::to_string(i);
+			track.added_at = lib::fmt::format("2021-01-01T00:00:{:02}Z", i);
+			tracks.push_back(track);
+		}
+		return tracks;
+	};
+
+	const auto cached = make_tracks(0, 9);
+
+	SUBCASE("merge")
+	{
+		std::vector<lib::spt::track> merged;
+
+		// Nothing new
+		CHECK_EQ(lib::spt::saved_tracks_sync::merge(cached,
+			make_tracks(5, 9), 10, merged), merge_result::merged);
+		CHECK_EQ(merged.size(), 10);
+
+		// New tracks
+		CHECK_EQ(lib::spt::saved_tracks_sync::merge(cached,
+			make_tracks(8, 12), 13, merged), merge_result::merged);
+		REQUIRE_EQ(merged.size(), 13);
+		CHECK_EQ(merged.front().id, "12");
+		CHECK_EQ(merged.at(3).id, "9");
+		CHECK_EQ(merged.back().id, "0");
+
+		// Most recent cached tracks removed
+		CHECK_EQ(lib::spt::saved_tracks_sync::merge(cached,
+			make_tracks(0, 7), 8, merged), merge_result::merged);
+		REQUIRE_EQ(merged.size(), 8);
+		CHECK_EQ(merged.front().id, "7");
+
+		// Track saved again
+		auto resaved = make_tracks(8, 9);
+		resaved.front().added_at = "2022-01-01T00:00:00Z";
+		CHECK_EQ(lib::spt::saved_tracks_sync::merge(cached,
+			resaved, 10, merged), merge_result::merged);
+		REQUIRE_EQ(merged.size(), 10);
+		CHECK_EQ(merged.front().added_at, "2022-01-01T00:00:00Z");
+	}
+
+	SUBCASE("incomplete")
+	{
+		std::vector<lib::spt::track> merged;
+
+		// More new tracks than fetched
+		CHECK_EQ(lib::spt::saved_tracks_sync::merge(cached,
+			make_tracks(20, 29), 30, merged), merge_result::incomplete);
+
+		// Everything fetched
+		CHECK_EQ(lib::spt::saved_tracks_sync::merge(cached,
+			make_tracks(20, 29), 10, merged), merge_result::merged);
+		CHECK_EQ(merged.front().id, "29");
+	}
+
+	SUBCASE("diverged")
+	{
+		std::vector<lib::spt::track> merged;
+
+		// Older track removed
+		CHECK_EQ(lib::spt::saved_tracks_sync::merge(cached,
+			make_tracks(8, 10), 10, merged), merge_result::diverged);
+	}
+}
@@ -199,4 +199,17 @@ TEST_CASE("strings")
 		CHECK_EQ(lib::strings::erase_non_alpha("He110 (W047d)"), "HeWd");
 		CHECK_EQ(lib::strings::erase_non_alpha("hello"), "hello");
 	}
+
+	SUBCASE("normalize")
+	{
+		CHECK_EQ(lib::strings::normalize("Hello World"), "hello world");
+		CHECK_EQ(lib::strings::normalize("Åsa Öst"), "asa ost");
+		CHECK_EQ(lib::strings::normalize("Beyoncé"), "beyonce");
+		CHECK_EQ(lib::strings::normalize("Mötley Crüe"), "motley crue");
+		CHECK_EQ(lib::strings::normalize("Straße"), "strasse");
+		CHECK_EQ(lib::strings::normalize("Łódź"), "lodz");
+
+		// Unsupported characters are kept as-is
+		CHECK_EQ(lib::strings::normalize("ÆØ × 日本"), "aeo × 日本");
+	}
 }
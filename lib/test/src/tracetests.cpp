@@ -0,0 +1,110 @@
+#include "lib/trace.hpp"
+#include "thirdparty/doctest.h"
+
+#include <fstream>
+#include <thread>
+
+TEST_CASE("trace")
+{
+	lib::trace::clear();
+
+	auto events = []() -> std::vector<nlohmann::json>
+	{
+		const auto json = lib::trace::to_json();
+		std::vector<nlohmann::json> result;
+		for (const auto &event: json.at("traceEvents"))
+		{
+			if (event.at("ph") == "X")
+			{
+				result.push_back(event);
+			}
+		}
+		return result;
+	};
+
+	SUBCASE("disabled")
+	{
+		{
+			lib::trace_span span("disabled");
+		}
+		lib::trace::complete("disabled", "test", lib::trace::now());
+
+		CHECK(events().empty());
+	}
+
+	SUBCASE("spans")
+	{
+		lib::trace::start();
+		{
+			lib::trace_span outer("outer", "test");
+			{
+				lib::trace_span inner("inner", "test");
+			}
+		}
+		lib::trace::stop();
+
+		// Spans started while enabled, but ended after disabling, are ignored
+		{
+			lib::trace_span span("stopped");
+		}
+
+		const auto recorded = events();
+		REQUIRE_EQ(recorded.size(), 2);
+
+		// Inner ends first
+		const auto &inner = recorded.at(0);
+		const auto &outer = recorded.at(1);
+		CHECK_EQ(inner.at("name"), "inner");
+		CHECK_EQ(outer.at("name"), "outer");
+		CHECK_EQ(outer.at("cat"), "test");
+		CHECK_GE(inner.at("ts").get<long long>(), outer.at("ts").get<long long>());
+		CHECK_LE(inner.at("dur").get<long long>(), outer.at("dur").get<long long>());
+		CHECK_EQ(inner.at("tid"), outer.at("tid"));
+	}
+
+	SUBCASE("threads")
+	{
+		lib::trace::start();
+		lib::trace::complete("main", "test", lib::trace::now());
+
+		std::thread thread([]()
+		{
+			lib::trace::set_thread_name("other");
+			lib::trace_span span("other", "test");
+		});
+		thread.join();
+		lib::trace::stop();
+
+		const auto recorded = events();
+		REQUIRE_EQ(recorded.size(), 2);
+		CHECK_NE(recorded.at(0).at("tid"), recorded.at(1).at("tid"));
+
+		const auto json = lib::trace::to_json();
+		auto named = false;
+		for (const auto &event: json.at("traceEvents"))
+		{
+			named = named || (event.at("ph") == "M"
+				&& event.at("tid") == recorded.at(1).at("tid")
+				&& event.at("args").at("name") == "other");
+		}
+		CHECK(named);
+	}
+
+	SUBCASE("save")
+	{
+		const auto path = ghc::filesystem::temp_directory_path() / "spotify-qt-trace.json";
+
+		lib::trace::start();
+		lib::trace::complete("saved", "test", lib::trace::now());
+		lib::trace::stop();
+
+		REQUIRE(lib::trace::save(path));
+		const auto json = nlohmann::json::parse(std::ifstream(path.string()));
+		CHECK_EQ(json.at("displayTimeUnit"), "ms");
+		CHECK_FALSE(json.at("traceEvents").empty());
+
+		ghc::filesystem::remove(path);
+	}
+
+	lib::trace::clear();
+}
@@ -0,0 +1,60 @@
+#include "lib/trackindex.hpp"
+#include "fixture/track.hpp"
+#include "thirdparty/doctest.h"
+
+TEST_CASE("track_index")
+{
+	const std::vector<lib::spt::track> tracks{
+		fixture::make_track("1", "Hello", "Adele", "25"),
+		fixture::make_track("2", "Halo", "Beyoncé", "I Am... Sasha Fierce"),
+		fixture::make_track("3", "Kickstart My Heart", "Mötley Crüe", "Dr. Feelgood"),
+	};
+
+	SUBCASE("size")
+	{
+		CHECK_EQ(lib::track_index().size(), 0);
+		CHECK_EQ(lib::track_index(tracks).size(), tracks.size());
+	}
+
+	SUBCASE("filter")
+	{
+		const lib::track_index index(tracks);
+
+		// Empty query matches everything
+		CHECK_EQ(index.filter(std::string()).size(), tracks.size());
+
+		// Name, artist and album
+		CHECK_EQ(index.filter("hello"), std::vector<size_t>{0});
+		CHECK_EQ(index.filter("adele"), std::vector<size_t>{0});
+		CHECK_EQ(index.filter("feelgood"), std::vector<size_t>{2});
+
+		// Case and diacritics
+		CHECK_EQ(index.filter("BEYONCE"), std::vector<size_t>{1});
+		CHECK_EQ(index.filter("Crüe"), std::vector<size_t>{2});
+
+		// All words must match
+		CHECK_EQ(index.filter("halo beyonce"), std::vector<size_t>{1});
+		CHECK(index.filter("halo adele").empty());
+
+		// Multiple results in order
+		CHECK_EQ(index.filter("h"), std::vector<size_t>{0, 1, 2});
+	}
+
+	SUBCASE("filter large")
+	{
+		std::vector<lib::spt::track> many;
+		for (auto i = 0; i < 20000; i++)
+		{
+			many.push_back(fixture::make_track(std::to_string(i),
+				"Track " + std::to_string(i), "Artist", "Album"));
+		}
+
+		const lib::track_index index(many);
+		const auto matches = index.filter("track 1999");
+
+		// 1999, 11999, 19990-19999
+		CHECK_EQ(matches.size(), 12);
+		CHECK(std::is_sorted(matches.cbegin(), matches.cend()));
+		CHECK_EQ(matches.front(), 1999);
+	}
+}
@@ -5,6 +5,21 @@
  */
 #define ARG_ENABLE_DEV QStringLiteral("dev")
 
+/**
+ * Comma separated subsystems to log events of, like api
+ */
+#define ARG_LOG_CATEGORIES QStringLiteral("log-categories")
+
+/**
+ * Record where time is spent, and save as Chrome trace events when closing
+ */
+#define ARG_TRACE QStringLiteral("trace")
+
+/**
+ * Record requests and responses, and save them when closing, to replay without network access
+ */
+#define ARG_RECORD_HTTP QStringLiteral("record-http")
+
 /**
  * Force show setup dialog on start
  */
@@ -17,6 +17,21 @@ auto CommandLine::Parser::options() -> QList<QCommandLineOption>
 			ARG_ENABLE_DEV,
 			QStringLiteral("Enable developer mode for troubleshooting issues."),
 		},
+		{
+			ARG_LOG_CATEGORIES,
+			QStringLiteral("Log events of subsystems, like api, to the log file."),
+			QStringLiteral("categories"),
+		},
+		{
+			ARG_TRACE,
+			QStringLiteral("Save trace of where time is spent, for chrome://tracing, when closing."),
+			QStringLiteral("file"),
+		},
+		{
+			ARG_RECORD_HTTP,
+			QStringLiteral("Save the first 10000 requests and responses, except credentials, when closing."),
+			QStringLiteral("file"),
+		},
 		{
 			ARG_FORCE_SETUP,
 			QStringLiteral("Allows providing new Spotify credentials."),
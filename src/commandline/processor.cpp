@@ -1,6 +1,7 @@
 #include "commandline/processor.hpp"
 #include "commandline/args.hpp"
 #include "lib/log.hpp"
+#include "lib/trace.hpp"
 
 #ifdef USE_DBUS
 #include "mediaplayer/client.hpp"
@@ -10,6 +11,12 @@
 
 auto CommandLine::Processor::process(const QCommandLineParser &parser) -> bool
 {
+	if (parser.isSet(ARG_TRACE))
+	{
+		lib::trace::start();
+		lib::trace::set_thread_name("main");
+	}
+
 	if (parser.isSet(ARG_ENABLE_DEV))
 	{
 		lib::developer_mode::enabled = true;
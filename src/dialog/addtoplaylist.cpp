@@ -1,4 +1,5 @@
 #include "dialog/addtoplaylist.hpp"
+#include "mainwindow.hpp"
 #include "widget/statusmessage.hpp"
 
 #include "lib/set.hpp"
@@ -108,13 +109,19 @@ void Dialog::AddToPlaylist::addTracks(const std::vector<std::string> &trackIds)
 		trackUris.push_back(lib::spt::id_to_uri("track", trackId));
 	}
 
-	spotify.add_to_playlist(playlist.id, trackUris,
-		[this](const std::string &result)
+	auto *mainWindow = MainWindow::find(parentWidget());
+	if (mainWindow == nullptr)
+	{
+		return;
+	}
+
+	mainWindow->getPlaylistEditor().add(playlist.id, trackUris,
+		[this](const lib::result<std::string> &result)
 		{
-			if (!result.empty())
+			if (!result.success())
 			{
 				StatusMessage::error(QString("Failed to add track to playlist: %1")
-					.arg(QString::fromStdString(result)));
+					.arg(QString::fromStdString(result.message())));
 				return;
 			}
 
@@ -0,0 +1,127 @@
+#include "dialog/apimetrics.hpp"
+#include "lib/format.hpp"
+
+#include <QDateTime>
+#include <QFileDialog>
+#include <QHBoxLayout>
+#include <QHeaderView>
+#include <QPushButton>
+#include <QStandardPaths>
+#include <QVBoxLayout>
+
+Dialog::ApiMetrics::ApiMetrics(lib::spt::api_metrics &metrics, QWidget *parent)
+	: QDialog(parent),
+	metrics(metrics)
+{
+	setWindowTitle(QStringLiteral("API metrics"));
+	setAttribute(Qt::WA_DeleteOnClose);
+	resize(width, height);
+
+	auto *layout = new QVBoxLayout(this);
+
+	list = new QTreeWidget(this);
+	list->setHeaderLabels({
+		QStringLiteral("Endpoint"),
+		QStringLiteral("Requests"),
+		QStringLiteral("Errors"),
+		QStringLiteral("Retries"),
+		QStringLiteral("In flight"),
+		QStringLiteral("Cancelled"),
+		QStringLiteral("Average"),
+		QStringLiteral("p95"),
+		QStringLiteral("Max"),
+		QStringLiteral("Received"),
+		QStringLiteral("Parsing"),
+	});
+	list->setRootIsDecorated(false);
+	list->setAllColumnsShowFocus(true);
+	list->setSortingEnabled(true);
+	list->sortByColumn(1, Qt::DescendingOrder);
+	list->header()->setSectionResizeMode(0, QHeaderView::Stretch);
+	layout->addWidget(list, 1);
+
+	auto *buttons = new QHBoxLayout();
+	buttons->setAlignment(Qt::AlignRight);
+	layout->addLayout(buttons);
+
+	auto *reset = new QPushButton(QStringLiteral("Reset"), this);
+	buttons->addWidget(reset);
+
+	QPushButton::connect(reset, &QPushButton::clicked,
+		this, &Dialog::ApiMetrics::onReset);
+
+	auto *exportJson = new QPushButton(QStringLiteral("Export..."), this);
+	buttons->addWidget(exportJson);
+
+	QPushButton::connect(exportJson, &QPushButton::clicked,
+		this, &Dialog::ApiMetrics::onExport);
+
+	refreshTimer = new QTimer(this);
+	QTimer::connect(refreshTimer, &QTimer::timeout,
+		this, &Dialog::ApiMetrics::refresh);
+	refreshTimer->start(refreshInterval);
+
+	refresh();
+}
+
+void Dialog::ApiMetrics::refresh()
+{
+	auto milliseconds = [](std::chrono::milliseconds value) -> QString
+	{
+		return QString("%1 ms").arg(value.count());
+	};
+
+	list->setSortingEnabled(false);
+	list->clear();
+
+	for (const auto &entry: metrics.endpoints())
+	{
+		const auto &endpoint = entry.second;
+		auto *item = new QTreeWidgetItem(list);
+
+		item->setText(0, QString::fromStdString(entry.first));
+		item->setToolTip(0, item->text(0));
+		item->setData(1, Qt::DisplayRole, static_cast<qulonglong>(endpoint.requests));
+		item->setData(2, Qt::DisplayRole, static_cast<qulonglong>(endpoint.errors));
+		item->setData(3, Qt::DisplayRole, static_cast<qulonglong>(endpoint.retries));
+		item->setData(4, Qt::DisplayRole, static_cast<qulonglong>(endpoint.in_flight));
+		item->setData(5, Qt::DisplayRole, static_cast<qulonglong>(endpoint.cancelled));
+		item->setText(6, milliseconds(endpoint.average_latency()));
+		item->setText(7, milliseconds(endpoint.percentile(95)));
+		item->setText(8, milliseconds(endpoint.max_latency));
+		item->setText(9, QString::fromStdString(lib::format::size(
+			static_cast<unsigned int>(endpoint.bytes_received))));
+		item->setText(10, milliseconds(std::chrono::duration_cast<std::chrono::milliseconds>(
+			endpoint.total_parse)));
+	}
+
+	list->setSortingEnabled(true);
+}
+
+void Dialog::ApiMetrics::onReset(bool /*checked*/)
+{
+	metrics.reset();
+	refresh();
+}
+
+void Dialog::ApiMetrics::onExport(bool /*checked*/)
+{
+	const auto location = QStandardPaths::DocumentsLocation;
+	const auto path = QStandardPaths::standardLocations(location).first();
+	const auto date = QDateTime::currentDateTime().toString("yyyyMMdd");
+
+	const auto filename = QFileDialog::getSaveFileName(this,
+		QStringLiteral("Select location"),
+		QString("%1/spotify-qt-metrics-%2.json").arg(path, date),
+		QStringLiteral("JSON (*.json)"));
+
+	if (filename.isEmpty())
+	{
+		return;
+	}
+
+	QFile out(filename);
+	out.open(QIODevice::WriteOnly);
+	out.write(QByteArray::fromStdString(metrics.to_json().dump(4)));
+	out.close();
+}
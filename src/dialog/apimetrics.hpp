@@ -0,0 +1,36 @@
+#pragma once
+
+#include "lib/spotify/apimetrics.hpp"
+
+#include <QDialog>
+#include <QTimer>
+#include <QTreeWidget>
+
+namespace Dialog
+{
+	/**
+	 * Latency and throughput of requests, per endpoint
+	 */
+	class ApiMetrics: public QDialog
+	{
+	Q_OBJECT
+
+	public:
+		ApiMetrics(lib::spt::api_metrics &metrics, QWidget *parent);
+
+	private:
+		static constexpr int width = 900;
+		static constexpr int height = 400;
+		static constexpr int refreshInterval = 1000;
+
+		lib::spt::api_metrics &metrics;
+
+		QTreeWidget *list = nullptr;
+		QTimer *refreshTimer = nullptr;
+
+		void refresh();
+
+		void onReset(bool checked);
+		void onExport(bool checked);
+	};
+}
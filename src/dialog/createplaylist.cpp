@@ -74,11 +74,11 @@ void Dialog::CreatePlaylist::onOk(bool /*checked*/)
 			const auto playlistName = QString::fromStdString(playlist.name);
 
 			spotify.add_to_playlist(playlist.id, trackUris,
-				[this, playlistName](const std::string &result)
+				[this, playlistName](const lib::result<std::string> &result)
 				{
-					if (!result.empty())
+					if (!result.success())
 					{
-						showError(QString::fromStdString(result));
+						showError(QString::fromStdString(result.message()));
 						return;
 					}
 
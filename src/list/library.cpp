@@ -5,7 +5,9 @@
 List::Library::Library(lib::spt::api &spotify, lib::cache &cache, QWidget *parent)
 	: QTreeWidget(parent),
 	spotify(spotify),
-	cache(cache)
+	cache(cache),
+	savedTracksSync(spotify, cache),
+	releaseFeed(spotify, cache, maxReleasesRunning)
 {
 	addTopLevelItems({
 		Tree::itemWithNoChildren(this, recentlyPlayed,
@@ -37,6 +39,15 @@ List::Library::Library(lib::spt::api &spotify, lib::cache &cache, QWidget *paren
 	setContextMenuPolicy(Qt::ContextMenuPolicy::CustomContextMenu);
 	QWidget::connect(this, &QWidget::customContextMenuRequested,
 		this, &List::Library::onMenuRequested);
+
+	// Skip new releases that never finish loading
+	auto *releaseTimer = new QTimer(this);
+	releaseTimer->setInterval(releaseTimeoutInterval);
+	QTimer::connect(releaseTimer, &QTimer::timeout, this, [this]()
+	{
+		releaseFeed.check_timeouts();
+	});
+	releaseTimer->start();
 }
 
 void List::Library::onClicked(QTreeWidgetItem *item, int /*column*/)
@@ -110,7 +121,11 @@ void List::Library::onClicked(QTreeWidgetItem *item, int /*column*/)
 		}
 		else if (item->text(0) == savedTracks)
 		{
-			spotify.saved_tracks(callback);
+			// Already saved to cache when synced
+			savedTracksSync.sync([this](const std::vector<lib::spt::track> &tracks)
+			{
+				this->tracksLoaded(std::string(), tracks);
+			});
 		}
 		else if (item->text(0) == topTracks)
 		{
@@ -118,33 +133,15 @@ void List::Library::onClicked(QTreeWidgetItem *item, int /*column*/)
 		}
 		else if (item->text(0) == newReleases)
 		{
-			spotify.new_releases([this, mainWindow, callback]
-				(const std::vector<lib::spt::album> &releases)
+			// Saved to cache when all releases are loaded
+			releaseFeed.load([this](const std::vector<lib::spt::track> &tracks)
 			{
-				auto all = mainWindow->allArtists();
-				std::vector<lib::spt::track> tracks;
-
-				for (const auto &album: releases)
+				// Loaded in batches, so another list may have been opened since
+				const auto *current = currentItem();
+				if (current != nullptr && current->text(0) == newReleases)
 				{
-					if (all.find(album.artist) != all.end())
-					{
-						spotify.album_tracks(album,
-							[album, callback](const std::vector<lib::spt::track> &results)
-							{
-								std::vector<lib::spt::track> tracks;
-								tracks.reserve(results.size());
-								for (const auto &result: results)
-								{
-									lib::spt::track track = result;
-									track.added_at = album.release_date;
-									tracks.push_back(track);
-								}
-								callback(tracks);
-							});
-						return;
-					}
+					this->tracksLoaded(std::string(), tracks);
 				}
-				callback(tracks);
 			});
 		}
 	}
@@ -156,7 +153,10 @@ void List::Library::tracksLoaded(const std::string &id, const std::vector<lib::s
 
 	if (!tracks.empty())
 	{
-		mainWindow->saveTracksToCache(id, tracks);
+		if (!id.empty())
+		{
+			mainWindow->saveTracksToCache(id, tracks);
+		}
 		mainWindow->getSongsTree()->load(tracks);
 		mainWindow->setNoSptContext();
 	}
@@ -201,7 +201,7 @@ void List::Library::onDoubleClicked(QTreeWidgetItem *item, int /*column*/)
 	}
 	else if (item->text(0) == savedTracks)
 	{
-		spotify.saved_tracks(callback);
+		savedTracksSync.sync(callback);
 	}
 	else if (item->text(0) == topTracks)
 	{
@@ -2,12 +2,15 @@
 
 #include "lib/spotify/api.hpp"
 #include "lib/cache.hpp"
+#include "lib/spotify/savedtrackssync.hpp"
+#include "lib/spotify/releasefeed.hpp"
 
 #include "util/tree.hpp"
 #include "listitem/library.hpp"
 
 #include <QTreeWidget>
 #include <QHeaderView>
+#include <QTimer>
 
 namespace List
 {
@@ -21,6 +24,14 @@ namespace List
 	private:
 		lib::spt::api &spotify;
 		lib::cache &cache;
+		lib::spt::saved_tracks_sync savedTracksSync;
+		lib::spt::release_feed releaseFeed;
+
+		/** Max number of new releases to fetch at the same time */
+		static constexpr size_t maxReleasesRunning = 4;
+
+		/** Milliseconds between checking for new releases that took too long to fetch */
+		static constexpr int releaseTimeoutInterval = 10 * 1000;
 
 		static constexpr const char *followedArtists = "Followed Artists";
 		static constexpr const char *newReleases = "New Releases";
@@ -1,16 +1,35 @@
 #include "list/playlist.hpp"
 #include "mainwindow.hpp"
+#include "lib/time.hpp"
+#include "lib/trace.hpp"
 
 List::Playlist::Playlist(lib::spt::api &spotify, lib::settings &settings,
 	lib::cache &cache, QWidget *parent)
 	: QListWidget(parent),
 	spotify(spotify),
 	cache(cache),
-	settings(settings)
+	settings(settings),
+	playlistSync(spotify, cache, maxSyncRunning)
 {
 	// Set default selected playlist
 	setCurrentRow(0);
 
+	// Periodically check for changes made from other clients
+	syncTimer = new QTimer(this);
+	syncTimer->setInterval(syncInterval);
+	QTimer::connect(syncTimer, &QTimer::timeout,
+		this, &List::Playlist::onSyncTimeout);
+	syncTimer->start();
+
+	// Let queued playlists start, even if a fetch never responds
+	auto *timeoutTimer = new QTimer(this);
+	timeoutTimer->setInterval(syncTimeoutInterval);
+	QTimer::connect(timeoutTimer, &QTimer::timeout, this, [this]()
+	{
+		playlistSync.check_timeouts();
+	});
+	timeoutTimer->start();
+
 	QListWidget::connect(this, &QListWidget::itemClicked,
 		this, &List::Playlist::clicked);
 	QListWidget::connect(this, &QListWidget::itemDoubleClicked,
@@ -86,6 +105,8 @@ void List::Playlist::menu(const QPoint &pos)
 
 void List::Playlist::load(const std::vector<lib::spt::playlist> &playlists)
 {
+	lib::trace_span span("List::Playlist::load", "ui");
+
 	QListWidgetItem *activeItem = nullptr;
 	const lib::spt::playlist *activePlaylist = nullptr;
 
@@ -97,12 +118,17 @@ void List::Playlist::load(const std::vector<lib::spt::playlist> &playlists)
 	clear();
 	auto index = 0;
 	QTextDocument doc;
+	const auto summaries = cache.get_playlist_summaries();
+
 	for (const auto &playlist: playlists)
 	{
 		auto *item = new QListWidgetItem(QString::fromStdString(playlist.name), this);
 
 		doc.setHtml(QString::fromStdString(playlist.description));
-		item->setToolTip(doc.toPlainText());
+		const auto summary = summaries.find(playlist.id);
+		item->setToolTip(summary == summaries.end()
+			? doc.toPlainText()
+			: toolTip(doc.toPlainText(), summary->second));
 
 		item->setData(static_cast<int>(DataRole::PlaylistId), QString::fromStdString(playlist.id));
 		item->setData(static_cast<int>(DataRole::DefaultIndex), index);
@@ -151,9 +177,45 @@ void List::Playlist::refresh()
 	{
 		load(items);
 		cache.set_playlists(items);
+		sync(items);
 	});
 }
 
+void List::Playlist::sync(const std::vector<lib::spt::playlist> &playlists)
+{
+	// Leave room for more important requests done after loading
+	QTimer::singleShot(syncDelay, this, [this, playlists]()
+	{
+		playlistSync.sync(playlists, [this](const lib::spt::playlist &playlist)
+		{
+			playlistSynced(playlist);
+		});
+	});
+}
+
+void List::Playlist::onSyncTimeout()
+{
+	// Only sync, as reloading the list would reset what's currently open
+	spotify.playlists([this](const std::vector<lib::spt::playlist> &items)
+	{
+		cache.set_playlists(items);
+		sync(items);
+	});
+}
+
+void List::Playlist::playlistSynced(const lib::spt::playlist &playlist)
+{
+	auto *mainWindow = MainWindow::find(parentWidget());
+	if (mainWindow == nullptr
+		|| lib::spt::id_to_uri("playlist", playlist.id) != mainWindow->getSptContext())
+	{
+		return;
+	}
+
+	// Currently open, so show new tracks
+	mainWindow->getSongsTree()->load(playlist.tracks);
+}
+
 void List::Playlist::order(lib::playlist_order order)
 {
 	QList<QListWidgetItem *> items;
@@ -177,7 +239,6 @@ void List::Playlist::order(lib::playlist_order order)
 	}
 
 	QMap<QString, int> customOrder;
-	MainWindow *mainWindow;
 
 	switch (order)
 	{
@@ -199,30 +260,28 @@ void List::Playlist::order(lib::playlist_order order)
 			break;
 
 		case lib::playlist_order::recent:
+		{
 			// TODO: Currently sorts by when tracks where added, not when playlist was last played
-			mainWindow = MainWindow::find(parentWidget());
-			if (mainWindow == nullptr)
-			{
-				lib::log::error("Failed to order playlist: MainWindow not found");
-				break;
-			}
+			const auto summaries = cache.get_playlist_summaries();
+			const std::string unknown;
 
-			std::sort(items.begin(), items.end(), [this]
-				(QListWidgetItem *item1, QListWidgetItem *item2) -> bool
+			auto latestAdded = [&summaries, &unknown](QListWidgetItem *item) -> const std::string &
 			{
-				auto id1 = item1->data(static_cast<int>(DataRole::PlaylistId))
-					.toString().toStdString();
-				auto id2 = item2->data(static_cast<int>(DataRole::PlaylistId))
-					.toString().toStdString();
+				const auto summary = summaries.find(item->data(static_cast<int>(DataRole::PlaylistId))
+					.toString().toStdString());
 
-				auto track1 = this->cache.get_playlist(id1).tracks;
-				auto track2 = this->cache.get_playlist(id2).tracks;
+				return summary == summaries.end()
+					? unknown
+					: summary->second.latest_added;
+			};
 
-				return !track1.empty() && !track2.empty()
-					&& DateTime::parseIso(track1.at(latestTrack(track1)).added_at)
-						> DateTime::parseIso(track2.at(latestTrack(track2)).added_at);
+			std::stable_sort(items.begin(), items.end(), [&latestAdded]
+				(QListWidgetItem *item1, QListWidgetItem *item2) -> bool
+			{
+				return latestAdded(item1) > latestAdded(item2);
 			});
 			break;
+		}
 
 		case lib::playlist_order::custom:
 			auto index = 0;
@@ -255,39 +314,17 @@ void List::Playlist::order(lib::playlist_order order)
 	}
 }
 
-auto List::Playlist::latestTrack(const std::vector<lib::spt::track> &tracks) -> size_t
+auto List::Playlist::toolTip(const QString &description,
+	const lib::spt::playlist_summary &summary) -> QString
 {
-	size_t latest = 0;
-	for (size_t i = 0; i < tracks.size(); i++)
-	{
-		if (DateTime::parseIso(tracks[i].added_at)
-			> DateTime::parseIso(tracks[latest].added_at))
-		{
-			latest = i;
-		}
-	}
-	return latest;
-}
-
-auto List::Playlist::allArtists() -> std::unordered_set<std::string>
-{
-	std::unordered_set<std::string> artists;
-
-	for (auto i = 0; i < count(); i++)
-	{
-		auto playlistId = item(i)->data(static_cast<int>(DataRole::PlaylistId))
-			.toString().toStdString();
-
-		for (auto &track: cache.get_playlist(playlistId).tracks)
-		{
-			for (const auto &artist: track.artists)
-			{
-				artists.insert(artist.name);
-			}
-		}
-	}
-
-	return artists;
+	const auto minutes = summary.duration / (lib::time::ms_in_sec * lib::time::secs_in_min);
+	const auto details = QString("%1 tracks, %2 min")
+		.arg(summary.track_count)
+		.arg(minutes);
+
+	return description.isEmpty()
+		? details
+		: QString("%1\n%2").arg(description, details);
 }
 
 auto List::Playlist::at(int index) -> lib::spt::playlist
@@ -3,9 +3,11 @@
 #include "lib/cache.hpp"
 #include "lib/spotify/api.hpp"
 #include "lib/spotify/playlist.hpp"
+#include "lib/spotify/playlistsync.hpp"
 #include "lib/enum/playlistorder.hpp"
 
 #include <QListWidget>
+#include <QTimer>
 
 namespace List
 {
@@ -21,8 +23,6 @@ namespace List
 		void refresh();
 		void order(lib::playlist_order item1);
 
-		auto allArtists() -> std::unordered_set<std::string>;
-
 		auto at(int index) -> lib::spt::playlist;
 		auto at(const std::string &playlistId) -> lib::spt::playlist;
 
@@ -34,11 +34,37 @@ namespace List
 		lib::cache &cache;
 		lib::settings &settings;
 
+		/** Milliseconds between checking for changes */
+		static constexpr int syncInterval = 10 * 60 * 1000;
+
+		/** Milliseconds to wait after loading playlists before syncing */
+		static constexpr int syncDelay = 3 * 1000;
+
+		/** Max number of playlists to fetch at the same time */
+		static constexpr size_t maxSyncRunning = 2;
+
+		/** Milliseconds between checking for playlists that took too long to fetch */
+		static constexpr int syncTimeoutInterval = 60 * 1000;
+
+		/** Fetches changed playlists in the background */
+		lib::spt::playlist_sync playlistSync;
+		QTimer *syncTimer = nullptr;
+
+		/** Update playlists with a new snapshot, shortly after playlists are loaded */
+		void sync(const std::vector<lib::spt::playlist> &playlists);
+
+		/** Playlist fetched in background */
+		void playlistSynced(const lib::spt::playlist &playlist);
+
+		void onSyncTimeout();
+
 		auto getItemIndex(QListWidgetItem *item) -> int;
 		void clicked(QListWidgetItem *item);
 		void doubleClicked(QListWidgetItem *item);
 		void menu(const QPoint &pos);
 
-		static auto latestTrack(const std::vector<lib::spt::track> &tracks) -> size_t;
+		/** Description followed by number of tracks and duration */
+		static auto toolTip(const QString &description,
+			const lib::spt::playlist_summary &summary) -> QString;
 	};
 }
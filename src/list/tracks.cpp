@@ -2,6 +2,8 @@
 #include "mainwindow.hpp"
 #include "dialog/createplaylist.hpp"
 #include "util/shortcut.hpp"
+#include "lib/trace.hpp"
+#include "lib/spotify/playlistmove.hpp"
 
 #include <QShortcut>
 
@@ -56,6 +58,10 @@ List::Tracks::Tracks(lib::spt::api &spotify, lib::settings &settings, lib::cache
 	QLabel::connect(header(), &QWidget::customContextMenuRequested,
 		this, &List::Tracks::onHeaderMenu);
 
+	// Keep track URIs in sync with current sorting
+	QAbstractItemModel::connect(model(), &QAbstractItemModel::layoutChanged,
+		this, &List::Tracks::updateTrackUris);
+
 	QShortcut::connect(new QShortcut(Shortcut::newPlaylist(), this),
 		&QShortcut::activated, this, &List::Tracks::onNewPlaylist);
 
@@ -113,7 +119,8 @@ void List::Tracks::onDoubleClicked(QTreeWidgetItem *item, int /*column*/)
 
 	bool indexFound;
 	auto trackIndex = item->data(0, static_cast<int>(DataRole::Index)).toInt(&indexFound);
-	if (!indexFound)
+	auto uriIndex = getTrackUriIndex(item);
+	if (!indexFound || uriIndex < 0)
 	{
 		StatusMessage::error(QStringLiteral("Failed to start playback: track not found"));
 		return;
@@ -137,8 +144,7 @@ void List::Tracks::onDoubleClicked(QTreeWidgetItem *item, int /*column*/)
 	const auto &context = mainWindow->getSptContext();
 	if (context.empty())
 	{
-		auto allTracks = mainWindow->currentTracks();
-		this->spotify.play_tracks(currentIndex().row(), allTracks, callback);
+		this->spotify.play_tracks(uriIndex, trackUris, callback);
 	}
 	else
 	{
@@ -254,23 +260,20 @@ void List::Tracks::onDelete()
 		}
 
 		auto index = item->data(0, static_cast<int>(DataRole::Index)).toInt();
-		tracks.emplace_back(index, track.id);
+		tracks.emplace_back(index, lib::spt::id_to_uri("track", track.id));
 	}
 
-	spotify.remove_from_playlist(playlistId, tracks,
-		[this, items, playlistId](const std::string &status)
+	mainWindow->getPlaylistEditor().remove(playlistId, tracks,
+		[this, playlistId](const lib::result<std::string> &result)
 		{
-			if (!status.empty())
+			if (!result.success())
 			{
 				StatusMessage::error(QString("Failed to remove track from playlist: %1")
-					.arg(QString::fromStdString(status)));
+					.arg(QString::fromStdString(result.message())));
 				return;
 			}
 
-			for (auto *item: items)
-			{
-				takeTopLevelItem(indexOfTopLevelItem(item));
-			}
+			loadEdited(playlistId, result.value());
 		});
 }
 
@@ -387,8 +390,12 @@ auto List::Tracks::getSelectedTrackIds() const -> std::vector<std::string>
 void List::Tracks::load(const std::vector<lib::spt::track> &tracks,
 	const std::string &selectedId, const std::string &addedAt)
 {
+	lib::trace_span span("List::Tracks::load", "ui");
+
 	clear();
 	trackItems.clear();
+	loadedUris.clear();
+	loadedUris.reserve(tracks.size());
 	playingTrackItem = nullptr;
 	auto fieldWidth = static_cast<int>(std::to_string(tracks.size()).size());
 	auto current = getCurrent();
@@ -428,6 +435,9 @@ void List::Tracks::load(const std::vector<lib::spt::track> &tracks,
 
 		insertTopLevelItem(index, item);
 		trackItems[track.id] = item;
+		loadedUris.push_back(track.is_valid()
+			? lib::spt::id_to_uri("track", track.id)
+			: std::string());
 
 		if (!selectedId.empty() && track.id == selectedId)
 		{
@@ -437,6 +447,9 @@ void List::Tracks::load(const std::vector<lib::spt::track> &tracks,
 
 	setSortingEnabled(true);
 
+	trackIndex.set_tracks(tracks);
+	applyFilter();
+
 	header()->setSectionHidden(static_cast<int>(Column::Added), !anyHasDate
 		|| lib::set::contains(settings.general.hidden_song_headers,
 			static_cast<int>(Column::Added)));
@@ -454,10 +467,11 @@ void List::Tracks::load(const std::vector<lib::spt::track> &tracks, const std::s
 
 void List::Tracks::load(const lib::spt::playlist &playlist)
 {
-	const auto &tracks = playlist.tracks.empty()
-		? cache.get_playlist(playlist.id).tracks
-		: playlist.tracks;
+	const auto cached = playlist.tracks.empty()
+		? cache.get_playlist(playlist.id)
+		: playlist;
 
+	const auto &tracks = cached.tracks;
 	if (!tracks.empty())
 	{
 		load(tracks);
@@ -469,22 +483,23 @@ void List::Tracks::load(const lib::spt::playlist &playlist)
 
 	auto *mainWindow = MainWindow::find(parentWidget());
 
-	const auto &snapshot = playlist.snapshot;
-	spotify.playlist(playlist.id,
-		[this, snapshot, mainWindow](const lib::spt::playlist &loadedPlaylist)
-		{
-			const auto &currentUser = mainWindow != nullptr
-				? mainWindow->getCurrentUser()
-				: lib::spt::user();
-
-			if (this->isEnabled()
-				&& this->topLevelItemCount() == loadedPlaylist.tracks_total
-				&& loadedPlaylist.is_up_to_date(snapshot, currentUser))
+	// Cache is kept up-to-date in the background, and when edited,
+	// so only check if it's outdated
+	if (tracks.empty() || !cached.is_up_to_date(playlist.snapshot))
+	{
+		const auto &snapshot = cached.snapshot;
+		spotify.playlist(playlist.id,
+			[this, snapshot](const lib::spt::playlist &loadedPlaylist)
 			{
-				return;
-			}
-			this->refreshPlaylist(loadedPlaylist);
-		});
+				if (this->isEnabled()
+					&& this->topLevelItemCount() == loadedPlaylist.tracks_total
+					&& loadedPlaylist.is_up_to_date(snapshot))
+				{
+					return;
+				}
+				this->refreshPlaylist(loadedPlaylist);
+			});
+	}
 
 	if (mainWindow != nullptr)
 	{
@@ -514,6 +529,27 @@ void List::Tracks::refreshPlaylist(const lib::spt::playlist &playlist)
 		});
 }
 
+void List::Tracks::loadEdited(const std::string &playlistId, const std::string &snapshot)
+{
+	auto *mainWindow = MainWindow::find(parentWidget());
+	if (lib::spt::id_to_uri("playlist", playlistId) != mainWindow->getSptContext())
+	{
+		return;
+	}
+
+	// Edits are patched into cache, so only fetch if patching failed
+	const auto cached = cache.get_playlist(playlistId);
+	if (!cached.is_null() && cached.is_up_to_date(snapshot))
+	{
+		load(cached.tracks);
+		return;
+	}
+
+	lib::spt::playlist playlist;
+	playlist.id = playlistId;
+	refreshPlaylist(playlist);
+}
+
 void List::Tracks::load(const lib::spt::album &album, const std::string &trackId)
 {
 	auto tracks = cache.get_tracks(album.id);
@@ -566,6 +602,115 @@ void List::Tracks::setPlayingTrackItem(const std::string &itemId)
 		: nullptr);
 }
 
+auto List::Tracks::getTrackUris() const -> const std::vector<std::string> &
+{
+	return trackUris;
+}
+
+auto List::Tracks::getTrackUriIndex(QTreeWidgetItem *item) const -> int
+{
+	const auto iter = trackUriIndices.find(item);
+	return iter != trackUriIndices.end()
+		? iter->second
+		: -1;
+}
+
+auto List::Tracks::getTrackOrder() const -> std::vector<size_t>
+{
+	const auto count = topLevelItemCount();
+	std::vector<size_t> positions;
+	positions.reserve(count);
+
+	for (auto i = 0; i < count; i++)
+	{
+		const auto *item = topLevelItem(i);
+
+		// Where hidden tracks should go isn't shown, so don't guess
+		if (item->isHidden())
+		{
+			return {};
+		}
+
+		const auto index = item->data(0, static_cast<int>(DataRole::Index)).toInt();
+		if (index >= 0)
+		{
+			positions.push_back(static_cast<size_t>(index));
+		}
+	}
+
+	// Positions have gaps if tracks were removed since loading
+	return lib::spt::playlist_move::to_order(positions);
+}
+
+void List::Tracks::updateTrackUris()
+{
+	const auto count = topLevelItemCount();
+
+	trackUris.clear();
+	trackUris.reserve(count);
+	trackUriIndices.clear();
+	trackUriIndices.reserve(count);
+
+	for (auto i = 0; i < count; i++)
+	{
+		const auto *item = topLevelItem(i);
+		const auto index = item->data(0, static_cast<int>(DataRole::Index)).toInt();
+		if (item->isHidden()
+			|| index < 0
+			|| static_cast<size_t>(index) >= loadedUris.size())
+		{
+			continue;
+		}
+
+		const auto &uri = loadedUris.at(index);
+		if (uri.empty())
+		{
+			continue;
+		}
+
+		trackUriIndices[item] = static_cast<int>(trackUris.size());
+		trackUris.push_back(uri);
+	}
+}
+
+void List::Tracks::setFilter(const QString &query)
+{
+	filterQuery = query.toStdString();
+	applyFilter();
+}
+
+void List::Tracks::applyFilter()
+{
+	std::vector<bool> visible(trackIndex.size(), filterQuery.empty());
+	if (!filterQuery.empty())
+	{
+		for (const auto index: trackIndex.filter(filterQuery))
+		{
+			visible[index] = true;
+		}
+	}
+
+	setUpdatesEnabled(false);
+
+	const auto count = topLevelItemCount();
+	for (auto i = 0; i < count; i++)
+	{
+		auto *item = topLevelItem(i);
+		const auto index = item->data(0, static_cast<int>(DataRole::Index)).toInt();
+		const auto hidden = index >= 0
+			&& static_cast<size_t>(index) < visible.size()
+			&& !visible[index];
+
+		if (item->isHidden() != hidden)
+		{
+			item->setHidden(hidden);
+		}
+	}
+
+	setUpdatesEnabled(true);
+	updateTrackUris();
+}
+
 auto List::Tracks::getCurrent() -> const spt::Current &
 {
 	auto *mainWindow = MainWindow::find(parentWidget());
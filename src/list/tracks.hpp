@@ -2,6 +2,7 @@
 
 #include "lib/cache.hpp"
 #include "lib/set.hpp"
+#include "lib/trackindex.hpp"
 #include "spotify/current.hpp"
 #include "menu/track.hpp"
 #include "enum/column.hpp"
@@ -48,6 +49,9 @@ namespace List
 		/** Force refresh tracks in playlist */
 		void refreshPlaylist(const lib::spt::playlist &playlist);
 
+		/** Reload playlist after editing it, if currently shown */
+		void loadEdited(const std::string &playlistId, const std::string &snapshot);
+
 		/**
 		 * Load album first from cache, then refresh it
 		 * @param album Album to load
@@ -55,6 +59,27 @@ namespace List
 		 */
 		void load(const lib::spt::album &album, const std::string &trackId = std::string());
 
+		/**
+		 * URIs of all playable tracks, in the order currently shown
+		 */
+		auto getTrackUris() const -> const std::vector<std::string> &;
+
+		/**
+		 * Index of item in getTrackUris(), or -1 if not found
+		 */
+		auto getTrackUriIndex(QTreeWidgetItem *item) const -> int;
+
+		/**
+		 * Position of each loaded track, in the order currently shown
+		 * @return Order, or empty if any track is filtered out
+		 */
+		auto getTrackOrder() const -> std::vector<size_t>;
+
+		/**
+		 * Only show tracks matching query, or all tracks if empty
+		 */
+		void setFilter(const QString &query);
+
 	protected:
 		void resizeEvent(QResizeEvent *event) override;
 
@@ -70,6 +95,27 @@ namespace List
 
 		std::unordered_map<std::string, QTreeWidgetItem *> trackItems;
 
+		/**
+		 * Track URIs in the order they were loaded, empty if not valid
+		 */
+		std::vector<std::string> loadedUris;
+
+		/**
+		 * Track URIs in the order they are currently shown
+		 */
+		std::vector<std::string> trackUris;
+
+		/**
+		 * Index of each item in trackUris
+		 */
+		std::unordered_map<const QTreeWidgetItem *, int> trackUriIndices;
+
+		/**
+		 * Search keys for loaded tracks, for filtering
+		 */
+		lib::track_index trackIndex;
+		std::string filterQuery;
+
 		QTreeWidgetItem *playingTrackItem = nullptr;
 		QIcon emptyIcon;
 
@@ -77,6 +123,8 @@ namespace List
 		auto getAddedText(const std::string &date) const -> QString;
 		auto getSelectedTrackIds() const -> std::vector<std::string>;
 		void resizeHeaders(const QSize &newSize);
+		void updateTrackUris();
+		void applyFilter();
 
 		void onMenu(const QPoint &pos);
 		void onDoubleClicked(QTreeWidgetItem *item, int column);
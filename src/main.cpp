@@ -2,6 +2,11 @@
 #include "util/appinstalltype.hpp"
 #include "lib/qtpaths.hpp"
 #include "lib/spotify/request.hpp"
+#include "lib/qt/maindispatcher.hpp"
+#include "lib/log.hpp"
+#include "lib/recordinghttpclient.hpp"
+#include "lib/strings.hpp"
+#include "lib/trace.hpp"
 
 #include <QApplication>
 #include <QCoreApplication>
@@ -21,6 +26,9 @@
 
 auto main(int argc, char *argv[]) -> int
 {
+	// Tracing is enabled later, but should include everything
+	const auto started = lib::trace::now();
+
 	// Set name for settings etc.
 	QCoreApplication::setOrganizationName(ORG_NAME);
 	QCoreApplication::setApplicationName(APP_NAME);
@@ -76,9 +84,23 @@ auto main(int argc, char *argv[]) -> int
 	{
 		lib::log::info("Config: {}", paths.config_file().string());
 		lib::log::info("Cache:  {}", paths.cache().string());
+		lib::log::info("Log:    {}", (paths.cache() / "spotify-qt.log").string());
 		return 0;
 	}
 
+	// Keep log after closing, in 3 files of 1 MB each
+	lib::log::set_file(std::make_shared<lib::log_file>(paths.cache() / "spotify-qt.log",
+		1024 * 1024, 3));
+
+	const auto logCategories = parser.value(ARG_LOG_CATEGORIES).toStdString();
+	for (const auto &category: lib::strings::split(logCategories, ','))
+	{
+		if (!category.empty())
+		{
+			lib::log::set_category_enabled(category, true);
+		}
+	}
+
 	// First setup window
 	if (settings.account.refresh_token.empty() || parser.isSet(ARG_FORCE_SETUP))
 	{
@@ -89,7 +111,17 @@ auto main(int argc, char *argv[]) -> int
 		}
 	}
 
-	lib::qt::http_client httpClient(nullptr);
+	// Results of background work are handled on the main thread
+	lib::qt::main_dispatcher dispatcher(nullptr);
+
+	lib::qt::http_client qtHttpClient(nullptr);
+
+	// Optionally record everything sent, to later replay without network access
+	lib::recording_http_client recordingHttpClient(qtHttpClient);
+	lib::http_client &httpClient = parser.isSet(ARG_RECORD_HTTP)
+		? static_cast<lib::http_client &>(recordingHttpClient)
+		: qtHttpClient;
+
 	lib::spt::request request(settings, httpClient);
 	spt::Spotify spotify(settings, httpClient, request, nullptr);
 
@@ -99,8 +131,25 @@ auto main(int argc, char *argv[]) -> int
 		return 1;
 	}
 
+	const auto windowStarted = lib::trace::now();
 	MainWindow window(settings, paths, httpClient, spotify);
 	window.show();
+	lib::trace::complete("MainWindow", "app", windowStarted);
+	lib::trace::complete("main", "app", started);
+
+	const auto result = QApplication::exec();
+
+	if (parser.isSet(ARG_TRACE))
+	{
+		lib::trace::save(parser.value(ARG_TRACE).toStdString());
+	}
+
+	if (parser.isSet(ARG_RECORD_HTTP)
+		&& !recordingHttpClient.save(parser.value(ARG_RECORD_HTTP).toStdString())
+		&& result == 0)
+	{
+		return 1;
+	}
 
-	return QApplication::exec();
+	return result;
 }
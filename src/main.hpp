@@ -5,6 +5,8 @@
 #include "lib/log.hpp"
 #include "lib/spotify/playback.hpp"
 #include "lib/spotify/playlist.hpp"
+#include "lib/spotify/playlisteditor.hpp"
+#include "lib/spotify/mutationqueue.hpp"
 #include "lib/spotify/user.hpp"
 #include "lib/qt/httpclient.hpp"
 #include "lib/crash/crashhandler.hpp"
@@ -3,15 +3,33 @@
 #include "lib/time.hpp"
 
 MainWindow::MainWindow(lib::settings &settings, lib::paths &paths,
-	lib::qt::http_client &httpClient, spt::Spotify &spotify)
+	lib::http_client &httpClient, spt::Spotify &spotify)
 	: spotify(spotify),
 	settings(settings),
 	paths(paths),
 	cache(paths),
+	playlistEditor(spotify, cache),
+	mutationQueue(spotify, paths.cache() / "mutations.json", std::chrono::seconds(1)),
 	httpClient(httpClient)
 {
 	lib::crash_handler::set_cache(cache);
 
+	// Following playlists changes list of playlists
+	mutationQueue.on_sent([this](const lib::spt::mutation &mutation)
+	{
+		if (lib::strings::starts_with(mutation.target, "playlist_followed:"))
+		{
+			refreshPlaylists();
+		}
+	});
+
+	// Changes are shown before being sent, so tell why they didn't stick
+	mutationQueue.on_failed([](const lib::spt::mutation &mutation, const std::string &message)
+	{
+		StatusMessage::error(QString("Failed to %1: %2")
+			.arg(mutationText(mutation), QString::fromStdString(message)));
+	});
+
 	// winId is required for moving the window under Wayland
 #if QT_VERSION >= QT_VERSION_CHECK(5, 15, 0)
 	if (lib::system::window_system() == lib::window_system::wayland)
@@ -217,6 +235,9 @@ void MainWindow::minimize()
 
 void MainWindow::refresh()
 {
+	// Retry changes made while offline
+	mutationQueue.flush();
+
 	if (refreshCount < 0
 		|| ++refreshCount >= settings.general.refresh_interval
 		|| current.playback.progress_ms + lib::time::ms_in_sec > current.playback.item.duration)
@@ -436,26 +457,9 @@ void MainWindow::openArtist(const std::string &artistId)
 	dynamic_cast<SidePanel::View *>(sidePanel)->openArtist(artistId);
 }
 
-auto MainWindow::currentTracks() -> std::vector<std::string>
+auto MainWindow::currentTracks() -> const std::vector<std::string> &
 {
-	const auto *tracksList = mainContent->getTracksList();
-	const auto tracksCount = tracksList->topLevelItemCount();
-
-	std::vector<std::string> tracks;
-	tracks.reserve(tracksCount);
-
-	for (int i = 0; i < tracksCount; i++)
-	{
-		auto track = tracksList->topLevelItem(i)->data(0, static_cast<int>(DataRole::Track))
-			.value<lib::spt::track>();
-		if (!track.is_valid())
-		{
-			continue;
-		}
-		tracks.push_back(lib::spt::id_to_uri("track", track.id));
-	}
-
-	return tracks;
+	return mainContent->getTracksList()->getTrackUris();
 }
 
 void MainWindow::reloadTrayIcon()
@@ -515,6 +519,16 @@ auto MainWindow::getCurrentUser() const -> const lib::spt::user &
 	return currentUser;
 }
 
+auto MainWindow::getPlaylistEditor() -> lib::spt::playlist_editor &
+{
+	return playlistEditor;
+}
+
+auto MainWindow::getMutationQueue() -> lib::spt::mutation_queue &
+{
+	return mutationQueue;
+}
+
 void MainWindow::setSearchChecked(bool checked)
 {
 	toolBar->setSearchChecked(checked);
@@ -613,11 +627,6 @@ void MainWindow::setCurrentPlaylistItem(int index)
 	playlistList->setCurrentRow(index);
 }
 
-auto MainWindow::allArtists() -> std::unordered_set<std::string>
-{
-	return playlistList->allArtists();
-}
-
 auto MainWindow::getCurrentPlaylistItem() -> QListWidgetItem *
 {
 	return playlistList->currentItem();
@@ -648,6 +657,21 @@ auto MainWindow::find(QWidget *from) -> MainWindow *
 	return Parent::findWidget<MainWindow>(from);
 }
 
+auto MainWindow::mutationText(const lib::spt::mutation &mutation) -> QString
+{
+	if (lib::strings::starts_with(mutation.target, "track_saved:"))
+	{
+		return mutation.value ? QStringLiteral("like") : QStringLiteral("unlike");
+	}
+
+	if (lib::strings::contains(mutation.target, "_followed:"))
+	{
+		return mutation.value ? QStringLiteral("follow") : QStringLiteral("unfollow");
+	}
+
+	return QString::fromStdString(mutation.url);
+}
+
 auto MainWindow::defaultSize() -> QSize
 {
 	constexpr int width = 1280;
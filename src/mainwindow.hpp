@@ -8,7 +8,7 @@ Q_OBJECT
 
 public:
 	MainWindow(lib::settings &settings, lib::paths &paths,
-		lib::qt::http_client &httpClient, spt::Spotify &spotify);
+		lib::http_client &httpClient, spt::Spotify &spotify);
 
 	static MainWindow *find(QWidget *from);
 	static auto defaultSize() -> QSize;
@@ -28,10 +28,12 @@ public:
 	void reloadTrayIcon();
 	auto getTrayIcon() -> TrayIcon *;
 	auto getCurrentUser() const -> const lib::spt::user &;
+	auto getPlaylistEditor() -> lib::spt::playlist_editor &;
+	auto getMutationQueue() -> lib::spt::mutation_queue &;
 	void setFixedWidthTime(bool value);
 	std::vector<lib::spt::track> loadTracksFromCache(const std::string &id);
 	void saveTracksToCache(const std::string &id, const std::vector<lib::spt::track> &tracks);
-	std::vector<std::string> currentTracks();
+	auto currentTracks() -> const std::vector<std::string> &;
 	void refresh();
 	void refreshed(const lib::spt::playback &playback);
 	void toggleTrackNumbers(bool enabled);
@@ -41,7 +43,6 @@ public:
 	void setCurrentLibraryItem(QTreeWidgetItem *item);
 	lib::spt::playlist getPlaylist(int index);
 	void setCurrentPlaylistItem(int index);
-	std::unordered_set<std::string> allArtists();
 	QListWidgetItem *getCurrentPlaylistItem();
 	int getPlaylistItemCount();
 	QListWidgetItem *getPlaylistItem(int index);
@@ -90,6 +91,8 @@ private:
 	lib::settings &settings;
 	lib::paths &paths;
 	lib::json_cache cache;
+	lib::spt::playlist_editor playlistEditor;
+	lib::spt::mutation_queue mutationQueue;
 	lib::spt::user currentUser;
 	lib::http_client &httpClient;
 
@@ -115,4 +118,7 @@ private:
 	QWidget *createCentralWidget();
 	void setAlbumImage(const lib::spt::entity &albumEntity, const std::string &albumImageUrl);
 	void setSptContext(const std::string &uri);
+
+	/** What mutation does, like "like tracks", to complete "Failed to ..." */
+	static auto mutationText(const lib::spt::mutation &mutation) -> QString;
 };
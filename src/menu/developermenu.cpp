@@ -3,6 +3,7 @@
 #include "dialog/createplaylist.hpp"
 #include "dialog/addtoplaylist.hpp"
 #include "dialog/apirequest.hpp"
+#include "dialog/apimetrics.hpp"
 
 DeveloperMenu::DeveloperMenu(lib::settings &settings, lib::spt::api &spotify,
 	lib::cache &cache, const lib::http_client &httpClient, QWidget *parent)
@@ -21,6 +22,13 @@ DeveloperMenu::DeveloperMenu(lib::settings &settings, lib::spt::api &spotify,
 		debugView->show();
 	});
 
+	addMenuItem(this, "API metrics", [this]()
+	{
+		auto *mainWindow = MainWindow::find(parentWidget());
+		auto *dialog = new Dialog::ApiMetrics(this->spotify.get_metrics(), mainWindow);
+		dialog->show();
+	});
+
 	addMenuItem(this, "Reset size", [this]()
 	{
 		MainWindow::find(parentWidget())->resize(MainWindow::defaultSize());
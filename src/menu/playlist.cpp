@@ -25,6 +25,11 @@ Menu::Playlist::Playlist(lib::spt::api &spotify, const lib::spt::playlist &playl
 	QAction::connect(editAction, &QAction::triggered,
 		this, &Menu::Playlist::onEdit);
 
+	saveOrderAction = addAction(Icon::get("view-sort-ascending"), "Save current order");
+	saveOrderAction->setVisible(false);
+	QAction::connect(saveOrderAction, &QAction::triggered,
+		this, &Menu::Playlist::onSaveOrder);
+
 	auto *refresh = addAction(Icon::get("view-refresh"), "Refresh");
 	refresh->setVisible(dynamic_cast<List::Playlist *>(parentWidget()) != nullptr);
 	QAction::connect(refresh, &QAction::triggered,
@@ -49,15 +54,19 @@ Menu::Playlist::Playlist(lib::spt::api &spotify, const lib::spt::playlist &playl
 		tracksLoaded(cached.tracks);
 	}
 
-	const auto *mainWindow = MainWindow::find(parentWidget());
-	const auto &currentUser = mainWindow != nullptr
-		? mainWindow->getCurrentUser()
-		: lib::spt::user();
-
-	if (cached.is_null() || !playlist.is_up_to_date(cached.snapshot, currentUser))
+	// Not cancelled when closed, as the cache is still worth updating
+	if (cached.is_null() || !playlist.is_up_to_date(cached.snapshot))
 	{
 		spotify.playlist_tracks(playlist, [this](const std::vector<lib::spt::track> &items)
 		{
+			// Only fetched tracks match the snapshot of the playlist
+			if (!items.empty() && !playlist.is_null())
+			{
+				auto fetched = playlist;
+				fetched.tracks = items;
+				cache.set_playlist(fetched);
+			}
+
 			tracksLoaded(items);
 		});
 	}
@@ -69,14 +78,33 @@ void Menu::Playlist::showEvent(QShowEvent *event)
 
 	auto *mainWindow = MainWindow::find(parentWidget());
 
+	lib::cancel_context context(cancelScope.token());
 	spotify.is_following_playlist(playlist.id, {
 		mainWindow->getCurrentUser().id,
-	}, [this](const std::vector<bool> &follows)
+	}, [this, mainWindow](const std::vector<bool> &follows)
 	{
-		isFollowingLoaded(follows);
+		if (follows.empty())
+		{
+			isFollowingLoaded(follows);
+			return;
+		}
+
+		// Follow may not have been sent yet
+		const auto target = lib::spt::mutation::follow_playlist(playlist.id, true).target;
+		isFollowingLoaded({
+			mainWindow->getMutationQueue().state(target, follows.front()),
+		});
 	});
 }
 
+void Menu::Playlist::hideEvent(QHideEvent *event)
+{
+	QWidget::hideEvent(event);
+
+	// Menu isn't deleted when closed, but is never shown again
+	cancelScope.cancel();
+}
+
 auto Menu::Playlist::shareMenu() -> QMenu *
 {
 	auto *menu = new QMenu("Share", this);
@@ -143,10 +171,17 @@ void Menu::Playlist::tracksLoaded(const std::vector<lib::spt::track> &items)
 	}
 	editAction->setVisible(isOwner);
 
-	if (!items.empty() && !playlist.is_null())
+	// Only when shown in a different order than in the playlist
+	if (isOwner && lib::spt::id_to_uri("playlist", playlist.id) == window->getSptContext())
+	{
+		const auto order = window->getSongsTree()->getTrackOrder();
+		saveOrderAction->setVisible(order.size() == items.size()
+			&& !std::is_sorted(order.cbegin(), order.cend()));
+	}
+
+	if (!items.empty())
 	{
 		playlist.tracks = items;
-		cache.set_playlist(playlist);
 	}
 }
 
@@ -219,6 +254,30 @@ void Menu::Playlist::onEdit(bool /*checked*/)
 	}
 }
 
+void Menu::Playlist::onSaveOrder(bool /*checked*/)
+{
+	auto *mainWindow = MainWindow::find(parentWidget());
+	const auto order = mainWindow->getSongsTree()->getTrackOrder();
+	const auto playlistId = playlist.id;
+	const auto playlistName = QString::fromStdString(playlist.name);
+
+	StatusMessage::info(QString("Saving order of %1...").arg(playlistName));
+
+	mainWindow->getPlaylistEditor().reorder(playlistId, order,
+		[mainWindow, playlistId, playlistName](const lib::result<std::string> &result)
+		{
+			if (!result.success())
+			{
+				StatusMessage::error(QString("Failed to save order: %1")
+					.arg(QString::fromStdString(result.message())));
+				return;
+			}
+
+			mainWindow->getSongsTree()->loadEdited(playlistId, result.value());
+			StatusMessage::info(QString("Saved order of %1").arg(playlistName));
+		});
+}
+
 void Menu::Playlist::onRefresh(bool /*checked*/)
 {
 	auto *mainWindow = MainWindow::find(parentWidget());
@@ -229,30 +288,10 @@ void Menu::Playlist::onFollow(bool /*checked*/)
 {
 	const auto isFollowing = followAction->text() == "Unfollow";
 
-	auto callback = [this, isFollowing](const std::string &status)
-	{
-		if (!status.empty())
-		{
-			StatusMessage::error(QString("Failed to %1: %2")
-				.arg(isFollowing
-					? QStringLiteral("unfollow")
-					: QStringLiteral("follow"))
-				.arg(QString::fromStdString(status)));
-			return;
-		}
-
-		auto *mainWindow = MainWindow::find(parentWidget());
-		mainWindow->refreshPlaylists();
-	};
-
-	if (isFollowing)
-	{
-		spotify.unfollow_playlist(playlist.id, callback);
-	}
-	else
-	{
-		spotify.follow_playlist(playlist.id, callback);
-	}
+	// Playlists are refreshed when sent
+	auto *mainWindow = MainWindow::find(parentWidget());
+	mainWindow->getMutationQueue()
+		.add(lib::spt::mutation::follow_playlist(playlist.id, !isFollowing));
 }
 
 void Menu::Playlist::onCopyLink(bool /*checked*/) const
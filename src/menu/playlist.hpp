@@ -2,6 +2,7 @@
 
 #include "dialog/playlistedit.hpp"
 #include "lib/spotify/api.hpp"
+#include "lib/canceltoken.hpp"
 #include "lib/cache.hpp"
 #include "lib/random.hpp"
 
@@ -21,6 +22,7 @@ namespace Menu
 
 	protected:
 		void showEvent(QShowEvent *event) override;
+		void hideEvent(QHideEvent *event) override;
 
 	private:
 		lib::spt::playlist playlist;
@@ -32,8 +34,12 @@ namespace Menu
 		QAction *tracksAction = nullptr;
 		QAction *byAction = nullptr;
 		QAction *editAction = nullptr;
+		QAction *saveOrderAction = nullptr;
 		QAction *followAction = nullptr;
 
+		/** Cancels loading of follow state when menu is closed */
+		lib::cancel_scope cancelScope;
+
 		void tracksLoaded(const std::vector<lib::spt::track> &items);
 		void isFollowingLoaded(const std::vector<bool> &follows);
 
@@ -44,6 +50,7 @@ namespace Menu
 
 		void onShuffle(bool checked);
 		void onEdit(bool checked);
+		void onSaveOrder(bool checked);
 		void onRefresh(bool checked);
 		void onFollow(bool checked);
 		void onCopyLink(bool checked) const;
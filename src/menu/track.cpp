@@ -73,9 +73,13 @@ Menu::Track::Track(const QList<PlaylistTrack> &tracks, lib::spt::api &spotify,
 	if (isSingle)
 	{
 		const auto trackId = lib::spt::uri_to_id(singleTrack.id);
-		spotify.is_saved_track({trackId}, [this](const std::vector<bool> &likes)
+		spotify.is_saved_track({trackId}, [this, mainWindow, trackId](const std::vector<bool> &likes)
 		{
-			auto liked = !likes.empty() && likes.front();
+			// Like may not have been sent yet
+			const auto target = lib::spt::mutation::save_tracks({trackId}, true).target;
+			auto liked = mainWindow->getMutationQueue()
+				.state(target, !likes.empty() && likes.front());
+
 			this->setLiked(liked);
 			this->toggleLiked->setEnabled(true);
 		});
@@ -273,26 +277,15 @@ auto Menu::Track::getTracks() const -> std::vector<lib::spt::track>
 
 void Menu::Track::onLike(bool /*checked*/)
 {
-	auto callback = [this](const std::string &status)
-	{
-		if (status.empty())
-		{
-			return;
-		}
-
-		StatusMessage::error(QString("Failed to %1: %2")
-			.arg(isLiked ? "unlike" : "like")
-			.arg(QString::fromStdString(status)));
-	};
-
-	if (isLiked)
-	{
-		spotify.remove_saved_tracks(getTrackIds(), callback);
-	}
-	else
+	auto *mainWindow = MainWindow::find(parentWidget());
+	if (mainWindow == nullptr)
 	{
-		spotify.add_saved_tracks(getTrackIds(), callback);
+		return;
 	}
+
+	// Sent when online, failures are shown when sent
+	mainWindow->getMutationQueue()
+		.add(lib::spt::mutation::save_tracks(getTrackIds(), !isLiked));
 }
 
 void Menu::Track::addToQueue(const QList<PlaylistTrack>::const_iterator &begin,
@@ -307,6 +300,7 @@ void Menu::Track::addToQueue(const QList<PlaylistTrack>::const_iterator &begin,
 		return;
 	}
 
+	// Not sent again later, as it could add the track twice
 	const auto uri = lib::spt::id_to_uri("track", begin->second.id);
 	spotify.add_to_queue(uri, [this, begin, end](const std::string &status)
 	{
@@ -331,57 +325,29 @@ void Menu::Track::onRemoveFromPlaylist(bool /*checked*/)
 	std::vector<std::pair<int, std::string>> uris;
 	uris.reserve(tracks.size());
 
-	std::unordered_set<std::string> trackIds;
-	trackIds.reserve(tracks.size());
-
 	for (const auto &track: tracks)
 	{
 		uris.emplace_back(track.first, lib::spt::id_to_uri("track", track.second.id));
-		trackIds.insert(track.second.id);
 	}
 
-	spotify.remove_from_playlist(currentPlaylist.id, uris,
-		[this, trackIds](const std::string &status)
+	auto *mainWindow = MainWindow::find(parentWidget());
+	if (mainWindow == nullptr)
+	{
+		return;
+	}
+
+	mainWindow->getPlaylistEditor().remove(currentPlaylist.id, uris,
+		[this, mainWindow](const lib::result<std::string> &result)
 		{
-			// Remove from Spotify
-			if (!status.empty())
+			if (!result.success())
 			{
 				StatusMessage::error(QString("Failed to remove track from playlist: %1")
-					.arg(QString::fromStdString(status)));
+					.arg(QString::fromStdString(result.message())));
 				return;
 			}
 
-			// Remove from interface
-			auto *mainWindow = MainWindow::find(this->parentWidget());
-			QList<int> toRemove;
-
-			for (auto i = 0; i < mainWindow->getSongsTree()->topLevelItemCount(); i++)
-			{
-				auto *item = mainWindow->getSongsTree()->topLevelItem(i);
-
-				const auto &trackId = item->data(0,
-					static_cast<int>(DataRole::Track)).value<lib::spt::track>().id;
-
-				if (trackIds.count(trackId) > 0)
-				{
-					toRemove.append(i);
-				}
-			}
-
-			if (toRemove.empty())
-			{
-				lib::log::warn("Failed to remove track from list");
-				return;
-			}
-
-			// It doesn't necessarily match item index depending on sorting order
-			for (const auto index: toRemove)
-			{
-				mainWindow->getSongsTree()->takeTopLevelItem(index);
-			}
-
-			// Refresh the playlist automatically to prevent issues with songs being skipped
-			mainWindow->getSongsTree()->refreshPlaylist(currentPlaylist);
+			// Cached playlist is already patched, so no need to fetch it again
+			mainWindow->getSongsTree()->loadEdited(currentPlaylist.id, result.value());
 
 			StatusMessage::info(QString("Removed from %1")
 				.arg(QString::fromStdString(currentPlaylist.name)));
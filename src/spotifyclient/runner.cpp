@@ -1,7 +1,7 @@
 #include "spotifyclient/runner.hpp"
 #include "mainwindow.hpp"
 
-std::vector<lib::log_message> SpotifyClient::Runner::log;
+lib::log_buffer SpotifyClient::Runner::log(1024, 10000);
 
 SpotifyClient::Runner::Runner(const lib::settings &settings,
 	const lib::paths &paths, QWidget *parent)
@@ -150,7 +150,7 @@ auto SpotifyClient::Runner::start() -> QString
 	QProcess::connect(process, &QProcess::readyReadStandardError,
 		this, &Runner::readyError);
 
-	lib::log::debug("starting: {} {}", path.toStdString(),
+	LIB_LOG_DEBUG("starting: {} {}", path.toStdString(),
 		arguments.join(' ').toStdString());
 
 	process->start(path, arguments);
@@ -184,7 +184,7 @@ void SpotifyClient::Runner::logOutput(const QByteArray &output, lib::log_type lo
 			continue;
 		}
 
-		log.emplace_back(lib::date_time::now(), logType, line.toStdString());
+		log.push(lib::log_message(lib::date_time::now(), logType, line.toStdString()));
 	}
 }
 
@@ -198,7 +198,10 @@ void SpotifyClient::Runner::readyError() const
 	logOutput(process->readAllStandardError(), lib::log_type::error);
 }
 
-auto SpotifyClient::Runner::getLog() -> const std::vector<lib::log_message> &
+auto SpotifyClient::Runner::getLog(size_t &next) -> std::vector<lib::log_message>
 {
-	return log;
+	log.drain([](const lib::log_message &/*message*/)
+	{
+	});
+	return log.messages_since(next);
 }
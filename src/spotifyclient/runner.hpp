@@ -2,7 +2,7 @@
 
 #include "lib/enum/clienttype.hpp"
 #include "lib/settings.hpp"
-#include "lib/logmessage.hpp"
+#include "lib/logbuffer.hpp"
 
 #include "spotifyclient/helper.hpp"
 #include "keyring/kwallet.hpp"
@@ -30,14 +30,18 @@ namespace SpotifyClient
 		auto start() -> QString;
 		auto waitForStarted() const -> bool;
 
-		static auto getLog() -> const std::vector<lib::log_message> &;
+		/**
+		 * Get messages not yet seen
+		 * @param next Number of messages seen, updated to include returned messages
+		 */
+		static auto getLog(size_t &next) -> std::vector<lib::log_message>;
 		auto isRunning() const -> bool;
 
 	private:
 		QProcess *process = nullptr;
 		QWidget *parentWidget = nullptr;
 		QString path;
-		static std::vector<lib::log_message> log;
+		static lib::log_buffer log;
 		const lib::settings &settings;
 		const lib::paths &paths;
 		lib::client_type clientType;
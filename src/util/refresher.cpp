@@ -1,6 +1,7 @@
 #include "util/refresher.hpp"
 #include "dialog/setup.hpp"
 #include "lib/spotify/error.hpp"
+#include "lib/trace.hpp"
 
 #include <QMessageBox>
 
@@ -14,6 +15,8 @@ Refresher::Refresher(lib::settings &settings, lib::spt::request &spotify)
 
 auto Refresher::refresh() -> bool
 {
+	lib::trace_span span("Refresher::refresh");
+
 	try
 	{
 		spotify.refresh();
@@ -10,6 +10,11 @@ auto Shortcut::deleteTrack() -> QKeySequence
 	return {Qt::Key_Delete};
 }
 
+auto Shortcut::filterTracks() -> QKeySequence
+{
+	return {Qt::CTRL | Qt::SHIFT | Qt::Key_F};
+}
+
 auto Shortcut::playPause() -> QKeySequence
 {
 	return {Qt::Key_Space};
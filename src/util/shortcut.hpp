@@ -11,6 +11,7 @@ class Shortcut
 public:
 	static auto newPlaylist() -> QKeySequence;
 	static auto deleteTrack() -> QKeySequence;
+	static auto filterTracks() -> QKeySequence;
 
 	static auto playPause() -> QKeySequence;
 	static auto repeat() -> QKeySequence;
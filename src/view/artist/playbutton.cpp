@@ -63,7 +63,13 @@ void Artist::PlayButton::setArtist(const lib::spt::artist &loadedArtist)
 	spotify.is_following(lib::follow_type::artist, {artist.id},
 		[this](const std::vector<bool> &follows)
 		{
-			this->updateFollow(!follows.empty() && follows.at(0));
+			// Follow may not have been sent yet
+			auto *mainWindow = MainWindow::find(this->parentWidget());
+			const auto target = lib::spt::mutation::follow(lib::follow_type::artist,
+				{artist.id}, true).target;
+
+			this->updateFollow(mainWindow->getMutationQueue()
+				.state(target, !follows.empty() && follows.at(0)));
 			this->follow->setEnabled(true);
 		});
 
@@ -81,26 +87,7 @@ void Artist::PlayButton::onFollow(bool /*checked*/)
 	auto isFollowing = follow->text().contains("Unfollow");
 	updateFollow(!isFollowing);
 
-	auto callback = [isFollowing](const std::string &status)
-	{
-		if (status.empty())
-		{
-			return;
-		}
-
-		StatusMessage::error(QString("Failed to %1: %2")
-			.arg(isFollowing ? "unfollow" : "follow")
-			.arg(QString::fromStdString(status)));
-	};
-
-	if (isFollowing)
-	{
-		spotify.unfollow(lib::follow_type::artist,
-			{artist.id}, callback);
-	}
-	else
-	{
-		spotify.follow(lib::follow_type::artist,
-			{artist.id}, callback);
-	}
+	auto *mainWindow = MainWindow::find(parentWidget());
+	mainWindow->getMutationQueue().add(lib::spt::mutation::follow(lib::follow_type::artist,
+		{artist.id}, !isFollowing));
 }
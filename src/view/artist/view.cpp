@@ -53,10 +53,29 @@ Artist::View::View(lib::spt::api &spotify, const std::string &artistId,
 		this, &Artist::View::relatedClick);
 	tabs->addTab(relatedList, "Related");
 
-	spotify.artist(this->artistId, [this](const lib::spt::artist &loadedArtist)
+	// Only the id is needed to load everything, so it's all loaded at the same time
+	artist.id = this->artistId;
+	lib::cancel_context context(cancelScope.token());
+
+	spotify.artist(artist.id).then([this](const lib::spt::artist &loadedArtist)
 	{
 		artistLoaded(loadedArtist);
 	});
+
+	spotify.top_tracks(artist).then([this](const std::vector<lib::spt::track> &tracks)
+	{
+		topTracksLoaded(tracks);
+	});
+
+	spotify.albums(artist).then([this](const std::vector<lib::spt::album> &albums)
+	{
+		albumList->setAlbums(albums);
+	});
+
+	spotify.related_artists(artist).then([this](const std::vector<lib::spt::artist> &artists)
+	{
+		relatedArtistsLoaded(artists);
+	});
 }
 
 void Artist::View::artistLoaded(const lib::spt::artist &loadedArtist)
@@ -91,24 +110,6 @@ void Artist::View::artistLoaded(const lib::spt::artist &loadedArtist)
 
 	// Genres
 	genres->setText(QString::fromStdString(lib::strings::join(artist.genres, ", ")));
-
-	// Top tracks
-	spotify.top_tracks(artist, [this](const std::vector<lib::spt::track> &tracks)
-	{
-		topTracksLoaded(tracks);
-	});
-
-	// Albums
-	spotify.albums(artist, [this](const std::vector<lib::spt::album> &albums)
-	{
-		albumList->setAlbums(albums);
-	});
-
-	// Related artists
-	spotify.related_artists(artist, [this](const std::vector<lib::spt::artist> &artists)
-	{
-		relatedArtistsLoaded(artists);
-	});
 }
 
 void Artist::View::topTracksLoaded(const std::vector<lib::spt::track> &tracks)
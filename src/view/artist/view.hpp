@@ -1,6 +1,7 @@
 #pragma once
 
 #include "lib/enum/followtype.hpp"
+#include "lib/canceltoken.hpp"
 #include "lib/spotify/api.hpp"
 
 #include "menu/album.hpp"
@@ -46,6 +47,9 @@ namespace Artist
 		lib::cache &cache;
 		const lib::http_client &httpClient;
 
+		/** Cancels requests when view is closed */
+		lib::cancel_scope cancelScope;
+
 		AlbumsList *albumList;
 		Cover *coverLabel = nullptr;
 		PlayButton *context = nullptr;
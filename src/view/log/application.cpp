@@ -6,7 +6,7 @@ Log::Application::Application(QWidget *parent)
 {
 }
 
-auto Log::Application::getMessages() -> const std::vector<lib::log_message> &
+auto Log::Application::getMessages(size_t &next) -> std::vector<lib::log_message>
 {
-	return lib::log::get_messages();
+	return lib::log::get_messages(next);
 }
@@ -10,18 +10,53 @@
 #include <QDateTime>
 #include <QFileDialog>
 #include <QMenu>
+#include <QScrollBar>
 
 Log::Base::Base(QWidget *parent)
 	: QWidget(parent)
 {
 	auto *layout = new QVBoxLayout(this);
 
-	list = new QTreeWidget(this);
-	list->setHeaderLabels({
-		QStringLiteral("Time"),
-		QStringLiteral("Type"),
-		QStringLiteral("Message"),
-	});
+	auto *filters = new QHBoxLayout();
+	layout->addLayout(filters);
+
+	search = new QLineEdit(this);
+	search->setPlaceholderText(QStringLiteral("Filter"));
+	search->setClearButtonEnabled(true);
+	filters->addWidget(search, 1);
+
+	// Only filter once done typing
+	filterTimer = new QTimer(this);
+	filterTimer->setSingleShot(true);
+	filterTimer->setInterval(filterDelay);
+
+	QTimer::connect(filterTimer, &QTimer::timeout,
+		this, &Log::Base::onFilterChanged);
+
+	QLineEdit::connect(search, &QLineEdit::textChanged,
+		filterTimer, QOverload<>::of(&QTimer::start));
+
+	types = new QComboBox(this);
+	types->addItem(QStringLiteral("All"));
+	types->addItem(QStringLiteral("Information"),
+		static_cast<int>(lib::log_type::information));
+	types->addItem(QStringLiteral("Warning"),
+		static_cast<int>(lib::log_type::warning));
+	types->addItem(QStringLiteral("Error"),
+		static_cast<int>(lib::log_type::error));
+	types->addItem(QStringLiteral("Debug"),
+		static_cast<int>(lib::log_type::verbose));
+	filters->addWidget(types);
+
+	QComboBox::connect(types, QOverload<int>::of(&QComboBox::currentIndexChanged),
+		this, &Log::Base::onFilterChanged);
+
+	model = new Model(this);
+
+	// Only visible rows are created, as all rows have the same height
+	list = new QTreeView(this);
+	list->setModel(model);
+	list->setUniformRowHeights(true);
 	list->setEditTriggers(QAbstractItemView::NoEditTriggers);
 	list->setSelectionBehavior(QAbstractItemView::SelectRows);
 	list->setRootIsDecorated(false);
@@ -47,45 +82,70 @@ Log::Base::Base(QWidget *parent)
 	list->setContextMenuPolicy(Qt::ContextMenuPolicy::CustomContextMenu);
 	QWidget::connect(list, &QWidget::customContextMenuRequested,
 		this, &Log::Base::onMenuRequested);
+
+	refreshTimer = new QTimer(this);
+	refreshTimer->setInterval(refreshInterval);
+
+	QTimer::connect(refreshTimer, &QTimer::timeout,
+		this, &Log::Base::onRefresh);
 }
 
 void Log::Base::showEvent(QShowEvent *event)
 {
 	QWidget::showEvent(event);
 
-	list->clear();
-	for (const auto &logMessage: getMessages())
+	onRefresh();
+	refreshTimer->start();
+}
+
+void Log::Base::hideEvent(QHideEvent *event)
+{
+	QWidget::hideEvent(event);
+
+	refreshTimer->stop();
+}
+
+void Log::Base::onRefresh()
+{
+	const auto messages = getMessages(next);
+	if (messages.empty())
 	{
-		const auto time = QString::fromStdString(logMessage.get_time());
-		const auto type = QString::fromStdString(logMessage.get_type());
-		const auto message = QString::fromStdString(logMessage.get_message());
-
-		auto *item = new QTreeWidgetItem({
-			time,
-			type,
-			message,
-		});
-
-		item->setToolTip(0, time);
-		item->setToolTip(1, type);
-		item->setToolTip(2, message);
-
-		item->setData(0, messageRole, QVariant::fromValue(logMessage));
-		list->addTopLevelItem(item);
+		return;
 	}
+
+	// Keep following new messages if already at the end
+	auto *scrollBar = list->verticalScrollBar();
+	const auto atEnd = scrollBar->value() == scrollBar->maximum();
+
+	model->append(messages);
+
+	if (atEnd)
+	{
+		list->scrollToBottom();
+	}
+}
+
+void Log::Base::onFilterChanged()
+{
+	filterTimer->stop();
+
+	std::vector<lib::log_type> logTypes;
+	const auto type = types->currentData();
+	if (type.isValid())
+	{
+		logTypes.push_back(static_cast<lib::log_type>(type.toInt()));
+	}
+
+	model->setFilter(lib::log_filter(search->text().toStdString(), logTypes));
 }
 
 auto Log::Base::collectLogs() -> QString
 {
 	QStringList items;
 
-	for (auto i = 0; i < list->topLevelItemCount(); i++)
+	for (auto i = 0; i < model->rowCount(); i++)
 	{
-		auto *item = list->topLevelItem(i);
-		const auto &data = item->data(0, messageRole);
-		const auto &message = data.value<lib::log_message>();
-
-		items.append(QString::fromStdString(message.to_string()));
+		items.append(QString::fromStdString(model->message(i).to_string()));
 	}
 
 	return items.join('\n');
@@ -120,22 +180,20 @@ void Log::Base::onSaveToFile(bool /*checked*/)
 
 void Log::Base::onMenuRequested(const QPoint &pos)
 {
-	auto *item = list->itemAt(pos);
-	if (item == nullptr)
+	const auto index = list->indexAt(pos);
+	if (!index.isValid())
 	{
 		return;
 	}
 
+	const auto message = model->message(index.row());
 	auto *menu = new QMenu(this);
 
 	auto *copyToClipboard = menu->addAction(Icon::get(QStringLiteral("edit-copy")),
 		QStringLiteral("Copy to clipboard"));
 
-	QAction::connect(copyToClipboard, &QAction::triggered, [item](bool /*checked*/)
+	QAction::connect(copyToClipboard, &QAction::triggered, [message](bool /*checked*/)
 	{
-		const auto &data = item->data(0, messageRole);
-		const auto &message = data.value<lib::log_message>();
-
 		QApplication::clipboard()->setText(QString::fromStdString(message.to_string()));
 	});
 
@@ -1,8 +1,13 @@
 #pragma once
+
 #include "lib/logmessage.hpp"
+#include "view/log/model.hpp"
 
+#include <QComboBox>
+#include <QLineEdit>
+#include <QTimer>
+#include <QTreeView>
 #include <QWidget>
-#include <QTreeWidget>
 
 namespace Log
 {
@@ -11,17 +16,43 @@ namespace Log
 	protected:
 		explicit Base(QWidget *parent);
 
-		virtual auto getMessages() -> const std::vector<lib::log_message> & = 0;
+		/**
+		 * Get messages not yet shown
+		 * @param next Number of messages shown, updated to include returned messages
+		 */
+		virtual auto getMessages(size_t &next) -> std::vector<lib::log_message> = 0;
 
 		void showEvent(QShowEvent *event) override;
+		void hideEvent(QHideEvent *event) override;
 
 	private:
-		static constexpr int messageRole = 0x100;
-
-		QTreeWidget *list;
+		/**
+		 * How often to check for new messages while visible
+		 */
+		static constexpr int refreshInterval = 1000;
+
+		/**
+		 * Time to wait after typing before filtering
+		 */
+		static constexpr int filterDelay = 250;
+
+		QTreeView *list;
+		Model *model;
+		QLineEdit *search;
+		QComboBox *types;
+		QTimer *refreshTimer;
+		QTimer *filterTimer;
+
+		/**
+		 * Number of messages added to the model
+		 */
+		size_t next = 0;
 
 		auto collectLogs() -> QString;
 
+		void onRefresh();
+		void onFilterChanged();
+
 		void onCopyToClipboard(bool checked);
 		void onSaveToFile(bool checked);
 		void onMenuRequested(const QPoint &pos);
@@ -0,0 +1,282 @@
+#include "view/log/model.hpp"
+#include "metatypes.hpp"
+
+#include "lib/executor.hpp"
+#include "lib/log.hpp"
+#include "lib/vector.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+Log::Model::Model(QObject *parent)
+	: QAbstractTableModel(parent)
+{
+}
+
+void Log::Model::append(const std::vector<lib::log_message> &items)
+{
+	if (items.empty())
+	{
+		return;
+	}
+
+	Chunk chunk;
+	chunk.first = nextIndex;
+	chunk.messages = std::make_shared<const std::vector<lib::log_message>>(items);
+
+	// Remove oldest chunks at once, instead of a few messages at a time
+	if (nextIndex + items.size() - firstIndex() > maxMessages * 2)
+	{
+		beginResetModel();
+		chunks.push_back(chunk);
+		nextIndex += items.size();
+
+		while (nextIndex - (chunks.front().first + chunks.front().messages->size())
+			>= maxMessages)
+		{
+			chunks.pop_front();
+		}
+
+		// Indices are kept when removing, so only rows of removed messages are removed
+		rows.erase(rows.begin(), std::lower_bound(rows.begin(), rows.end(), firstIndex()));
+		endResetModel();
+		return;
+	}
+
+	if (!isFiltered())
+	{
+		const auto from = rowCount();
+		beginInsertRows(QModelIndex(), from, from + static_cast<int>(items.size()) - 1);
+		chunks.push_back(chunk);
+		nextIndex += items.size();
+		endInsertRows();
+		return;
+	}
+
+	chunks.push_back(chunk);
+	nextIndex += items.size();
+
+	// Filtered when filtering in the background is done
+	if (filtering)
+	{
+		return;
+	}
+
+	const auto matched = filterChunk(filter, chunk);
+	if (matched.empty())
+	{
+		return;
+	}
+
+	beginInsertRows(QModelIndex(), rowCount(),
+		static_cast<int>(rows.size() + matched.size() - 1));
+	lib::vector::append(rows, matched);
+	endInsertRows();
+}
+
+void Log::Model::setFilter(const lib::log_filter &logFilter)
+{
+	beginResetModel();
+	filter = logFilter;
+	rows.clear();
+	endResetModel();
+
+	if (isFiltered())
+	{
+		applyFilter();
+		return;
+	}
+
+	// Ignore any filtering still in progress
+	filterGeneration++;
+	filtering = false;
+}
+
+auto Log::Model::message(int row) const -> const lib::log_message &
+{
+	const auto index = isFiltered()
+		? rows.at(row)
+		: firstIndex() + static_cast<size_t>(row);
+
+	// Last chunk starting at, or before, index
+	const auto next = std::upper_bound(chunks.cbegin(), chunks.cend(), index,
+		[](size_t value, const Chunk &chunk) -> bool
+		{
+			return value < chunk.first;
+		});
+
+	if (next == chunks.cbegin())
+	{
+		throw std::out_of_range("Message not found");
+	}
+
+	const auto &chunk = *(next - 1);
+	return chunk.messages->at(index - chunk.first);
+}
+
+auto Log::Model::rowCount(const QModelIndex &parent) const -> int
+{
+	if (parent.isValid())
+	{
+		return 0;
+	}
+
+	return static_cast<int>(isFiltered() ? rows.size() : nextIndex - firstIndex());
+}
+
+auto Log::Model::rowCount() const -> int
+{
+	return rowCount(QModelIndex());
+}
+
+auto Log::Model::columnCount(const QModelIndex &parent) const -> int
+{
+	constexpr int columnCount = 3;
+	return parent.isValid() ? 0 : columnCount;
+}
+
+auto Log::Model::data(const QModelIndex &index, int role) const -> QVariant
+{
+	if (index.row() < 0 || index.row() >= rowCount())
+	{
+		return {};
+	}
+
+	const auto &logMessage = message(index.row());
+
+	if (role == messageRole)
+	{
+		return QVariant::fromValue(logMessage);
+	}
+
+	if (role != Qt::DisplayRole && role != Qt::ToolTipRole)
+	{
+		return {};
+	}
+
+	switch (index.column())
+	{
+		case 0:
+			return QString::fromStdString(logMessage.get_time());
+
+		case 1:
+			return QString::fromStdString(logMessage.get_type());
+
+		case 2:
+			return QString::fromStdString(logMessage.get_message());
+
+		default:
+			return {};
+	}
+}
+
+auto Log::Model::headerData(int section, Qt::Orientation orientation,
+	int role) const -> QVariant
+{
+	if (orientation != Qt::Horizontal || role != Qt::DisplayRole)
+	{
+		return {};
+	}
+
+	switch (section)
+	{
+		case 0:
+			return QStringLiteral("Time");
+
+		case 1:
+			return QStringLiteral("Type");
+
+		case 2:
+			return QStringLiteral("Message");
+
+		default:
+			return {};
+	}
+}
+
+auto Log::Model::isFiltered() const -> bool
+{
+	return !filter.is_empty();
+}
+
+auto Log::Model::firstIndex() const -> size_t
+{
+	return chunks.empty()
+		? nextIndex
+		: chunks.front().first;
+}
+
+void Log::Model::applyFilter()
+{
+	const auto generation = ++filterGeneration;
+	filtering = true;
+
+	// Chunks are shared instead of copying all messages,
+	// and messages appended while filtering are filtered when done
+	const auto current = filter;
+	const auto snapshot = chunks;
+	const auto filtered = nextIndex;
+
+	lib::cancel_context context(cancelScope.token());
+
+	const auto matched = lib::executor::shared().async<std::vector<size_t>>(
+		[current, snapshot]() -> std::vector<size_t>
+		{
+			std::vector<size_t> indices;
+			for (const auto &chunk: snapshot)
+			{
+				lib::vector::append(indices, filterChunk(current, chunk));
+			}
+			return indices;
+		});
+
+	matched.then([this, generation, filtered](const std::vector<size_t> &indices)
+	{
+		if (generation == filterGeneration)
+		{
+			finishFilter(indices, filtered);
+		}
+	});
+
+	matched.fail([this, generation](const std::string &message)
+	{
+		if (generation != filterGeneration)
+		{
+			return;
+		}
+
+		lib::log::warn("Failed to filter log in the background: {}", message);
+		finishFilter({}, 0);
+	});
+}
+
+void Log::Model::finishFilter(const std::vector<size_t> &matched, size_t filtered)
+{
+	beginResetModel();
+
+	// Oldest messages may have been removed while filtering
+	rows.assign(std::lower_bound(matched.cbegin(), matched.cend(), firstIndex()),
+		matched.cend());
+
+	for (const auto &chunk: chunks)
+	{
+		if (chunk.first >= filtered)
+		{
+			lib::vector::append(rows, filterChunk(filter, chunk));
+		}
+	}
+
+	filtering = false;
+	endResetModel();
+}
+
+auto Log::Model::filterChunk(const lib::log_filter &logFilter,
+	const Chunk &chunk) -> std::vector<size_t>
+{
+	auto indices = logFilter.apply(*chunk.messages, 0);
+	for (auto &index: indices)
+	{
+		index += chunk.first;
+	}
+	return indices;
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "lib/canceltoken.hpp"
+#include "lib/logfilter.hpp"
+#include "lib/logmessage.hpp"
+
+#include <QAbstractTableModel>
+
+#include <deque>
+#include <memory>
+
+namespace Log
+{
+	/**
+	 * Log messages shown in a view, only creating what's visible,
+	 * where messages are appended as they are logged
+	 */
+	class Model: public QAbstractTableModel
+	{
+	Q_OBJECT
+
+	public:
+		explicit Model(QObject *parent);
+
+		/**
+		 * Role for the lib::log_message of a row
+		 */
+		static constexpr int messageRole = Qt::UserRole;
+
+		/**
+		 * Append new messages, removing the oldest if too many
+		 */
+		void append(const std::vector<lib::log_message> &items);
+
+		/**
+		 * Only show matching messages, filtered in the background
+		 */
+		void setFilter(const lib::log_filter &logFilter);
+
+		/**
+		 * Message shown in row
+		 */
+		auto message(int row) const -> const lib::log_message &;
+
+		auto rowCount(const QModelIndex &parent) const -> int override;
+		auto rowCount() const -> int;
+
+		auto columnCount(const QModelIndex &parent) const -> int override;
+
+		auto data(const QModelIndex &index, int role) const -> QVariant override;
+
+		auto headerData(int section, Qt::Orientation orientation,
+			int role) const -> QVariant override;
+
+	private:
+		/**
+		 * Messages appended at once, never changed after,
+		 * so they can be shared with filtering in the background
+		 */
+		class Chunk
+		{
+		public:
+			/**
+			 * Index of first message, counted from the first message ever appended
+			 */
+			size_t first = 0;
+
+			std::shared_ptr<const std::vector<lib::log_message>> messages;
+		};
+
+		/**
+		 * Max messages kept, same as the log history
+		 */
+		static constexpr size_t maxMessages = 10000;
+
+		std::deque<Chunk> chunks;
+
+		/**
+		 * Index of next message to be appended
+		 */
+		size_t nextIndex = 0;
+
+		/**
+		 * Index of each shown message, if filtered
+		 */
+		std::vector<size_t> rows;
+
+		lib::log_filter filter;
+
+		/**
+		 * Incremented each time filtering starts, to ignore outdated results
+		 */
+		size_t filterGeneration = 0;
+
+		/**
+		 * Filtering in the background, where rows are updated when done
+		 */
+		bool filtering = false;
+
+		lib::cancel_scope cancelScope;
+
+		auto isFiltered() const -> bool;
+
+		/**
+		 * Index of oldest message kept
+		 */
+		auto firstIndex() const -> size_t;
+
+		/**
+		 * Filter all messages in the background
+		 */
+		void applyFilter();
+
+		/**
+		 * Show matching messages, and filter messages appended while filtering
+		 * @param matched Indices of matching messages
+		 * @param filtered Index of first message not yet filtered
+		 */
+		void finishFilter(const std::vector<size_t> &matched, size_t filtered);
+
+		/**
+		 * Indices of matching messages in chunk
+		 */
+		static auto filterChunk(const lib::log_filter &logFilter,
+			const Chunk &chunk) -> std::vector<size_t>;
+	};
+}
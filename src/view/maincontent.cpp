@@ -1,4 +1,7 @@
 #include "maincontent.hpp"
+#include "util/shortcut.hpp"
+
+#include <QShortcut>
 
 MainContent::MainContent(lib::spt::api &spotify, lib::settings &settings,
 	lib::cache &cache, QWidget *parent)
@@ -11,8 +14,40 @@ MainContent::MainContent(lib::spt::api &spotify, lib::settings &settings,
 	status = new StatusMessage(this);
 	layout->addWidget(status);
 
+	filter = new QLineEdit(this);
+	filter->setPlaceholderText(QStringLiteral("Filter tracks"));
+	filter->setClearButtonEnabled(true);
+	filter->setVisible(false);
+	layout->addWidget(filter);
+
 	tracks = new List::Tracks(spotify, settings, cache, this);
 	layout->addWidget(tracks, 1);
+
+	QLineEdit::connect(filter, &QLineEdit::textChanged,
+		tracks, &List::Tracks::setFilter);
+
+	QShortcut::connect(new QShortcut(Shortcut::filterTracks(), this),
+		&QShortcut::activated, this, &MainContent::onShowFilter);
+
+	auto *hideFilter = new QShortcut(QKeySequence(Qt::Key_Escape), filter);
+	hideFilter->setContext(Qt::WidgetShortcut);
+
+	QShortcut::connect(hideFilter, &QShortcut::activated,
+		this, &MainContent::onHideFilter);
+}
+
+void MainContent::onShowFilter()
+{
+	filter->setVisible(true);
+	filter->setFocus();
+	filter->selectAll();
+}
+
+void MainContent::onHideFilter()
+{
+	filter->clear();
+	filter->setVisible(false);
+	tracks->setFocus();
 }
 
 auto MainContent::getTracksList() const -> List::Tracks *
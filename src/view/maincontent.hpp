@@ -4,6 +4,7 @@
 #include "widget/statusmessage.hpp"
 
 #include <QVBoxLayout>
+#include <QLineEdit>
 
 class MainContent: public QWidget
 {
@@ -20,4 +21,8 @@ private:
 
 	List::Tracks *tracks = nullptr;
 	StatusMessage *status = nullptr;
+	QLineEdit *filter = nullptr;
+
+	void onShowFilter();
+	void onHideFilter();
 };
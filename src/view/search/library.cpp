@@ -1,11 +1,14 @@
 #include "view/search/library.hpp"
 #include "view/search/view.hpp"
+#include "lib/trackindex.hpp"
+#include "lib/executor.hpp"
 
 Search::Library::Library(lib::spt::api &spotify,
 	lib::cache &cache, QWidget *parent)
 	: Search::Tracks(spotify, cache, parent),
 	spotify(spotify),
-	cache(cache)
+	cache(cache),
+	savedTracksSync(spotify, cache)
 {
 }
 
@@ -13,11 +16,40 @@ void Search::Library::searchCache(const std::string &query)
 {
 	if (query.empty())
 	{
-		clear();
+		clearTracks();
 		return;
 	}
 
-	addResults(query, cache.get_tracks("liked_tracks"));
+	// Building the index the first time reads the entire cache,
+	// so skip it if a new search started, or view was closed, before it started
+	const auto token = lib::cancel_token::current();
+	auto &libraryCache = cache;
+
+	const auto searched = lib::executor::shared().async<lib::spt::search_results>(
+		[token, &libraryCache, query]() -> lib::spt::search_results
+		{
+			if (token.is_cancelled())
+			{
+				return {};
+			}
+			return libraryCache.search(query);
+		});
+
+	// Neither is called if cancelled, so view is still valid
+	searched.then([this](const lib::spt::search_results &results)
+	{
+		clearTracks();
+		for (const auto &track: results.tracks)
+		{
+			add(track);
+		}
+	});
+
+	searched.fail([this](const std::string &message)
+	{
+		lib::log::error("Failed to search library: {}", message);
+		clearTracks();
+	});
 }
 
 void Search::Library::search(const std::string &query)
@@ -31,11 +63,11 @@ void Search::Library::search(const std::string &query)
 
 	if (query.empty())
 	{
-		clear();
+		clearTracks();
 		return;
 	}
 
-	spotify.saved_tracks([this, query](const std::vector<lib::spt::track> &tracks)
+	savedTracksSync.sync([this, query](const std::vector<lib::spt::track> &tracks)
 	{
 		this->addResults(query, tracks);
 	});
@@ -44,17 +76,11 @@ void Search::Library::search(const std::string &query)
 void Search::Library::addResults(const std::string &query,
 	const std::vector<lib::spt::track> &tracks)
 {
-	clear();
-	auto q = lib::strings::to_lower(query);
+	clearTracks();
+	const lib::track_index index(tracks);
 
-	for (const auto &track: tracks)
+	for (const auto i: index.filter(query))
 	{
-		if (lib::strings::contains(lib::strings::to_lower(track.name), q)
-			|| lib::strings::contains(lib::strings::to_lower(track.album.name), q)
-			|| lib::strings::contains(lib::strings::to_lower(
-				lib::spt::entity::combine_names(track.artists)), q))
-		{
-			add(track);
-		}
+		add(tracks.at(i));
 	}
 }
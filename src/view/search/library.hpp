@@ -1,6 +1,7 @@
 #pragma once
 
 #include "lib/spotify/api.hpp"
+#include "lib/spotify/savedtrackssync.hpp"
 #include "view/search/tracks.hpp"
 
 namespace Search
@@ -12,15 +13,19 @@ namespace Search
 	public:
 		Library(lib::spt::api &spotify, lib::cache &cache, QWidget *parent);
 
-		/** Searches in cache */
+		/**
+		 * Searches in all cached tracks in the background
+		 * @note Results are ignored if the current cancel token is cancelled
+		 */
 		void searchCache(const std::string &query);
 
-		/** Makes a new request and searches saved tracks */
+		/** Syncs and searches saved tracks */
 		void search(const std::string &query);
 
 	private:
 		lib::spt::api &spotify;
 		lib::cache &cache;
+		lib::spt::saved_tracks_sync savedTracksSync;
 		std::string lastQuery;
 
 		void addResults(const std::string &query,
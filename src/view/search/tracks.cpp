@@ -45,46 +45,24 @@ void Search::Tracks::add(const lib::spt::track &track)
 		QVariant::fromValue(track));
 	item->setToolTip(0, trackName);
 	item->setToolTip(1, trackArtist);
-}
-
-void Search::Tracks::onItemDoubleClicked(QTreeWidgetItem *item, int /*column*/)
-{
-	const auto &selectedItem = item->data(0, static_cast<int>(DataRole::Track))
-		.value<lib::spt::track>();
-	auto selectedIndex = -1;
 
-	const auto itemCount = topLevelItemCount();
-	std::vector<std::string> trackUris;
-	trackUris.reserve(itemCount);
-
-	for (auto i = 0; i < itemCount; i++)
+	if (track.is_valid())
 	{
-		const auto *current = topLevelItem(i);
-		const auto &track = current->data(0, static_cast<int>(DataRole::Track))
-			.value<lib::spt::track>();
-
-		if (!track.is_valid())
-		{
-			continue;
-		}
-
-		if (selectedIndex < 0 && track.id == selectedItem.id)
-		{
-			selectedIndex = i;
-		}
-
+		item->setData(0, static_cast<int>(DataRole::Index),
+			static_cast<int>(trackUris.size()));
 		trackUris.push_back(lib::spt::id_to_uri("track", track.id));
 	}
+}
 
-	// Track wasn't found in list somehow, only play found track
-	if (selectedIndex < 0)
-	{
-		selectedIndex = 0;
-		trackUris.clear();
-		trackUris.push_back(lib::spt::id_to_uri("track", selectedItem.id));
-	}
+void Search::Tracks::clearTracks()
+{
+	QTreeWidget::clear();
+	trackUris.clear();
+}
 
-	spotify.play_tracks(selectedIndex, trackUris, [](const std::string &status)
+void Search::Tracks::onItemDoubleClicked(QTreeWidgetItem *item, int /*column*/)
+{
+	auto callback = [](const std::string &status)
 	{
 		if (status.empty())
 		{
@@ -93,7 +71,23 @@ void Search::Tracks::onItemDoubleClicked(QTreeWidgetItem *item, int /*column*/)
 
 		StatusMessage::error(QString("Failed to play track: %1")
 			.arg(QString::fromStdString(status)));
-	});
+	};
+
+	bool indexFound;
+	auto selectedIndex = item->data(0, static_cast<int>(DataRole::Index)).toInt(&indexFound);
+	if (indexFound)
+	{
+		spotify.play_tracks(selectedIndex, trackUris, callback);
+		return;
+	}
+
+	// Track wasn't found in list somehow, only play found track
+	const auto &selectedItem = item->data(0, static_cast<int>(DataRole::Track))
+		.value<lib::spt::track>();
+
+	spotify.play_tracks(0, {
+		lib::spt::id_to_uri("track", selectedItem.id),
+	}, callback);
 }
 
 void Search::Tracks::onContextMenu(const QPoint &pos)
@@ -16,6 +16,11 @@ namespace Search
 
 		void add(const lib::spt::track &track);
 
+		/**
+		 * Remove all tracks, use instead of QTreeWidget::clear
+		 */
+		void clearTracks();
+
 	protected:
 		void resizeEvent(QResizeEvent *event) override;
 
@@ -26,6 +31,11 @@ namespace Search
 		lib::spt::api &spotify;
 		lib::cache &cache;
 
+		/**
+		 * URIs of all valid tracks, in the order they were added
+		 */
+		std::vector<std::string> trackUris;
+
 		void onItemDoubleClicked(QTreeWidgetItem *item, int column);
 		void onContextMenu(const QPoint &pos);
 	};
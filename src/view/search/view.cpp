@@ -6,7 +6,9 @@ Search::View::View(lib::spt::api &spotify, lib::cache &cache,
 	: QWidget(parent),
 	spotify(spotify),
 	cache(cache),
-	httpClient(httpClient)
+	httpClient(httpClient),
+	resultsCache(32),
+	searchScope(new lib::cancel_scope())
 {
 	auto *layout = new QVBoxLayout();
 	searchBox = new QLineEdit(this);
@@ -37,6 +39,18 @@ Search::View::View(lib::spt::api &spotify, lib::cache &cache,
 	QLineEdit::connect(searchBox, &QLineEdit::returnPressed,
 		this, &Search::View::search);
 
+	// Or when typing stops for a bit
+	constexpr int debounceInterval = 300;
+	debounce = new QTimer(this);
+	debounce->setSingleShot(true);
+	debounce->setInterval(debounceInterval);
+
+	QTimer::connect(debounce, &QTimer::timeout,
+		this, &Search::View::onDebounceTimeout);
+
+	QLineEdit::connect(searchBox, &QLineEdit::textEdited,
+		this, &Search::View::onSearchTextEdited);
+
 	// Searching in library is a separate request,
 	// so only actually search once requested
 	QTabWidget::connect(tabs, &QTabWidget::currentChanged,
@@ -70,34 +84,18 @@ void Search::View::hideEvent(QHideEvent *event)
 
 void Search::View::search()
 {
-	// Empty all previous results
-	tracks->clear();
-	artists->clear();
-	albums->clear();
-	playlists->clear();
-	library->clear();
-	shows->clear();
-
-	// Disable search box while searching
-	searchBox->setEnabled(false);
+	debounce->stop();
 
 	// Save last searched query
 	searchText = searchBox->text();
 
-	// Search in library cache until tab is selected
-	library->searchCache(searchText.toStdString());
-
-	// Don't actually search if nothing to search on
-	if (searchText.isEmpty())
-	{
-		searchBox->setEnabled(true);
-		return;
-	}
-
 	// Check if spotify uri
-	if (searchText.startsWith("spotify:")
-		|| searchText.startsWith("https://open.spotify.com/"))
+	if (isUri(searchText))
 	{
+		// Results are added one by one, so empty all previous results
+		lib::cancel_context context(newSearch());
+		clearResults();
+
 		// Length of "https://"
 		constexpr int protocolLength = 8;
 
@@ -153,17 +151,11 @@ void Search::View::search()
 			}
 
 			tabs->setCurrentIndex(static_cast<int>(i));
-			searchBox->setEnabled(true);
 		}
 	}
 	else
 	{
-		// Get search results
-		spotify.search(searchText.toStdString(),
-			[this](const lib::spt::search_results &results)
-			{
-				this->resultsLoaded(results);
-			});
+		searchQuery(searchText.toStdString());
 
 		// Library search is handled separately
 		if (static_cast<SearchTab>(tabs->currentIndex()) == SearchTab::Library)
@@ -173,40 +165,135 @@ void Search::View::search()
 	}
 }
 
-void Search::View::resultsLoaded(const lib::spt::search_results &results)
+auto Search::View::newSearch() -> lib::cancel_token
 {
-	// Albums
-	for (const auto &album: results.albums)
+	searchId++;
+
+	// Destroying the previous scope cancels it
+	searchScope.reset(new lib::cancel_scope());
+	return searchScope->token();
+}
+
+void Search::View::searchQuery(const std::string &query)
+{
+	lib::cancel_context context(newSearch());
+
+	// Search in library cache until tab is selected
+	library->searchCache(query);
+
+	// Don't actually search if nothing to search on
+	if (query.empty())
 	{
-		albums->add(album);
+		clearResults();
+		return;
 	}
 
-	// Artists
-	for (const auto &artist: results.artists)
+	const auto *cached = resultsCache.get(query);
+	if (cached != nullptr)
 	{
-		artists->add(artist);
+		resultsLoaded(*cached);
+		return;
 	}
 
-	// Playlists
-	for (const auto &playlist: results.playlists)
+	// Never called back if a new search starts before it's done
+	spotify.search(query, [this, query](const lib::spt::search_results &results)
 	{
-		playlists->add(playlist);
-	}
+		resultsCache.put(query, results);
+		resultsLoaded(results);
+	});
+}
+
+void Search::View::clearResults()
+{
+	tracks->clearTracks();
+	artists->clear();
+	albums->clear();
+	playlists->clear();
+	library->clearTracks();
+	shows->clear();
+}
+
+void Search::View::resultsLoaded(const lib::spt::search_results &results)
+{
+	const auto current = tabs->currentIndex();
+	addResults(static_cast<SearchTab>(current), results);
+
+	// Other tabs aren't visible yet, so fill them after current tab is shown
+	const auto shared = std::make_shared<lib::spt::search_results>(results);
+	const auto id = searchId;
 
-	// Tracks
-	for (const auto &track: results.tracks)
+	for (auto i = 0; i < tabs->count(); i++)
 	{
-		tracks->add(track);
+		if (i == current)
+		{
+			continue;
+		}
+
+		const auto tab = static_cast<SearchTab>(i);
+		QTimer::singleShot(0, this, [this, id, tab, shared]()
+		{
+			if (id == searchId)
+			{
+				addResults(tab, *shared);
+			}
+		});
 	}
+}
 
-	// Shows/podcasts
-	for (const auto &show: results.shows)
+void Search::View::addResults(SearchTab tab, const lib::spt::search_results &results)
+{
+	switch (tab)
 	{
-		shows->add(show);
+		case SearchTab::Tracks:
+			tracks->clearTracks();
+			for (const auto &track: results.tracks)
+			{
+				tracks->add(track);
+			}
+			break;
+
+		case SearchTab::Artists:
+			artists->clear();
+			for (const auto &artist: results.artists)
+			{
+				artists->add(artist);
+			}
+			break;
+
+		case SearchTab::Albums:
+			albums->clear();
+			for (const auto &album: results.albums)
+			{
+				albums->add(album);
+			}
+			break;
+
+		case SearchTab::Playlists:
+			playlists->clear();
+			for (const auto &playlist: results.playlists)
+			{
+				playlists->add(playlist);
+			}
+			break;
+
+		case SearchTab::Shows:
+			shows->clear();
+			for (const auto &show: results.shows)
+			{
+				shows->add(show);
+			}
+			break;
+
+		case SearchTab::Library:
+			// Searched separately
+			break;
 	}
+}
 
-	// Search done
-	searchBox->setEnabled(true);
+auto Search::View::isUri(const QString &text) -> bool
+{
+	return text.startsWith("spotify:")
+		|| text.startsWith("https://open.spotify.com/");
 }
 
 void Search::View::onIndexChanged(int index)
@@ -216,3 +303,29 @@ void Search::View::onIndexChanged(int index)
 		library->search(searchText.toStdString());
 	}
 }
+
+void Search::View::onSearchTextEdited(const QString &/*text*/)
+{
+	// Restart timer on each key press
+	debounce->start();
+}
+
+void Search::View::onDebounceTimeout()
+{
+	const auto text = searchBox->text();
+
+	// URIs are only looked up when pressing enter, as they're likely pasted incomplete
+	if (text == searchText || isUri(text))
+	{
+		return;
+	}
+
+	// Single characters give too broad results to be worth searching for
+	if (text.length() == 1)
+	{
+		return;
+	}
+
+	searchText = text;
+	searchQuery(searchText.toStdString());
+}
@@ -2,6 +2,8 @@
 
 #include "lib/spotify/api.hpp"
 #include "lib/httpclient.hpp"
+#include "lib/lrucache.hpp"
+#include "lib/canceltoken.hpp"
 
 #include "enum/searchtab.hpp"
 #include "view/search/tracks.hpp"
@@ -15,10 +17,13 @@
 #include <QLineEdit>
 #include <QListWidget>
 #include <QTabWidget>
+#include <QTimer>
 #include <QTreeWidget>
 #include <QTreeWidgetItem>
 #include <QVBoxLayout>
 
+#include <memory>
+
 namespace Search
 {
 	class View: public QWidget
@@ -43,6 +48,7 @@ namespace Search
 		Library *library = nullptr;
 		Shows *shows = nullptr;
 
+		/** Search immediately, including URIs and saved tracks */
 		void search();
 
 	protected:
@@ -52,8 +58,37 @@ namespace Search
 	private:
 		QString searchText;
 
+		/** Waits for typing to stop before searching */
+		QTimer *debounce = nullptr;
+
+		/** Results of recent queries */
+		lib::lru_cache<std::string, lib::spt::search_results> resultsCache;
+
+		/** Incremented for each new search, to ignore results of older searches */
+		unsigned int searchId = 0;
+
+		/** Requests of current search, cancelled when a new search starts */
+		std::unique_ptr<lib::cancel_scope> searchScope;
+
+		/** Cancel requests of previous search, and get token for the new one */
+		auto newSearch() -> lib::cancel_token;
+
+		/** Search using query, from cache if searched recently */
+		void searchQuery(const std::string &query);
+
+		/** Empty all tabs */
+		void clearResults();
+
+		/** Add results to current tab, then the other tabs */
 		void resultsLoaded(const lib::spt::search_results &results);
 
+		/** Replace results in a single tab */
+		void addResults(SearchTab tab, const lib::spt::search_results &results);
+
+		static auto isUri(const QString &text) -> bool;
+
 		void onIndexChanged(int index);
+		void onSearchTextEdited(const QString &text);
+		void onDebounceTimeout();
 	};
 }